@@ -0,0 +1,43 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RByteSwap
+#define ROOT_RByteSwap
+
+#include <cstddef>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+namespace ByteSwap {
+
+/// The instruction set extensions used by the vectorized byte swap kernels.  On x86-64, the available level is
+/// detected at runtime; on 64bit ARM, NEON is always available.
+enum class ESimdLevel { kScalar, kSSSE3, kAVX2, kNEON };
+/// The best kernel variant supported by the CPU
+ESimdLevel GetDetectedSimdLevel();
+/// The kernel variant currently in use, by default the detected level
+ESimdLevel GetSimdLevel();
+/// Selects a different kernel variant, e.g. the scalar one for testing and benchmarking.  Throws std::runtime_error
+/// if the CPU does not support the given level.  Not thread-safe with respect to concurrent byte swapping.
+void SetSimdLevel(ESimdLevel level);
+std::string GetSimdLevelName(ESimdLevel level);
+
+/// Copy `count` elements of 2, 4, or 8 bytes from `source` to `destination`, reversing the byte order of every
+/// element.  Neither buffer needs to be aligned.  The buffers must either be identical (in-place swap) or not overlap.
+void CopySwap16(void *destination, const void *source, std::size_t count);
+void CopySwap32(void *destination, const void *source, std::size_t count);
+void CopySwap64(void *destination, const void *source, std::size_t count);
+
+} // namespace ByteSwap
+} // namespace Internal
+} // namespace ROOT
+
+#endif
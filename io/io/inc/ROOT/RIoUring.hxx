@@ -9,8 +9,11 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <algorithm>
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <stdexcept>
 #include <string>
 
@@ -27,6 +30,24 @@ private:
    struct io_uring fRing;
    std::uint32_t fDepth = 0;
 
+   /// Wait for `nInFlight` submitted reads to complete and discard their completion events.  Used on errors: until
+   /// their completion has been reaped, reads in flight may still write into the destination buffers and their
+   /// completion events would be taken for the ones of the next batch of reads.
+   void DrainCompletions(unsigned int nInFlight) {
+      while (nInFlight > 0) {
+         struct io_uring_cqe *cqe;
+         int ret = io_uring_wait_cqe(&fRing, &cqe);
+         if (ret == -EINTR)
+            continue;
+         if (ret < 0) {
+            Error("RIoUring", "cannot reap %u outstanding read events, error: %s", nInFlight, std::strerror(-ret));
+            return;
+         }
+         io_uring_cqe_seen(&fRing, cqe);
+         --nInFlight;
+      }
+   }
+
 public:
    // Create an io_uring instance. The ring selects an appropriate queue depth. which can be queried
    // afterwards using GetQueueDepth(). The depth is typically 1024 or lower. Throws an exception if
@@ -95,32 +116,43 @@ public:
    };
 
    /// Submit a number of read events and wait for completion. Events are submitted in batches if
-   /// the number of events is larger than the submission queue depth.
-   void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
-      unsigned int batch = 0;
-      unsigned int batchSize = fDepth;
-      unsigned int readPos = 0;
-
-      while (readPos < nReads) {
-         if (readPos + batchSize > nReads) {
-            batchSize = nReads - readPos;
-         }
-         // prep reads
+   /// the number of events is larger than the submission queue depth. The submission queue is refilled as soon as
+   /// events complete, so that up to GetQueueDepth() reads are in flight at any time. Events complete out of order;
+   /// if given, `onComplete` is called with the index of every read event as soon as its data is available.
+   /// If an error occurs or `onComplete` throws, the reads still in flight are reaped before the exception is
+   /// propagated, so that no read writes into the destination buffers anymore.
+   void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads,
+                           const std::function<void(unsigned int)> &onComplete = {}) {
+      unsigned int nSubmitted = 0;
+      unsigned int nCompleted = 0;
+
+      try {
+         SubmitReadsAndWaitImpl(readEvents, nReads, onComplete, nSubmitted, nCompleted);
+      } catch (...) {
+         DrainCompletions(nSubmitted - nCompleted);
+         throw;
+      }
+   }
+
+private:
+   void SubmitReadsAndWaitImpl(RReadEvent *readEvents, unsigned int nReads,
+                               const std::function<void(unsigned int)> &onComplete, unsigned int &nSubmitted,
+                               unsigned int &nCompleted) {
+      while (nCompleted < nReads) {
+         // prep reads for the free slots of the submission queue
+         const unsigned int nPrep = std::min(fDepth - (nSubmitted - nCompleted), nReads - nSubmitted);
          struct io_uring_sqe *sqe;
-         for (std::size_t i = readPos; i < readPos + batchSize; ++i) {
+         for (std::size_t i = nSubmitted; i < nSubmitted + nPrep; ++i) {
             sqe = io_uring_get_sqe(&fRing);
             if (!sqe) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "get SQE failed for read request '" + std::to_string(i)
+               throw std::runtime_error("get SQE failed for read request '" + std::to_string(i)
                   + "', error: " + std::string(strerror(errno)));
             }
             if (readEvents[i].fFileDes == -1) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "bad fd (-1) for read request '" + std::to_string(i) + "'");
+               throw std::runtime_error("bad fd (-1) for read request '" + std::to_string(i) + "'");
             }
             if (readEvents[i].fBuffer == nullptr) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "null read buffer for read request '" + std::to_string(i) + "'");
+               throw std::runtime_error("null read buffer for read request '" + std::to_string(i) + "'");
             }
             io_uring_prep_read(sqe,
                readEvents[i].fFileDes,
@@ -131,41 +163,41 @@ public:
             sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
             sqe->user_data = i;
          }
-
-         // todo(max) check for any difference between submit vs. submit and wait for large nReq
-         int submitted = io_uring_submit_and_wait(&fRing, batchSize);
-         if (submitted <= 0) {
-            throw std::runtime_error("batch " + std::to_string(batch) + ": "
-               "ring submit failed, error: " + std::string(strerror(errno)));
-         }
-         if (submitted != static_cast<int>(batchSize)) {
-            throw std::runtime_error("ring submitted " + std::to_string(submitted) +
-               " events but requested " + std::to_string(batchSize));
+         if (nPrep > 0) {
+            int submitted = io_uring_submit(&fRing);
+            if (submitted > 0)
+               nSubmitted += submitted;
+            if (submitted <= 0) {
+               throw std::runtime_error("ring submit failed, error: " + std::string(strerror(errno)));
+            }
+            if (submitted != static_cast<int>(nPrep)) {
+               throw std::runtime_error("ring submitted " + std::to_string(submitted) +
+                  " events but requested " + std::to_string(nPrep));
+            }
          }
-         // reap reads
+
+         // reap reads: wait for at least one completion, then take all the ones that are ready
          struct io_uring_cqe *cqe;
-         int ret;
-         for (int i = 0; i < submitted; ++i) {
-            ret = io_uring_wait_cqe(&fRing, &cqe);
-            if (ret < 0) {
-               throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
-            }
+         int ret = io_uring_wait_cqe(&fRing, &cqe);
+         if (ret < 0) {
+            throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
+         }
+         do {
             auto index = reinterpret_cast<std::size_t>(io_uring_cqe_get_data(cqe));
             if (index >= nReads) {
                throw std::runtime_error("bad cqe user data: " + std::to_string(index));
             }
             if (cqe->res < 0) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "read failed for ReadEvent[" + std::to_string(index) + "], "
+               throw std::runtime_error("read failed for ReadEvent[" + std::to_string(index) + "], "
                   "error: " + std::string(std::strerror(-cqe->res)));
             }
             readEvents[index].fOutBytes = static_cast<std::size_t>(cqe->res);
             io_uring_cqe_seen(&fRing, cqe);
-         }
-         readPos += batchSize;
-         batch += 1;
+            nCompleted++;
+            if (onComplete)
+               onComplete(index);
+         } while (io_uring_peek_cqe(&fRing, &cqe) == 0);
       }
-      return;
    }
 };
 
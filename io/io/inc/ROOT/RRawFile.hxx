@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -155,6 +156,11 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// Like ReadVImpl() but calls onComplete(i) as soon as ioVec[i] has been read. By default implemented as a call to
+   /// ReadVImpl() followed by the completion of all requests in order. Implementations with asynchronous I/O can
+   /// overwrite it to signal requests out of order while other requests are still in flight.
+   virtual void ReadVCompletionImpl(RIOVec *ioVec, unsigned int nReq,
+                                    const std::function<void(unsigned int)> &onComplete);
 
    /// Open the file if not already open. Otherwise noop.
    void EnsureOpen();
@@ -193,6 +199,9 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and calls ReadVCompletionImpl. The callback is called exactly once for every
+   /// request with its index in ioVec, possibly out of order. The call returns once all requests are completed.
+   void ReadV(RIOVec *ioVec, unsigned int nReq, const std::function<void(unsigned int)> &onComplete);
    /// Returns the limits regarding the ioVec input to ReadV for this specific file; may open the file as a side-effect.
    virtual RIOVecLimits GetReadVLimits() { return RIOVecLimits(); }
 
@@ -12,30 +12,44 @@
 #ifndef ROOT_RRawFileUnix
 #define ROOT_RRawFileUnix
 
+#include <ROOT/RConfig.hxx> // for R__HAS_URING
 #include <ROOT/RRawFile.hxx>
 #include <string_view>
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
 
+class RIoUring;
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
  * for instance, to a named pipe instead of a regular file.
+ *
+ * If ROOT is built with io_uring support, vector reads are submitted to an io_uring instance that is created on the
+ * first ReadV() call and kept for the lifetime of the object. Requests complete out of order.
  */
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+#ifdef R__HAS_URING
+   /// Created on the first vector read; reset if io_uring turns out to be unusable for this file
+   std::unique_ptr<RIoUring> fIoUring;
+#endif
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   void ReadVCompletionImpl(RIOVec *ioVec, unsigned int nReq,
+                            const std::function<void(unsigned int)> &onComplete) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
@@ -0,0 +1,270 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RByteSwap.hxx>
+
+#include "Byteswap.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define R__BYTESWAP_X86_KERNELS
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define R__BYTESWAP_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using ROOT::Internal::ByteSwap::ESimdLevel;
+
+// The vectorized kernels process as many full vectors as possible and leave the remaining elements, starting at
+// `first`, to the scalar kernels.  Loads of a vector always precede its store, which makes in-place swapping safe.
+
+void CopySwap16Scalar(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t first = 0)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      std::uint16_t v;
+      memcpy(&v, src + 2 * i, 2);
+      v = R__bswap_16(v);
+      memcpy(dst + 2 * i, &v, 2);
+   }
+}
+
+void CopySwap32Scalar(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t first = 0)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      std::uint32_t v;
+      memcpy(&v, src + 4 * i, 4);
+      v = R__bswap_32(v);
+      memcpy(dst + 4 * i, &v, 4);
+   }
+}
+
+void CopySwap64Scalar(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t first = 0)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      std::uint64_t v;
+      memcpy(&v, src + 8 * i, 8);
+      v = R__bswap_64(v);
+      memcpy(dst + 8 * i, &v, 8);
+   }
+}
+
+#ifdef R__BYTESWAP_X86_KERNELS
+// Byte permutations for pshufb in the argument order of _mm_set_epi8, i.e. starting with the most significant byte
+#define R__SWAP_MASK16 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1
+#define R__SWAP_MASK32 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3
+#define R__SWAP_MASK64 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7
+
+// 16 bytes per iteration.  Returns the number of bytes processed.
+__attribute__((target("ssse3"))) std::size_t
+CopySwapSSSE3(unsigned char *dst, const unsigned char *src, std::size_t nBytes, __m128i mask)
+{
+   std::size_t b = 0;
+   for (; b + 16 <= nBytes; b += 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + b));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + b), _mm_shuffle_epi8(v, mask));
+   }
+   return b;
+}
+
+// 64 bytes per iteration, followed by at most one 32 byte vector.  The AVX2 byte shuffle operates on the two 128bit
+// lanes independently; since no byte crosses an element boundary, the same mask is used for both lanes.
+__attribute__((target("avx2"))) std::size_t
+CopySwapAVX2(unsigned char *dst, const unsigned char *src, std::size_t nBytes, __m256i mask)
+{
+   std::size_t b = 0;
+   for (; b + 64 <= nBytes; b += 64) {
+      const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + b));
+      const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + b + 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + b), _mm256_shuffle_epi8(v0, mask));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + b + 32), _mm256_shuffle_epi8(v1, mask));
+   }
+   if (b + 32 <= nBytes) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + b));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + b), _mm256_shuffle_epi8(v, mask));
+      b += 32;
+   }
+   return b;
+}
+
+// The masks need to be created in functions with the matching target attribute
+__attribute__((target("ssse3"))) std::size_t CopySwap16SSSE3(unsigned char *dst, const unsigned char *src,
+                                                              std::size_t count)
+{
+   return CopySwapSSSE3(dst, src, 2 * count, _mm_set_epi8(R__SWAP_MASK16)) / 2;
+}
+
+__attribute__((target("ssse3"))) std::size_t CopySwap32SSSE3(unsigned char *dst, const unsigned char *src,
+                                                              std::size_t count)
+{
+   return CopySwapSSSE3(dst, src, 4 * count, _mm_set_epi8(R__SWAP_MASK32)) / 4;
+}
+
+__attribute__((target("ssse3"))) std::size_t CopySwap64SSSE3(unsigned char *dst, const unsigned char *src,
+                                                              std::size_t count)
+{
+   return CopySwapSSSE3(dst, src, 8 * count, _mm_set_epi8(R__SWAP_MASK64)) / 8;
+}
+
+__attribute__((target("avx2"))) std::size_t CopySwap16AVX2(unsigned char *dst, const unsigned char *src,
+                                                            std::size_t count)
+{
+   return CopySwapAVX2(dst, src, 2 * count, _mm256_set_epi8(R__SWAP_MASK16, R__SWAP_MASK16)) / 2;
+}
+
+__attribute__((target("avx2"))) std::size_t CopySwap32AVX2(unsigned char *dst, const unsigned char *src,
+                                                            std::size_t count)
+{
+   return CopySwapAVX2(dst, src, 4 * count, _mm256_set_epi8(R__SWAP_MASK32, R__SWAP_MASK32)) / 4;
+}
+
+__attribute__((target("avx2"))) std::size_t CopySwap64AVX2(unsigned char *dst, const unsigned char *src,
+                                                            std::size_t count)
+{
+   return CopySwapAVX2(dst, src, 8 * count, _mm256_set_epi8(R__SWAP_MASK64, R__SWAP_MASK64)) / 8;
+}
+#endif // R__BYTESWAP_X86_KERNELS
+
+#ifdef R__BYTESWAP_NEON_KERNELS
+// 16 bytes per iteration
+std::size_t CopySwap16NEON(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 8 <= count; i += 8)
+      vst1q_u8(dst + 2 * i, vrev16q_u8(vld1q_u8(src + 2 * i)));
+   return i;
+}
+
+std::size_t CopySwap32NEON(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 4 <= count; i += 4)
+      vst1q_u8(dst + 4 * i, vrev32q_u8(vld1q_u8(src + 4 * i)));
+   return i;
+}
+
+std::size_t CopySwap64NEON(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 2 <= count; i += 2)
+      vst1q_u8(dst + 8 * i, vrev64q_u8(vld1q_u8(src + 8 * i)));
+   return i;
+}
+#endif // R__BYTESWAP_NEON_KERNELS
+
+ESimdLevel DetectSimdLevel()
+{
+#if defined(R__BYTESWAP_X86_KERNELS)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return ESimdLevel::kAVX2;
+   if (__builtin_cpu_supports("ssse3"))
+      return ESimdLevel::kSSSE3;
+   return ESimdLevel::kScalar;
+#elif defined(R__BYTESWAP_NEON_KERNELS)
+   return ESimdLevel::kNEON;
+#else
+   return ESimdLevel::kScalar;
+#endif
+}
+
+std::atomic<ESimdLevel> &GetSimdLevelRef()
+{
+   static std::atomic<ESimdLevel> gSimdLevel{ROOT::Internal::ByteSwap::GetDetectedSimdLevel()};
+   return gSimdLevel;
+}
+
+/// Returns the number of elements swapped by the vectorized kernel of the current SIMD level
+template <std::size_t N>
+std::size_t CopySwapVectorized(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   static_assert(N == 2 || N == 4 || N == 8, "unsupported element size");
+   switch (GetSimdLevelRef().load(std::memory_order_relaxed)) {
+#ifdef R__BYTESWAP_X86_KERNELS
+   case ESimdLevel::kAVX2:
+      return (N == 2) ? CopySwap16AVX2(dst, src, count)
+                      : ((N == 4) ? CopySwap32AVX2(dst, src, count) : CopySwap64AVX2(dst, src, count));
+   case ESimdLevel::kSSSE3:
+      return (N == 2) ? CopySwap16SSSE3(dst, src, count)
+                      : ((N == 4) ? CopySwap32SSSE3(dst, src, count) : CopySwap64SSSE3(dst, src, count));
+#endif
+#ifdef R__BYTESWAP_NEON_KERNELS
+   case ESimdLevel::kNEON:
+      return (N == 2) ? CopySwap16NEON(dst, src, count)
+                      : ((N == 4) ? CopySwap32NEON(dst, src, count) : CopySwap64NEON(dst, src, count));
+#endif
+   default: return 0;
+   }
+}
+
+} // anonymous namespace
+
+ROOT::Internal::ByteSwap::ESimdLevel ROOT::Internal::ByteSwap::GetDetectedSimdLevel()
+{
+   static const ESimdLevel gDetectedLevel = DetectSimdLevel();
+   return gDetectedLevel;
+}
+
+ROOT::Internal::ByteSwap::ESimdLevel ROOT::Internal::ByteSwap::GetSimdLevel()
+{
+   return GetSimdLevelRef().load(std::memory_order_relaxed);
+}
+
+void ROOT::Internal::ByteSwap::SetSimdLevel(ESimdLevel level)
+{
+   const auto detected = GetDetectedSimdLevel();
+   bool isSupported = (level == ESimdLevel::kScalar) || (level == detected);
+   if (level == ESimdLevel::kSSSE3 && detected == ESimdLevel::kAVX2)
+      isSupported = true;
+   if (!isSupported) {
+      throw std::runtime_error("SIMD level " + GetSimdLevelName(level) + " not supported, the CPU supports up to " +
+                               GetSimdLevelName(detected));
+   }
+   GetSimdLevelRef().store(level, std::memory_order_relaxed);
+}
+
+std::string ROOT::Internal::ByteSwap::GetSimdLevelName(ESimdLevel level)
+{
+   switch (level) {
+   case ESimdLevel::kScalar: return "scalar";
+   case ESimdLevel::kSSSE3: return "SSSE3";
+   case ESimdLevel::kAVX2: return "AVX2";
+   case ESimdLevel::kNEON: return "NEON";
+   }
+   return "UNKNOWN";
+}
+
+void ROOT::Internal::ByteSwap::CopySwap16(void *destination, const void *source, std::size_t count)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   CopySwap16Scalar(dst, src, count, CopySwapVectorized<2>(dst, src, count));
+}
+
+void ROOT::Internal::ByteSwap::CopySwap32(void *destination, const void *source, std::size_t count)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   CopySwap32Scalar(dst, src, count, CopySwapVectorized<4>(dst, src, count));
+}
+
+void ROOT::Internal::ByteSwap::CopySwap64(void *destination, const void *source, std::size_t count)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   CopySwap64Scalar(dst, src, count, CopySwapVectorized<8>(dst, src, count));
+}
@@ -118,6 +118,14 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+void ROOT::Internal::RRawFile::ReadVCompletionImpl(RIOVec *ioVec, unsigned int nReq,
+                                                   const std::function<void(unsigned int)> &onComplete)
+{
+   ReadVImpl(ioVec, nReq);
+   for (unsigned i = 0; i < nReq; ++i)
+      onComplete(i);
+}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -218,6 +226,13 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq,
+                                     const std::function<void(unsigned int)> &onComplete)
+{
+   EnsureOpen();
+   ReadVCompletionImpl(ioVec, nReq, onComplete);
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
@@ -113,37 +113,75 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
 }
 
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   ReadVCompletionImpl(ioVec, nReq, [](unsigned int) {});
+}
+
+void ROOT::Internal::RRawFileUnix::ReadVCompletionImpl(RIOVec *ioVec, unsigned int nReq,
+                                                       const std::function<void(unsigned int)> &onComplete)
 {
 #ifdef R__HAS_URING
    thread_local bool uring_failed = false;
-   if (!uring_failed) {
+   if (!fIoUring && !uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
-         std::vector<RIoUring::RReadEvent> reads;
-         reads.reserve(nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            RIoUring::RReadEvent ev;
-            ev.fBuffer = ioVec[i].fBuffer;
-            ev.fOffset = ioVec[i].fOffset;
-            ev.fSize = ioVec[i].fSize;
-            ev.fFileDes = fFileDes;
-            reads.push_back(ev);
-         }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            ioVec[i].fOutBytes = reads.at(i).fOutBytes;
-         }
-         return;
-      }
-      catch(const std::runtime_error &e) {
+         fIoUring = std::make_unique<RIoUring>(); // throws std::runtime_error
+      } catch (const std::runtime_error &e) {
          Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
+         Warning("RRawFileUnix", "io_uring setup failed, falling back to blocking I/O in ReadV");
          uring_failed = true;
       }
    }
+
+   if (fIoUring) {
+      std::vector<RIoUring::RReadEvent> reads;
+      reads.reserve(nReq);
+      for (std::size_t i = 0; i < nReq; ++i) {
+         RIoUring::RReadEvent ev;
+         ev.fBuffer = ioVec[i].fBuffer;
+         ev.fOffset = ioVec[i].fOffset;
+         ev.fSize = ioVec[i].fSize;
+         ev.fFileDes = fFileDes;
+         reads.push_back(ev);
+      }
+
+      std::vector<bool> isCompleted(nReq, false);
+      bool isCallbackError = false;
+      try {
+         fIoUring->SubmitReadsAndWait(reads.data(), nReq, [&](unsigned int i) {
+            ioVec[i].fOutBytes = reads[i].fOutBytes;
+            isCompleted[i] = true;
+            try {
+               onComplete(i);
+            } catch (...) {
+               isCallbackError = true;
+               throw;
+            }
+         });
+         return;
+      } catch (const std::runtime_error &e) {
+         // SubmitReadsAndWait() reaped the reads in flight before throwing.  Still, the ring may hold prepared but
+         // unsubmitted requests, so we start over with a fresh ring on the next call.
+         fIoUring.reset();
+         if (isCallbackError)
+            throw;
+         Warning("RRawFileUnix", "io_uring read failed, falling back to blocking I/O in ReadV:\n%s", e.what());
+         for (unsigned int i = 0; i < nReq; ++i) {
+            if (isCompleted[i])
+               continue;
+            ioVec[i].fOutBytes = ReadAt(ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset);
+            onComplete(i);
+         }
+         return;
+      } catch (...) {
+         fIoUring.reset();
+         throw;
+      }
+   }
 #endif
+   // Note that RRawFile::ReadVCompletionImpl() would call back into our ReadVImpl()
    RRawFile::ReadVImpl(ioVec, nReq);
+   for (unsigned int i = 0; i < nReq; ++i)
+      onComplete(i);
 }
 
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
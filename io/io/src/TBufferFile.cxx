@@ -35,14 +35,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TInterpreter.h"
 #include "TVirtualMutex.h"
 
-#if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
-     defined(__GNUC__)
-#define USE_BSWAPCPY
-#endif
-
-#ifdef USE_BSWAPCPY
-#include "Bswapcpy.h"
-#endif
+#include <ROOT/RByteSwap.hxx>
 
 
 const UInt_t kNewClassTag       = 0xFFFFFFFF;
@@ -762,17 +755,11 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    if (!h) h = new Short_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap16(h, fBufCur, n);
 #else
    memcpy(h, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -795,17 +782,11 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    if (!ii) ii = new Int_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(ii, fBufCur, n);
 #else
    memcpy(ii, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -854,12 +835,11 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(ll, fBufCur, n);
 #else
    memcpy(ll, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -882,17 +862,11 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    if (!f) f = new Float_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(f, fBufCur, n);
 #else
    memcpy(f, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -915,12 +889,11 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(d, fBufCur, n);
 #else
    memcpy(d, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -1035,17 +1008,11 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    if (!h) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap16(h, fBufCur, n);
 #else
    memcpy(h, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -1067,17 +1034,11 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    if (!ii) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(ii, fBufCur, n);
 #else
    memcpy(ii, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -1124,12 +1085,11 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(ll, fBufCur, n);
 #else
    memcpy(ll, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -1151,17 +1111,11 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    if (!f) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(f, fBufCur, n);
 #else
    memcpy(f, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -1183,12 +1137,11 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(d, fBufCur, n);
 #else
    memcpy(d, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 
    return n;
 }
@@ -1301,17 +1254,11 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    if (n <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
-   fBufCur += sizeof(Short_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap16(h, fBufCur, n);
 #else
    memcpy(h, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1323,17 +1270,11 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(ii, fBufCur, n);
 #else
    memcpy(ii, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1361,12 +1302,11 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(ll, fBufCur, n);
 #else
    memcpy(ll, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1378,17 +1318,11 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(f, fBufCur, n);
 #else
    memcpy(f, fBufCur, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1400,14 +1334,82 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(d, fBufCur, n);
 #else
    memcpy(d, fBufCur, l);
+#endif
    fBufCur += l;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n 32bit words from the (big-endian) I/O buffer to dst in host byte order.
+
+static inline void CopyFromBuf32(void *dst, const char *buf, Int_t n)
+{
+#ifdef R__BYTESWAP
+   ROOT::Internal::ByteSwap::CopySwap32(dst, buf, n);
+#else
+   memcpy(dst, buf, 4 * n);
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read n integers written with a range (see TBufferFile::WriteFloat16) and
+/// convert them back to floating point numbers.
+/// The integers are first copied in bulk into the destination array, for doubles
+/// into its first half. The conversion then runs backwards so that no integer is
+/// overwritten before it is converted.
+
+template <typename T>
+static void ReadArrayWithFactor(char *&buf, T *ptr, Int_t n, Double_t factor, Double_t minvalue)
+{
+   CopyFromBuf32(ptr, buf, n);
+   buf += 4 * n;
+   const char *ints = reinterpret_cast<const char *>(ptr);
+   for (Int_t j = n - 1; j >= 0; j--) {
+      UInt_t aint;
+      memcpy(&aint, ints + 4 * j, 4);
+      ptr[j] = (T)(aint / factor + minvalue);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read n floats and convert them to doubles, in the same way as ReadArrayWithFactor.
+
+static void ReadArrayFloatAsDouble(char *&buf, Double_t *d, Int_t n)
+{
+   CopyFromBuf32(d, buf, n);
+   buf += 4 * n;
+   const char *floats = reinterpret_cast<const char *>(d);
+   for (Int_t i = n - 1; i >= 0; i--) {
+      Float_t afloat;
+      memcpy(&afloat, floats + 4 * i, 4);
+      d[i] = (Double_t)afloat;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read n floats written as exponent (UChar_t) and mantissa truncated to nbits
+/// (big-endian UShort_t, see TBufferFile::WriteFloat16). The 3-byte records are
+/// decoded directly from the buffer.
+
+template <typename T>
+static void ReadArrayWithNbits(char *&buf, T *ptr, Int_t n, Int_t nbits)
+{
+   const UChar_t *rec = reinterpret_cast<const UChar_t *>(buf);
+   for (Int_t i = 0; i < n; i++, rec += 3) {
+      UInt_t theExp = rec[0];
+      UInt_t theMan = (UInt_t(rec[1]) << 8) | rec[2];
+      UInt_t theBits = (theExp << 23) | ((theMan & ((1 << (nbits + 1)) - 1)) << (23 - nbits));
+      // sign bit
+      theBits |= ((theMan >> (nbits + 1)) & 1) << 31;
+      Float_t afloat;
+      memcpy(&afloat, &theBits, 4);
+      ptr[i] = (T)afloat;
+   }
+   buf += 3 * n;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read array of n floats (written as truncated float) from the I/O buffer.
 /// see comments about Float16_t encoding at TBufferFile::WriteFloat16
@@ -1418,33 +1420,14 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a float
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
-      }
+      ReadArrayWithFactor(fBufCur, f, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the new float.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         f[i] = fFloatValue;
-      }
+      ReadArrayWithNbits(fBufCur, f, n, nbits);
    }
 }
 
@@ -1457,9 +1440,7 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a float
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
-   }
+   ReadArrayWithFactor(fBufCur, ptr, n, factor, minvalue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1473,21 +1454,7 @@ void TBufferFile::ReadFastArrayWithNbits(Float_t *ptr, Int_t n, Int_t nbits)
    if (!nbits) nbits = 12;
    //we read the exponent and the truncated mantissa of the float
    //and rebuild the new float.
-   union {
-      Float_t fFloatValue;
-      Int_t   fIntValue;
-   };
-   UChar_t  theExp;
-   UShort_t theMan;
-   for (Int_t i = 0; i < n; i++) {
-      *this >> theExp;
-      *this >> theMan;
-      fIntValue = theExp;
-      fIntValue <<= 23;
-      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-      if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-      ptr[i] = fFloatValue;
-   }
+   ReadArrayWithNbits(fBufCur, ptr, n, nbits);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1500,40 +1467,17 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a double.
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
-      }
+      ReadArrayWithFactor(fBufCur, d, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) {
          //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
-         }
+         ReadArrayFloatAsDouble(fBufCur, d, n);
       } else {
          //we read the exponent and the truncated mantissa of the float
          //and rebuild the double.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         UChar_t  theExp;
-         UShort_t theMan;
-         for (i = 0; i < n; i++) {
-            *this >> theExp;
-            *this >> theMan;
-            fIntValue = theExp;
-            fIntValue <<= 23;
-            fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-            if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-            d[i] = (Double_t)fFloatValue;
-         }
+         ReadArrayWithNbits(fBufCur, d, n, nbits);
       }
    }
 }
@@ -1547,9 +1491,7 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a double.
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
-   }
+   ReadArrayWithFactor(fBufCur, d, n, factor, minvalue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1562,29 +1504,11 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
 
    if (!nbits) {
       //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
-      }
+      ReadArrayFloatAsDouble(fBufCur, d, n);
    } else {
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the double.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         d[i] = (Double_t)fFloatValue;
-      }
+      ReadArrayWithNbits(fBufCur, d, n, nbits);
    }
 }
 
@@ -1734,17 +1658,11 @@ void TBufferFile::WriteArray(const Short_t *h, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(fBufCur, h, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap16(fBufCur, h, n);
 #else
    memcpy(fBufCur, h, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1764,17 +1682,11 @@ void TBufferFile::WriteArray(const Int_t *ii, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, ii, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(fBufCur, ii, n);
 #else
    memcpy(fBufCur, ii, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1832,12 +1744,11 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(fBufCur, ll, n);
 #else
    memcpy(fBufCur, ll, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1857,17 +1768,11 @@ void TBufferFile::WriteArray(const Float_t *f, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, f, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(fBufCur, f, n);
 #else
    memcpy(fBufCur, f, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1887,12 +1792,11 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(fBufCur, d, n);
 #else
    memcpy(fBufCur, d, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2000,17 +1904,11 @@ void TBufferFile::WriteFastArray(const Short_t *h, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(fBufCur, h, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap16(fBufCur, h, n);
 #else
    memcpy(fBufCur, h, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2024,17 +1922,11 @@ void TBufferFile::WriteFastArray(const Int_t *ii, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, ii, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(fBufCur, ii, n);
 #else
    memcpy(fBufCur, ii, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2076,12 +1968,11 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(fBufCur, ll, n);
 #else
    memcpy(fBufCur, ll, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2095,17 +1986,11 @@ void TBufferFile::WriteFastArray(const Float_t *f, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, f, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
+   ROOT::Internal::ByteSwap::CopySwap32(fBufCur, f, n);
 #else
    memcpy(fBufCur, f, l);
-   fBufCur += l;
 #endif
+   fBufCur += l;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2119,14 +2004,87 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   ROOT::Internal::ByteSwap::CopySwap64(fBufCur, d, n);
 #else
    memcpy(fBufCur, d, l);
+#endif
    fBufCur += l;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Convert the n 32bit words at buf from host byte order to the (big-endian)
+/// byte order of the I/O buffer, in place.
+
+static inline void SwapToBuf32(char *buf, Int_t n)
+{
+#ifdef R__BYTESWAP
+   ROOT::Internal::ByteSwap::CopySwap32(buf, buf, n);
+#else
+   (void)buf;
+   (void)n;
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write n floating point numbers normalized to the range [xmin, xmax] as integers
+/// (see TBufferFile::WriteFloat16). The integers are stored in host byte order first
+/// and byte-swapped in bulk.
+
+template <typename T>
+static void WriteArrayWithFactor(char *&buf, const T *ptr, Int_t n, Double_t factor, Double_t xmin, Double_t xmax)
+{
+   for (Int_t j = 0; j < n; j++) {
+      T x = ptr[j];
+      if (x < xmin) x = xmin;
+      if (x > xmax) x = xmax;
+      UInt_t aint = UInt_t(0.5+factor*(x-xmin));
+      memcpy(buf + 4 * j, &aint, 4);
+   }
+   SwapToBuf32(buf, n);
+   buf += 4 * n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write n doubles as floats, in the same way as WriteArrayWithFactor.
+
+static void WriteArrayDoubleAsFloat(char *&buf, const Double_t *d, Int_t n)
+{
+   for (Int_t i = 0; i < n; i++) {
+      Float_t afloat = (Float_t)d[i];
+      memcpy(buf + 4 * i, &afloat, 4);
+   }
+   SwapToBuf32(buf, n);
+   buf += 4 * n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write n floating point numbers as exponent (UChar_t) and mantissa truncated to
+/// nbits (big-endian UShort_t, see TBufferFile::WriteFloat16). The 3-byte records
+/// are encoded directly into the buffer.
+
+template <typename T>
+static void WriteArrayWithNbits(char *&buf, const T *ptr, Int_t n, Int_t nbits)
+{
+   union {
+      Float_t fFloatValue;
+      Int_t   fIntValue;
+   };
+   UChar_t *rec = reinterpret_cast<UChar_t *>(buf);
+   for (Int_t i = 0; i < n; i++, rec += 3) {
+      fFloatValue = (Float_t)ptr[i];
+      UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
+      UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
+      theMan++;
+      theMan = theMan>>1;
+      if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
+      if (fFloatValue < 0) theMan |= 1<<(nbits+1);
+      rec[0] = theExp;
+      rec[1] = (UChar_t)(theMan >> 8);
+      rec[2] = (UChar_t)(theMan & 0xff);
+   }
+   buf += 3 * n;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write array of n floats (as truncated float) into the I/O buffer.
 /// see comments about Float16_t encoding at TBufferFile::WriteFloat16
@@ -2142,39 +2100,16 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
       //A range is specified. We normalize the float to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Float_t x = f[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      WriteArrayWithFactor(fBufCur, f, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
-      Int_t i;
       //a range is not specified, but nbits is.
       //In this case we truncate the mantissa to nbits and we stream
       //the exponent as a UChar_t and the mantissa as a UShort_t.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      for (i = 0; i < n; i++) {
-         fFloatValue = f[i];
-         UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-         UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-         theMan++;
-         theMan = theMan>>1;
-         if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
-         if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-         *this << theExp;
-         *this << theMan;
-      }
+      WriteArrayWithNbits(fBufCur, f, n, nbits);
    }
 }
 
@@ -2193,45 +2128,19 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       //A range is specified. We normalize the double to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Double_t x = d[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      WriteArrayWithFactor(fBufCur, d, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
-      Int_t i;
       if (!nbits) {
          //if no range and no bits specified, we convert from double to float
-         for (i = 0; i < n; i++) {
-            Float_t afloat = (Float_t)d[i];
-            *this << afloat;
-         }
+         WriteArrayDoubleAsFloat(fBufCur, d, n);
       } else {
          //a range is not specified, but nbits is.
          //In this case we truncate the mantissa to nbits and we stream
          //the exponent as a UChar_t and the mantissa as a UShort_t.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         for (i = 0; i < n; i++) {
-            fFloatValue = (Float_t)d[i];
-            UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-            UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-            theMan++;
-            theMan = theMan>>1;
-            if(theMan&1<<nbits) theMan = (1<<nbits) - 1;
-            if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-            *this << theExp;
-            *this << theMan;
-         }
+         WriteArrayWithNbits(fBufCur, d, n, nbits);
       }
    }
 }
@@ -375,15 +375,25 @@ Bool_t TFileMerger::Merge(Bool_t)
 namespace {
 
 /// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
+/// The RNTuple merge function expects the ntuple name, the output file and the input files as inputs.  On success,
+/// the anchor object is replaced by the anchor of the merged RNTuple.
+Long64_t MergeRNTuples(TClass *rntupleHandle, void *anchor, const char *ntupleName, TDirectory *target,
+                       const TList &sources, TFileMergeInfo &info)
+{
+   if (!rntupleHandle || !anchor || !target->GetFile()) {
       return Long64_t(-1);
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
+   // todo(max) build complete list of sources (some sources may actually be a directory with RNTuples inside)
+   TObjString name(ntupleName);
+   TList inputs;
+   inputs.Add(&name);
+   inputs.Add(target->GetFile());
+   TIter next(&sources);
+   while (TObject *source = next()) {
+      inputs.Add(source);
+   }
    ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+   return func(anchor, &inputs, &info);
 }
 
 Bool_t IsMergeable(TClass *cl)
@@ -599,7 +609,7 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          Warning("MergeRecursive", "merging RNTuples is experimental");
          // todo(max): check if this works when a TDirectory is passed as the first
          // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+         Long64_t mergeResult = MergeRNTuples(cl, obj, keyname, target, *sourcelist, info);
          if (mergeResult < 0) {
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
@@ -3,6 +3,8 @@
 #include "ROOT/RIoUring.hxx"
 #include "ROOT/RRawFileUnix.hxx"
 
+#include <stdexcept>
+
 using RIoUring = ROOT::Internal::RIoUring;
 using RIOVec = RRawFile::RIOVec;
 using RRawFileUnix = ROOT::Internal::RRawFileUnix;
@@ -43,6 +45,64 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVCompletion)
+{
+   auto file = "test_uring_readv_completion";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'a')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+
+   auto nReq = 2000; // more requests than the queue depth, the ring is refilled as requests complete
+
+   for (int round = 0; round < 2; ++round) { // the second round reuses the ring of the first one
+      auto iovecs = make_iovecs(nReq, filesize);
+      std::vector<int> nCompletions(nReq, 0);
+      f->ReadV(iovecs.data(), nReq, [&](unsigned int i) {
+         ASSERT_LT(i, static_cast<unsigned int>(nReq));
+         nCompletions[i]++;
+         for (std::size_t j = 0; j < iovecs[i].fOutBytes; ++j) {
+            EXPECT_EQ('a', ((unsigned char *)iovecs[i].fBuffer)[j]);
+         }
+      });
+
+      for (int i = 0; i < nReq; ++i) {
+         EXPECT_EQ(1, nCompletions[i]);
+         free(iovecs[i].fBuffer);
+      }
+   }
+}
+
+TEST(RRawFileUnix, ReadVCompletionError)
+{
+   auto file = "test_uring_readv_completion_error";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'a')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+
+   auto nReq = 2000;
+   {
+      auto iovecs = make_iovecs(nReq, filesize);
+      // Throwing a non-std::runtime_error while other reads are in flight
+      EXPECT_THROW(f->ReadV(iovecs.data(), nReq, [](unsigned int) { throw std::logic_error("stop"); }),
+                   std::logic_error);
+      // No read can be in flight anymore, so that the buffers can be released
+      for (int i = 0; i < nReq; ++i)
+         free(iovecs[i].fBuffer);
+   }
+
+   // The next vector read does not see completions of the failed one
+   auto iovecs = make_iovecs(nReq, filesize);
+   std::vector<int> nCompletions(nReq, 0);
+   f->ReadV(iovecs.data(), nReq, [&](unsigned int i) { nCompletions[i]++; });
+   for (int i = 0; i < nReq; ++i) {
+      EXPECT_EQ(1, nCompletions[i]);
+      for (std::size_t j = 0; j < iovecs[i].fOutBytes; ++j) {
+         EXPECT_EQ('a', ((unsigned char *)iovecs[i].fBuffer)[j]);
+      }
+      free(iovecs[i].fBuffer);
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
@@ -137,6 +137,25 @@ TEST(RRawFile, ReadV)
    EXPECT_EQ(1U, iovec[1].fOutBytes);
    EXPECT_EQ('H', buffer[0]);
    EXPECT_EQ('d', buffer[1]);
+
+   // Same request vector with completion callback
+   buffer[0] = buffer[1] = 0;
+   iovec[0].fOutBytes = iovec[1].fOutBytes = 0;
+   std::vector<unsigned int> nCompletions(2, 0);
+   f->ReadV(iovec, 2, [&](unsigned int i) {
+      ASSERT_LT(i, 2U);
+      EXPECT_EQ(1U, iovec[i].fOutBytes);
+      nCompletions[i]++;
+   });
+   EXPECT_EQ(1U, nCompletions[0]);
+   EXPECT_EQ(1U, nCompletions[1]);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('d', buffer[1]);
+
+   RRawFileMock m("Hello, World", RRawFile::ROptions());
+   std::vector<unsigned int> completionOrder;
+   m.ReadV(iovec, 2, [&](unsigned int i) { completionOrder.push_back(i); });
+   EXPECT_EQ((std::vector<unsigned int>{0, 1}), completionOrder);
 }
 
 
@@ -0,0 +1,132 @@
+/// \file TBufferFileBenchmark.cxx
+/// \brief Micro-benchmark of TBufferFile::ReadFastArray and WriteFastArray of basic types, comparing the scalar and
+/// the vectorized byte swap kernels
+///
+/// Usage: TBufferFileBenchmark [number of elements] [number of repetitions]
+
+#include "TBufferFile.h"
+#include "TStreamerElement.h"
+#include "TVirtualStreamerInfo.h"
+#include <ROOT/RByteSwap.hxx>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using ROOT::Internal::ByteSwap::ESimdLevel;
+
+namespace {
+
+struct RThroughput {
+   double fRead = 0;
+   double fWrite = 0;
+};
+
+/// Returns the throughput of writing and reading `nElements` elements in MB/s of in-memory data.  The `fnWrite` and
+/// `fnRead` callables stream the array into and out of the given buffer.
+template <typename T, typename WriteT, typename ReadT>
+RThroughput Benchmark(std::size_t nElements, int nRepetitions, WriteT fnWrite, ReadT fnRead)
+{
+   std::vector<T> values(nElements);
+   for (std::size_t i = 0; i < nElements; ++i)
+      values[i] = static_cast<T>((i * 2654435761u) % 1000) / 8;
+   std::vector<T> result(nElements);
+
+   TBufferFile buf(TBuffer::kWrite, nElements * sizeof(T) + 1024);
+   // Warm-up
+   fnWrite(buf, values.data(), nElements);
+
+   auto start = std::chrono::steady_clock::now();
+   for (int i = 0; i < nRepetitions; ++i) {
+      buf.SetBufferOffset(0);
+      fnWrite(buf, values.data(), nElements);
+   }
+   auto stop = std::chrono::steady_clock::now();
+   const double megaBytes = static_cast<double>(nElements) * sizeof(T) * nRepetitions / 1e6;
+   RThroughput throughput;
+   throughput.fWrite = megaBytes / std::chrono::duration<double>(stop - start).count();
+
+   buf.SetReadMode();
+   start = std::chrono::steady_clock::now();
+   for (int i = 0; i < nRepetitions; ++i) {
+      buf.SetBufferOffset(0);
+      fnRead(buf, result.data(), nElements);
+   }
+   stop = std::chrono::steady_clock::now();
+   throughput.fRead = megaBytes / std::chrono::duration<double>(stop - start).count();
+   return throughput;
+}
+
+template <typename T>
+RThroughput BenchmarkFastArray(std::size_t nElements, int nRepetitions)
+{
+   return Benchmark<T>(
+      nElements, nRepetitions, [](TBufferFile &b, const T *v, std::size_t n) { b.WriteFastArray(v, n); },
+      [](TBufferFile &b, T *v, std::size_t n) { b.ReadFastArray(v, n); });
+}
+
+template <typename T>
+void Report(const char *name, std::size_t nElements, int nRepetitions)
+{
+   ROOT::Internal::ByteSwap::SetSimdLevel(ESimdLevel::kScalar);
+   const auto scalar = BenchmarkFastArray<T>(nElements, nRepetitions);
+   const auto detected = ROOT::Internal::ByteSwap::GetDetectedSimdLevel();
+   ROOT::Internal::ByteSwap::SetSimdLevel(detected);
+   const auto vectorized = BenchmarkFastArray<T>(nElements, nRepetitions);
+   const auto levelName = ROOT::Internal::ByteSwap::GetSimdLevelName(detected);
+   std::printf("%-10s read   scalar: %10.1f MB/s   %-6s: %10.1f MB/s   speedup: %5.2fx\n", name, scalar.fRead,
+               levelName.c_str(), vectorized.fRead, vectorized.fRead / scalar.fRead);
+   std::printf("%-10s write  scalar: %10.1f MB/s   %-6s: %10.1f MB/s   speedup: %5.2fx\n", name, scalar.fWrite,
+               levelName.c_str(), vectorized.fWrite, vectorized.fWrite / scalar.fWrite);
+}
+
+template <typename T>
+void ReportTruncated(const char *name, TStreamerElement *element, std::size_t nElements, int nRepetitions)
+{
+   const auto throughput = Benchmark<T>(
+      nElements, nRepetitions,
+      [element](TBufferFile &b, const T *v, std::size_t n) {
+         if constexpr (sizeof(T) == sizeof(Float_t))
+            b.WriteFastArrayFloat16(v, n, element);
+         else
+            b.WriteFastArrayDouble32(v, n, element);
+      },
+      [element](TBufferFile &b, T *v, std::size_t n) {
+         if constexpr (sizeof(T) == sizeof(Float_t))
+            b.ReadFastArrayFloat16(v, n, element);
+         else
+            b.ReadFastArrayDouble32(v, n, element);
+      });
+   std::printf("%-24s read: %10.1f MB/s   write: %10.1f MB/s\n", name, throughput.fRead, throughput.fWrite);
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+   const std::size_t nElements = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 64 * 1024;
+   const int nRepetitions = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+   std::printf("Streaming %zu elements, %d repetitions, detected SIMD level: %s\n\n", nElements, nRepetitions,
+               ROOT::Internal::ByteSwap::GetSimdLevelName(ROOT::Internal::ByteSwap::GetDetectedSimdLevel()).c_str());
+
+   Report<Short_t>("Short_t", nElements, nRepetitions);
+   Report<Int_t>("Int_t", nElements, nRepetitions);
+   Report<Long64_t>("Long64_t", nElements, nRepetitions);
+   Report<Float_t>("Float_t", nElements, nRepetitions);
+   Report<Double_t>("Double_t", nElements, nRepetitions);
+
+   std::printf("\n");
+   TStreamerBasicType rangeFloat("f", "[0,200,16]", 0, TVirtualStreamerInfo::kFloat16, "Float16_t");
+   TStreamerBasicType rangeDouble("d", "[0,200,24]", 0, TVirtualStreamerInfo::kDouble32, "Double32_t");
+   TStreamerBasicType nbitsDouble("d", "[0,0,12]", 0, TVirtualStreamerInfo::kDouble32, "Double32_t");
+   ReportTruncated<Float_t>("Float16_t [0,200,16]", &rangeFloat, nElements, nRepetitions);
+   ReportTruncated<Float_t>("Float16_t (12 bits)", nullptr, nElements, nRepetitions);
+   ReportTruncated<Double_t>("Double32_t [0,200,24]", &rangeDouble, nElements, nRepetitions);
+   ReportTruncated<Double_t>("Double32_t [0,0,12]", &nbitsDouble, nElements, nRepetitions);
+   ReportTruncated<Double_t>("Double32_t (float)", nullptr, nElements, nRepetitions);
+
+   return 0;
+}
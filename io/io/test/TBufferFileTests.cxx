@@ -2,6 +2,12 @@
 
 #include "TBufferFile.h"
 #include "TClass.h"
+#include "TStreamerElement.h"
+#include "TVirtualStreamerInfo.h"
+#include <ROOT/RByteSwap.hxx>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
 #include <vector>
 #include <iostream>
 
@@ -26,3 +32,104 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+namespace {
+
+/// Writes and reads back arrays of basic types with every supported byte swap kernel
+template <typename T>
+void CheckFastArray(const std::vector<T> &values)
+{
+   using ROOT::Internal::ByteSwap::ESimdLevel;
+   const auto detected = ROOT::Internal::ByteSwap::GetDetectedSimdLevel();
+   for (auto level : {ESimdLevel::kScalar, ESimdLevel::kSSSE3, ESimdLevel::kAVX2, ESimdLevel::kNEON}) {
+      try {
+         ROOT::Internal::ByteSwap::SetSimdLevel(level);
+      } catch (const std::runtime_error &) {
+         continue;
+      }
+      // Odd offset into the buffer and odd number of elements to exercise unaligned access and the scalar tail
+      TBufferFile buf(TBuffer::kWrite);
+      buf << (Char_t)0;
+      buf.WriteFastArray(values.data(), values.size());
+
+      buf.SetReadMode();
+      buf.SetBufferOffset(1);
+      std::vector<T> read(values.size());
+      buf.ReadFastArray(read.data(), read.size());
+      EXPECT_EQ(values, read) << ROOT::Internal::ByteSwap::GetSimdLevelName(level);
+   }
+   ROOT::Internal::ByteSwap::SetSimdLevel(detected);
+}
+
+} // anonymous namespace
+
+TEST(TBufferFile, FastArrayByteSwap)
+{
+   const std::size_t n = 101;
+   std::vector<Short_t> shorts(n);
+   std::vector<Int_t> ints(n);
+   std::vector<Long64_t> longs(n);
+   std::vector<Float_t> floats(n);
+   std::vector<Double_t> doubles(n);
+   for (std::size_t i = 0; i < n; ++i) {
+      shorts[i] = 0x0102 * i - 1000;
+      ints[i] = 0x01020304 * i - 7;
+      longs[i] = 0x0102030405060708LL * i - 11;
+      floats[i] = 1.5f * i - 3.25f;
+      doubles[i] = 1e-3 * i * i - 42.;
+   }
+   CheckFastArray(shorts);
+   CheckFastArray(ints);
+   CheckFastArray(longs);
+   CheckFastArray(floats);
+   CheckFastArray(doubles);
+
+   // Big-endian on disk
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteFastArray(ints.data() + 1, 1);
+   EXPECT_EQ(0, memcmp(buf.Buffer(), "\x01\x02\x02\xFD", 4));
+}
+
+TEST(TBufferFile, FastArrayTruncated)
+{
+   const Int_t n = 37;
+   std::vector<Float_t> floats(n);
+   std::vector<Double_t> doubles(n);
+   for (Int_t i = 0; i < n; ++i) {
+      floats[i] = 2.75f * i - 50.f;
+      doubles[i] = 0.125 * i * i - 50.;
+   }
+   TStreamerBasicType rangeFloat("f", "[-50,100,16]", 0, TVirtualStreamerInfo::kFloat16, "Float16_t");
+   TStreamerBasicType rangeDouble("d", "[-50,150,20]", 0, TVirtualStreamerInfo::kDouble32, "Double32_t");
+   TStreamerBasicType nbitsDouble("d", "[0,0,14]", 0, TVirtualStreamerInfo::kDouble32, "Double32_t");
+
+   TBufferFile buf(TBuffer::kWrite);
+   buf << (Char_t)0;
+   buf.WriteFastArrayFloat16(floats.data(), n, &rangeFloat);
+   buf.WriteFastArrayFloat16(floats.data(), n, nullptr);
+   buf.WriteFastArrayDouble32(doubles.data(), n, &rangeDouble);
+   buf.WriteFastArrayDouble32(doubles.data(), n, &nbitsDouble);
+   buf.WriteFastArrayDouble32(doubles.data(), n, nullptr);
+   const auto length = buf.Length();
+
+   buf.SetReadMode();
+   buf.SetBufferOffset(1);
+   std::vector<Float_t> f(n);
+   std::vector<Double_t> d(n);
+   buf.ReadFastArrayFloat16(f.data(), n, &rangeFloat);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_NEAR(floats[i], f[i], 150. / (1 << 16));
+   buf.ReadFastArrayFloat16(f.data(), n, nullptr);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_NEAR(floats[i], f[i], std::abs(floats[i]) / (1 << 12));
+   buf.ReadFastArrayDouble32(d.data(), n, &rangeDouble);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_NEAR(doubles[i], d[i], 200. / (1 << 20));
+   buf.ReadFastArrayDouble32(d.data(), n, &nbitsDouble);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_NEAR(doubles[i], d[i], std::abs(doubles[i]) / (1 << 14));
+   buf.ReadFastArrayDouble32(d.data(), n, nullptr);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(static_cast<Float_t>(doubles[i]), d[i]);
+   EXPECT_EQ(length, buf.Length());
+}
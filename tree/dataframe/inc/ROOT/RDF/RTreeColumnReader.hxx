@@ -14,17 +14,68 @@
 #include "RColumnReaderBase.hxx"
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+#include <TDataType.h>
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+class TBranch;
+class TBufferFile;
+class TTree;
 
 namespace ROOT {
 namespace Internal {
 namespace RDF {
 
+/// Reads the baskets of a variable-length array branch of arithmetic type in bulk, see TBranch::GetBulkEntries().
+///
+/// The array elements of all the entries of a basket are deserialized in place in a single pass and handed out as
+/// views into the basket buffer, without going through the leaf buffers.  Bulk reading requires the branch and its
+/// count branch to have baskets that start at the same entries, e.g. for trees written with
+/// TTree::kOnlyFlushAtCluster, and baskets that were written to a file.  Only counted arrays, i.e. C-style arrays and
+/// the data members of split collections, are read in bulk: unsplit collections such as `std::vector<float>` store
+/// every entry with its own header.  Entries that cannot be read in bulk are left to the TTreeReaderArray.
+class RTreeBulkArrayReader {
+   TTreeReader *fTreeReader;
+   std::string fBranchName;
+   EDataType fType;
+   std::size_t fTypeSize;
+   /// The tree in which the branch was last looked up
+   TTree *fTree = nullptr;
+   Int_t fTreeNumber = -1;
+   /// Set to nullptr if the branch in fTree cannot be read in bulk
+   TBranch *fBranch = nullptr;
+   TBranch *fCountBranch = nullptr;
+   Int_t fLenStatic = 1;
+   std::unique_ptr<TBufferFile> fValueBuffer;
+   std::unique_ptr<TBufferFile> fCountBuffer;
+   /// The range of tree entries available in fValueBuffer
+   Long64_t fFirstEntry = -1;
+   Long64_t fNEntries = 0;
+   /// Points into fValueBuffer to the first element of the first entry
+   char *fValues = nullptr;
+   /// For every entry in the buffer, the index of its first element; the last element is the total number of elements
+   std::vector<std::size_t> fOffsets;
+
+   void Connect(TTree *tree, Int_t treeNumber);
+   bool LoadBasket(Long64_t entry);
+
+public:
+   RTreeBulkArrayReader(TTreeReader &r, const std::string &branchName, EDataType type, std::size_t typeSize);
+   ~RTreeBulkArrayReader();
+
+   /// Sets data and size to the array of the current entry of the tree reader.  Returns false if the entry cannot be
+   /// read in bulk.
+   bool GetArray(void *&data, std::size_t &size);
+};
+
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderValues
 template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
@@ -70,11 +121,28 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
    /// Whether we already printed a warning about performing a copy of the TTreeReaderArray contents
    bool fCopyWarningPrinted = false;
 
+   /// Set for arrays of arithmetic types, which can be read one basket at a time
+   std::unique_ptr<RTreeBulkArrayReader> fBulkReader;
+
    void *GetImpl(Long64_t entry) final
    {
       if (entry == fLastEntry)
          return &fRVec; // we already pointed our fRVec to the right address
 
+      void *bulkData = nullptr;
+      std::size_t bulkSize = 0;
+      if (fBulkReader && fBulkReader->GetArray(bulkData, bulkSize)) {
+         if (bulkSize > 0) {
+            RVec<T> rvec(static_cast<T *>(bulkData), bulkSize);
+            swap(fRVec, rvec);
+         } else {
+            RVec<T> emptyVec{};
+            swap(fRVec, emptyVec);
+         }
+         fLastEntry = entry;
+         return &fRVec;
+      }
+
       auto &readerArray = *fTreeArray;
       // We only use TTreeReaderArrays to read columns that users flagged as type `RVec`, so we need to check
       // that the branch stores the array as contiguous memory that we can actually wrap in an `RVec`.
@@ -134,6 +202,11 @@ public:
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
       : fTreeArray(std::make_unique<TTreeReaderArray<T>>(r, colName.c_str()))
    {
+      if (std::is_arithmetic<T>::value) {
+         const auto type = TDataType::GetType(typeid(T));
+         if (type != kOther_t && type != kNoType_t)
+            fBulkReader = std::make_unique<RTreeBulkArrayReader>(r, colName, type, sizeof(T));
+      }
    }
 
    /// See the other class template specializations for an explanation.
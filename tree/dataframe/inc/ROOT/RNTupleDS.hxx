@@ -23,6 +23,7 @@
 #include <string_view>
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -55,6 +56,16 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
       ULong64_t fFirstEntry = 0; ///< First entry index in fSource
       /// End entry index in fSource, e.g. the number of entries in the range is fLastEntry - fFirstEntry
       ULong64_t fLastEntry = 0;
+      /// The number of entries in the files of the chain before the one of fSource. Used to translate the entry
+      /// numbers of the source into the entry numbers of the event loop.
+      ULong64_t fEntryOffset = 0;
+   };
+
+   /// A promise that only the entries with field values in [fMin, fMax] are of interest, see AddRangePredicate()
+   struct RRangePredicate {
+      std::string fFieldName;
+      double fMin = 0;
+      double fMax = 0;
    };
 
    /// The first source is used to extract the schema and build the prototype fields. The page source
@@ -85,13 +96,17 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<std::vector<Internal::RNTupleColumnReader *>> fActiveColumnReaders;
 
    unsigned int fNSlots = 0;
-   ULong64_t fSeenEntries = 0;                ///< The number of entries so far returned by GetEntryRanges()
+   ULong64_t fSeenEntries = 0;                ///< The number of entries in the files opened so far
    std::vector<REntryRangeDS> fCurrentRanges; ///< Basis for the ranges returned by the last GetEntryRanges() call
    std::vector<REntryRangeDS> fNextRanges;    ///< Basis for the ranges populated by the PrepareNextRanges() call
    /// Maps the first entries from the ranges of the last GetEntryRanges() call to their corresponding index in
    /// the fCurrentRanges vectors.  This is necessary because the returned ranges get distributed arbitrarily
    /// onto slots.  In the InitSlot method, the column readers use this map to find the correct range to connect to.
    std::unordered_map<ULong64_t, std::size_t> fFirstEntry2RangeIdx;
+   std::vector<RRangePredicate> fRangePredicates;
+   /// With range predicates, the ranges of the opened files are replaced by the runs of clusters that can match the
+   /// predicates.  Of these ranges, PrepareNextRanges() moves up to fNSlots at a time to fNextRanges.
+   std::deque<REntryRangeDS> fPendingRanges;
 
    /// \brief Holds useful information about fields added to the RNTupleDS
    struct RFieldInfo {
@@ -118,12 +133,25 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    /// Upon return, the fNextRanges list is ordered.  It has usually fNSlots elements; fewer if there
    /// is not enough work to give at least one cluster to every slot.
    void PrepareNextRanges();
+   /// Populates fNextRanges with the entry ranges of the next files, irrespective of range predicates
+   void PrepareNextFileRanges();
+   /// Appends to fPendingRanges the runs of clusters of the given range that can match the range predicates.
+   /// Every resulting range has its own clone of the page source, restricted to the range's entries.
+   void SplitByRangePredicates(REntryRangeDS range);
 
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
    RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames);
    ~RNTupleDS();
 
+   /// Restricts the event loop to the clusters that can contain values of the given field within [min, max],
+   /// according to the value statistics stored in the RNTuple (see RNTupleWriteOptions::SetEnableValueStatistics()).
+   /// The other clusters are neither read nor decompressed.  For a collection field, the range applies to the
+   /// collection size.  The selected clusters can still contain entries with values outside the range, so that a
+   /// corresponding Filter() is still required.  Several predicates are combined by logical and.  Must be called
+   /// before the event loop starts.
+   void AddRangePredicate(std::string_view fieldName, double min, double max);
+
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
    bool HasColumn(std::string_view colName) const final;
@@ -15,6 +15,7 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RNTuple.hxx>
@@ -26,6 +27,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <string>
@@ -422,9 +424,108 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+void RNTupleDS::AddRangePredicate(std::string_view fieldName, double min, double max)
+{
+   if (fPrincipalDescriptor->FindFieldId(fieldName) == kInvalidDescriptorId)
+      throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' for the range predicate"));
+   fRangePredicates.push_back({std::string(fieldName), min, max});
+}
+
 void RNTupleDS::PrepareNextRanges()
 {
    assert(fNextRanges.empty());
+   if (fRangePredicates.empty()) {
+      PrepareNextFileRanges();
+      return;
+   }
+
+   while (fPendingRanges.empty()) {
+      PrepareNextFileRanges();
+      if (fNextRanges.empty())
+         return;
+      for (auto &range : fNextRanges)
+         SplitByRangePredicates(std::move(range));
+      fNextRanges.clear();
+   }
+   while (!fPendingRanges.empty() && (fNextRanges.size() < fNSlots)) {
+      fNextRanges.emplace_back(std::move(fPendingRanges.front()));
+      fPendingRanges.pop_front();
+   }
+}
+
+void RNTupleDS::SplitByRangePredicates(REntryRangeDS range)
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> clusterRuns;
+   {
+      auto descriptorGuard = range.fSource->GetSharedDescriptorGuard();
+
+      // The intersection of the candidate entry ranges of all the predicates
+      std::vector<std::pair<NTupleSize_t, NTupleSize_t>> candidates{{range.fFirstEntry, range.fLastEntry}};
+      for (const auto &predicate : fRangePredicates) {
+         const auto fieldId = descriptorGuard->FindFieldId(predicate.fFieldName);
+         if (fieldId == kInvalidDescriptorId)
+            continue;
+         const auto selected = descriptorGuard->FindCandidateEntryRanges(fieldId, predicate.fMin, predicate.fMax);
+         std::vector<std::pair<NTupleSize_t, NTupleSize_t>> intersection;
+         auto itrB = selected.cbegin();
+         for (auto itrA = candidates.cbegin();
+              (itrA != candidates.cend()) && (itrB != selected.cend());) {
+            const auto first = std::max(itrA->first, itrB->first);
+            const auto last = std::min(itrA->second, itrB->second);
+            if (first < last)
+               intersection.emplace_back(first, last);
+            if (itrA->second < itrB->second) {
+               ++itrA;
+            } else {
+               ++itrB;
+            }
+         }
+         std::swap(candidates, intersection);
+      }
+
+      // Clusters are processed or skipped as a whole so that the ranges, which use different page sources,
+      // do not read the same clusters
+      for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+         const auto first = std::max<ULong64_t>(clusterDesc.GetFirstEntryIndex(), range.fFirstEntry);
+         const auto last =
+            std::min<ULong64_t>(clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries(), range.fLastEntry);
+         if (first >= last)
+            continue;
+         const bool isCandidate = std::any_of(candidates.begin(), candidates.end(),
+                                              [&](const auto &c) { return (c.first < last) && (c.second > first); });
+         if (isCandidate)
+            clusterRuns.emplace_back(first, last);
+      }
+   }
+
+   std::sort(clusterRuns.begin(), clusterRuns.end());
+   std::vector<std::pair<ULong64_t, ULong64_t>> merged;
+   for (const auto &run : clusterRuns) {
+      if (!merged.empty() && (merged.back().second == run.first)) {
+         merged.back().second = run.second;
+      } else {
+         merged.emplace_back(run);
+      }
+   }
+
+   for (std::size_t i = 0; i < merged.size(); ++i) {
+      REntryRangeDS subRange;
+      // The last range takes the already opened page source. All previous ranges clone.
+      if (i == merged.size() - 1) {
+         subRange.fSource = std::move(range.fSource);
+      } else {
+         subRange.fSource = range.fSource->CloneAttached();
+      }
+      subRange.fSource->SetEntryRange({merged[i].first, merged[i].second - merged[i].first});
+      subRange.fFirstEntry = merged[i].first;
+      subRange.fLastEntry = merged[i].second;
+      subRange.fEntryOffset = range.fEntryOffset;
+      fPendingRanges.emplace_back(std::move(subRange));
+   }
+}
+
+void RNTupleDS::PrepareNextFileRanges()
+{
    auto nFiles = fFileNames.empty() ? 1 : fFileNames.size();
    auto nRemainingFiles = nFiles - fNextFileIndex;
    if (nRemainingFiles == 0)
@@ -450,6 +551,8 @@ void RNTupleDS::PrepareNextRanges()
             continue;
 
          range.fLastEntry = nEntries; // whole file per slot, i.e. entry range [0..nEntries - 1]
+         range.fEntryOffset = fSeenEntries;
+         fSeenEntries += nEntries;
          fNextRanges.emplace_back(std::move(range));
       }
       return;
@@ -474,6 +577,8 @@ void RNTupleDS::PrepareNextRanges()
       auto nEntries = source->GetNEntries();
       if (nEntries == 0)
          continue;
+      const auto entryOffset = fSeenEntries;
+      fSeenEntries += nEntries;
 
       // If last file: use all remaining slots
       if (i == (nRemainingFiles - 1))
@@ -515,6 +620,7 @@ void RNTupleDS::PrepareNextRanges()
          range.fSource->SetEntryRange({start, end - start});
          range.fFirstEntry = start;
          range.fLastEntry = end;
+         range.fEntryOffset = entryOffset;
          fNextRanges.emplace_back(std::move(range));
       }
    } // loop over tail of remaining files
@@ -545,31 +651,21 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 
    // Create ranges for the RDF loop manager from the list of REntryRangeDS records.
    // The entry ranges that are relative to the page source in REntryRangeDS are translated into absolute
-   // entry ranges, given the current state of the entry cursor.
+   // entry ranges by the number of entries in the preceding files of the chain.
    // We remember the connection from first absolute entry index of a range to its REntryRangeDS record
    // so that we can properly rewire the column reader in InitSlot
    fFirstEntry2RangeIdx.clear();
-   ULong64_t nEntriesPerSource = 0;
    for (std::size_t i = 0; i < fCurrentRanges.size(); ++i) {
-      // Several consecutive ranges may operate on the same file (each with their own page source clone).
-      // We can detect a change of file when the first entry number jumps back to 0.
-      if (fCurrentRanges[i].fFirstEntry == 0) {
-         // New source
-         fSeenEntries += nEntriesPerSource;
-         nEntriesPerSource = 0;
-      }
-      auto start = fCurrentRanges[i].fFirstEntry + fSeenEntries;
-      auto end = fCurrentRanges[i].fLastEntry + fSeenEntries;
-      nEntriesPerSource += end - start;
+      auto start = fCurrentRanges[i].fFirstEntry + fCurrentRanges[i].fEntryOffset;
+      auto end = fCurrentRanges[i].fLastEntry + fCurrentRanges[i].fEntryOffset;
 
       fFirstEntry2RangeIdx[start] = i;
       ranges.emplace_back(start, end);
    }
-   fSeenEntries += nEntriesPerSource;
 
    if ((fNSlots == 1) && (fCurrentRanges[0].fSource)) {
       for (auto r : fActiveColumnReaders[0]) {
-         r->Connect(*fCurrentRanges[0].fSource, ranges[0].first);
+         r->Connect(*fCurrentRanges[0].fSource, fCurrentRanges[0].fEntryOffset);
       }
    }
 
@@ -583,7 +679,7 @@ void RNTupleDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
 
    auto idxRange = fFirstEntry2RangeIdx.at(firstEntry);
    for (auto r : fActiveColumnReaders[slot]) {
-      r->Connect(*fCurrentRanges[idxRange].fSource, firstEntry - fCurrentRanges[idxRange].fFirstEntry);
+      r->Connect(*fCurrentRanges[idxRange].fSource, fCurrentRanges[idxRange].fEntryOffset);
    }
 }
 
@@ -612,7 +708,9 @@ void RNTupleDS::Initialize()
 {
    fSeenEntries = 0;
    fNextFileIndex = 0;
-   if (!fCurrentRanges.empty() && (fFileNames.size() <= fNSlots)) {
+   fPendingRanges.clear();
+   // With range predicates, the ranges of the previous event loop may have been scheduled in several batches
+   if (!fCurrentRanges.empty() && (fFileNames.size() <= fNSlots) && fRangePredicates.empty()) {
       assert(fNextRanges.empty());
       std::swap(fCurrentRanges, fNextRanges);
       fNextFileIndex = std::max(fFileNames.size(), std::size_t(1));
@@ -0,0 +1,144 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RTreeColumnReader.hxx>
+
+#include <TBranch.h>
+#include <TBufferFile.h>
+#include <TClass.h>
+#include <TLeaf.h>
+#include <TMath.h>
+#include <TTree.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+/// Returns the index of the basket of the branch that starts at the given entry, or -1 if there is none
+Int_t FindBasketStartingAt(TBranch &branch, Long64_t entry)
+{
+   const auto basketEntry = branch.GetBasketEntry();
+   const auto basket = TMath::BinarySearch(branch.GetWriteBasket() + 1, basketEntry, entry);
+   return (basket >= 0 && basketEntry[basket] == entry) ? basket : -1;
+}
+
+/// Returns the entry after the last entry of the given basket
+Long64_t GetBasketEnd(TBranch &branch, Int_t basket)
+{
+   return (basket < branch.GetWriteBasket()) ? branch.GetBasketEntry()[basket + 1] : branch.GetEntries();
+}
+
+} // anonymous namespace
+
+ROOT::Internal::RDF::RTreeBulkArrayReader::RTreeBulkArrayReader(TTreeReader &r, const std::string &branchName,
+                                                                EDataType type, std::size_t typeSize)
+   : fTreeReader(&r),
+     fBranchName(branchName),
+     fType(type),
+     fTypeSize(typeSize),
+     fValueBuffer(std::make_unique<TBufferFile>(TBuffer::kWrite, 32 * 1024)),
+     fCountBuffer(std::make_unique<TBufferFile>(TBuffer::kWrite, 32 * 1024))
+{
+}
+
+ROOT::Internal::RDF::RTreeBulkArrayReader::~RTreeBulkArrayReader() = default;
+
+void ROOT::Internal::RDF::RTreeBulkArrayReader::Connect(TTree *tree, Int_t treeNumber)
+{
+   fTree = tree;
+   fTreeNumber = treeNumber;
+   fBranch = nullptr;
+   fCountBranch = nullptr;
+   fFirstEntry = -1;
+   fNEntries = 0;
+   if (!tree)
+      return;
+
+   // Branches of friend trees are left to the TTreeReaderArray, their entries are not aligned with the main tree
+   auto branch = tree->GetBranch(fBranchName.c_str());
+   if (!branch || branch->GetTree() != tree || !branch->GetBulkRead().SupportsBulkRead())
+      return;
+   auto leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->At(0));
+   auto countLeaf = leaf->GetLeafCount();
+   if (!countLeaf || countLeaf->GetBranch()->GetTree() != tree)
+      return;
+   TClass *expectedClass = nullptr;
+   EDataType expectedType = kOther_t;
+   if (branch->GetExpectedType(expectedClass, expectedType) || expectedClass || expectedType != fType ||
+       static_cast<std::size_t>(leaf->GetLenType()) != fTypeSize)
+      return;
+
+   fBranch = branch;
+   fCountBranch = countLeaf->GetBranch();
+   fLenStatic = leaf->GetLenStatic();
+}
+
+bool ROOT::Internal::RDF::RTreeBulkArrayReader::LoadBasket(Long64_t entry)
+{
+   fFirstEntry = -1;
+   fNEntries = 0;
+
+   // Only entire baskets can be read in bulk and the count branch needs to provide the counts of the same entries
+   const auto basket = FindBasketStartingAt(*fBranch, entry);
+   const auto countBasket = FindBasketStartingAt(*fCountBranch, entry);
+   if (basket < 0 || countBasket < 0 || GetBasketEnd(*fBranch, basket) != GetBasketEnd(*fCountBranch, countBasket))
+      return false;
+   // The size of the array data is only known for baskets written to the file, which excludes all the baskets of trees
+   // that are not attached to a file
+   if (!fBranch->GetBasketSeek(basket))
+      return false;
+
+   const auto nEntries = fBranch->GetBulkRead().GetBulkEntries(entry, *fValueBuffer, fCountBuffer.get());
+   if (nEntries < 0)
+      return false;
+
+   fOffsets.resize(nEntries + 1);
+   fOffsets[0] = 0;
+   const char *counts = fCountBuffer->GetCurrent();
+   for (Int_t i = 0; i < nEntries; ++i) {
+      Int_t count;
+      memcpy(&count, counts + i * sizeof(Int_t), sizeof(Int_t));
+      fOffsets[i + 1] = fOffsets[i] + static_cast<std::size_t>(count) * fLenStatic;
+   }
+
+   // The basket payload follows the key, so it is not necessarily aligned for the element type.  In that case, move
+   // the payload towards the beginning of the buffer, overwriting the key.
+   fValues = fValueBuffer->GetCurrent();
+   const auto misalignment = reinterpret_cast<std::uintptr_t>(fValues) % fTypeSize;
+   if (misalignment) {
+      memmove(fValues - misalignment, fValues, fOffsets[nEntries] * fTypeSize);
+      fValues -= misalignment;
+   }
+
+   fFirstEntry = entry;
+   fNEntries = nEntries;
+   return true;
+}
+
+bool ROOT::Internal::RDF::RTreeBulkArrayReader::GetArray(void *&data, std::size_t &size)
+{
+   auto readerTree = fTreeReader->GetTree();
+   if (!readerTree)
+      return false;
+   auto tree = readerTree->GetTree();
+   const auto treeNumber = readerTree->GetTreeNumber();
+   if (tree != fTree || treeNumber != fTreeNumber)
+      Connect(tree, treeNumber);
+   if (!fBranch)
+      return false;
+
+   const auto entry = tree->GetReadEntry();
+   if ((entry < fFirstEntry || entry >= fFirstEntry + fNEntries) && !LoadBasket(entry))
+      return false;
+
+   const auto idx = entry - fFirstEntry;
+   data = fValues + fOffsets[idx] * fTypeSize;
+   size = fOffsets[idx + 1] - fOffsets[idx];
+   return true;
+}
@@ -470,6 +470,110 @@ TEST_P(RDFSimpleTests, CArraysFromTree)
    EXPECT_EQ(20, h_jit->GetEntries());
 }
 
+TEST_P(RDFSimpleTests, CArraysBulkRead)
+{
+   auto filename = "dataframe_simple_carrays_bulk.root";
+   auto treename = "t";
+   const int nEvents = 1000;
+   double expectedSum = 0;
+   {
+      TFile f(filename, "RECREATE");
+      TTree t(treename, treename);
+      // Baskets of all branches start at cluster boundaries, which allows for bulk reading
+      t.SetBit(TTree::kOnlyFlushAtCluster);
+      t.SetAutoFlush(100);
+      int n;
+      float arr[5];
+      t.Branch("n", &n);
+      t.Branch("arr", arr, "arr[n]/F");
+      for (int i = 0; i < nEvents; ++i) {
+         n = i % 5;
+         for (int j = 0; j < n; ++j) {
+            arr[j] = i + j;
+            expectedSum += arr[j];
+         }
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   RDataFrame df(treename, filename);
+   auto check = [](int n, const RVec<float> &arr, ULong64_t entry) {
+      if (static_cast<int>(arr.size()) != n)
+         return false;
+      for (int j = 0; j < n; ++j) {
+         if (arr[j] != static_cast<float>(entry + j))
+            return false;
+      }
+      return true;
+   };
+   auto nGood = df.Filter(check, {"n", "arr", "rdfentry_"}).Count();
+   auto sum = df.Define("s", [](const RVec<float> &arr) { return Sum(arr, 0.); }, {"arr"}).Sum<double>("s");
+   EXPECT_EQ(static_cast<ULong64_t>(nEvents), *nGood);
+   EXPECT_DOUBLE_EQ(expectedSum, *sum);
+
+   if (!GetParam()) {
+      // Ranges are not supported in multi-thread runs; this one starts in the middle of a basket
+      RDataFrame dfRange(treename, filename);
+      auto nRange = dfRange.Range(150, 0).Filter(check, {"n", "arr", "rdfentry_"}).Count();
+      EXPECT_EQ(static_cast<ULong64_t>(nEvents - 150), *nRange);
+
+      // The arrays read in bulk are views into the basket buffer: within a basket, the arrays of consecutive entries
+      // are contiguous, whereas the TTreeReaderArray reuses the same leaf buffer for every entry
+      std::vector<const float *> data(nEvents);
+      std::vector<std::size_t> sizes(nEvents);
+      RDataFrame dfData(treename, filename);
+      dfData.Foreach(
+         [&](const RVec<float> &arr, ULong64_t entry) {
+            data[entry] = arr.data();
+            sizes[entry] = arr.size();
+         },
+         {"arr", "rdfentry_"});
+      int nContiguous = 0;
+      for (int i = 0; i + 1 < nEvents; ++i) {
+         if ((i + 1) % 100 == 0 || sizes[i] == 0 || sizes[i + 1] == 0)
+            continue;
+         EXPECT_EQ(data[i] + sizes[i], data[i + 1]);
+         ++nContiguous;
+      }
+      EXPECT_GT(nContiguous, 0);
+   }
+
+   gSystem->Unlink(filename);
+}
+
+TEST(RDFSimpleTests, CArraysBulkReadInMemory)
+{
+   // The baskets of a tree without a file are not read in bulk, the TTreeReaderArray reads them silently
+   TTree t("t", "t");
+   t.SetDirectory(nullptr);
+   t.SetBit(TTree::kOnlyFlushAtCluster);
+   t.SetAutoFlush(100);
+   int n;
+   float arr[5];
+   t.Branch("n", &n);
+   t.Branch("arr", arr, "arr[n]/F");
+   for (int i = 0; i < 1000; ++i) {
+      n = i % 5;
+      for (int j = 0; j < n; ++j)
+         arr[j] = i + j;
+      t.Fill();
+   }
+
+   RDataFrame df(t);
+   auto check = [](int n, const RVec<float> &arr, ULong64_t entry) {
+      if (static_cast<int>(arr.size()) != n)
+         return false;
+      for (int j = 0; j < n; ++j) {
+         if (arr[j] != static_cast<float>(entry + j))
+            return false;
+      }
+      return true;
+   };
+   auto nGood = df.Filter(check, {"n", "arr", "rdfentry_"}).Count();
+   ROOT_EXPECT_NODIAG(EXPECT_EQ(1000u, *nGood));
+}
+
 TEST_P(RDFSimpleTests, TakeCarrays)
 {
    auto treeName = "t";
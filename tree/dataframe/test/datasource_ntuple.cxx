@@ -4,6 +4,7 @@
 
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RPageStorage.hxx>
 
 #include <NTupleStruct.hxx>
@@ -220,6 +221,52 @@ static void ChainTest(const std::string &name, const std::string &fname)
    EXPECT_FLOAT_EQ(6.0, sumElectronPt.GetValue());
 }
 
+static void RangePredicateTest()
+{
+   std::vector<std::string> fileNames{"RNTupleDS_test_range_predicate_1.root", "RNTupleDS_test_range_predicate_2.root"};
+   ROOT::Experimental::RNTupleWriteOptions options;
+   options.SetEnableValueStatistics(true);
+   int pt = 0;
+   for (const auto &fileName : fileNames) {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      // Three clusters of 10 entries per file
+      for (int i = 0; i < 30; ++i) {
+         *fldPt = pt++;
+         writer->Fill();
+         if ((i % 10) == 9)
+            writer->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>("ntuple", fileNames);
+   ds->AddRangePredicate("pt", 12, 13);
+   ds->AddRangePredicate("pt", 13, 45);
+   EXPECT_THROW(ds->AddRangePredicate("nonexistent", 0, 1), ROOT::Experimental::RException);
+   ROOT::RDataFrame df(std::move(ds));
+   // Only the second cluster of the first file can contain entries that pass both predicates
+   auto nProcessed = df.Count();
+   // The entry numbers are the ones of the full chain
+   auto nMismatch = df.Filter([](ULong64_t entry, float value) { return static_cast<float>(entry) != value; },
+                              {"rdfentry_", "pt"})
+                       .Count();
+   auto nSelected = df.Filter("pt >= 13 && pt <= 13").Count();
+   EXPECT_EQ(10u, nProcessed.GetValue());
+   EXPECT_EQ(0u, nMismatch.GetValue());
+   EXPECT_EQ(1u, nSelected.GetValue());
+   // Trigger the event loop again
+   EXPECT_EQ(7u, df.Filter("pt > 12").Count().GetValue());
+
+   for (const auto &fileName : fileNames)
+      std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, RangePredicate)
+{
+   RangePredicateTest();
+}
+
 TEST_F(RNTupleDSTest, Read)
 {
    ReadTest(fNtplName, fFileName);
@@ -249,6 +296,13 @@ TEST_F(RNTupleDSTest, ChainMT)
 
    ChainTest(fNtplName, fFileName);
 }
+
+TEST(RNTupleDS, RangePredicateMT)
+{
+   IMTRAII _;
+
+   RangePredicateTest();
+}
 #endif
 
 const static std::array<ROOT::RVec<std::array<ROOT::RVecI, 3>>, 3> arraysDatasetCol4El{
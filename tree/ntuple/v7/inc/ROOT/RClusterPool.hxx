@@ -17,8 +17,12 @@
 #define ROOT7_RClusterPool
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -50,6 +54,12 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+The number of clusters read in a single vector read (the cluster bunch size) is either fixed or adaptive.  In adaptive
+mode, the pool grows the bunch size when the consumer has to wait for clusters that were scheduled for preloading
+(latency-bound reading) and shrinks it when the access pattern is sparse or when the preloading is well ahead of
+the consumer.  The look-ahead window of two bunches is kept within a memory budget estimated from the compressed
+size of the requested columns.
 */
 // clang-format on
 class RClusterPool {
@@ -94,8 +104,15 @@ private:
    /// The number of clusters before the currently active cluster that should stay in the pool if present
    /// Reserved for later use.
    unsigned int fWindowPre = 0;
-   /// The number of clusters that are being read in a single vector read.
-   unsigned int fClusterBunchSize;
+   /// The number of clusters that are being read in a single vector read.  Only modified by the main thread but
+   /// can be read concurrently, e.g. by the metrics.
+   std::atomic<unsigned int> fClusterBunchSize;
+   /// If set, fClusterBunchSize is adjusted on every cluster switch in the range [1, fMaxClusterBunchSize]
+   bool fIsAdaptive = false;
+   /// Upper limit of fClusterBunchSize in adaptive mode
+   unsigned int fMaxClusterBunchSize;
+   /// Upper limit of the estimated compressed size of the look-ahead window (two bunches) in adaptive mode
+   std::size_t fMemoryBudget = 0;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
@@ -117,6 +134,40 @@ private:
    /// The communication channel between the I/O thread and the unzip thread
    std::deque<RUnzipItem> fUnzipQueue;
 
+   /// State of the feedback loop that adapts the cluster bunch size; only used by the main thread
+   struct RAdaptiveState {
+      /// The cluster requested in the last call to GetCluster()
+      DescriptorId_t fLastClusterId = kInvalidDescriptorId;
+      /// The cluster following fLastClusterId; a different next request indicates a non-linear access pattern
+      DescriptorId_t fExpectedClusterId = kInvalidDescriptorId;
+      /// Time of the last switch from one cluster to another
+      std::chrono::steady_clock::time_point fLastSwitch;
+      /// Time spent in GetCluster() waiting for clusters since the last switch
+      std::chrono::nanoseconds fWaitTime{0};
+      /// Moving average of the time spent by the consumer on a cluster, excluding the time waiting for I/O
+      double fAvgConsumeTimeNs = 0.0;
+      /// Moving average of the compressed size of the requested columns of a cluster
+      double fAvgClusterBytes = 0.0;
+      /// Number of cluster switches since the last bunch size change that did not need to wait for I/O
+      unsigned int fNCalmSwitches = 0;
+   };
+   RAdaptiveState fAdaptiveState;
+   /// Moving average of the wall time needed by the I/O thread to load a bunch of clusters
+   std::atomic<std::int64_t> fAvgBunchReadTimeNs{0};
+
+   /// Counters describing the behavior of the adaptive window, observed by the page source's metrics
+   RNTupleMetrics fMetrics;
+   struct RCounters {
+      RNTupleCalcPerf &fClusterBunchSize;
+      RNTupleAtomicCounter &fNBunchSizeGrow;
+      RNTupleAtomicCounter &fNBunchSizeShrink;
+      RNTupleAtomicCounter &fNClusterStall;
+      RNTupleAtomicCounter &fNClusterExpired;
+      RNTupleAtomicCounter &fTimeWallBunchRead;
+      RNTupleAtomicCounter &fTimeWallWait;
+   };
+   std::unique_ptr<RCounters> fCounters;
+
    /// The I/O thread calls RPageSource::LoadClusters() asynchronously.  The thread is mostly waiting for the
    /// data to arrive (blocked by the kernel) and therefore can safely run in addition to the application
    /// main threads.
@@ -140,11 +191,19 @@ private:
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns);
+   /// Called by GetCluster() on a switch to a new cluster in adaptive mode.  Updates the moving averages and
+   /// determines the bunch size for the next round of preloading.  `clusterBytes` is the compressed size of the
+   /// requested columns in the new cluster, `isStalled` indicates that the cluster was already scheduled for
+   /// preloading but did not yet arrive.
+   void AdaptClusterBunchSize(DescriptorId_t clusterId, DescriptorId_t nextClusterId, std::uint64_t clusterBytes,
+                              bool isStalled);
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
    RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
+   /// Uses the cluster bunch size settings of the read options, including the adaptive bunch size parameters
+   RClusterPool(RPageSource &pageSource, const RNTupleReadOptions &options);
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
    ~RClusterPool();
@@ -159,6 +218,11 @@ public:
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+
+   /// The current number of clusters per vector read; constant unless the pool operates in adaptive mode
+   unsigned int GetClusterBunchSize() const { return fClusterBunchSize.load(); }
+   bool IsAdaptive() const { return fIsAdaptive; }
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
 }; // class RClusterPool
 
 } // namespace Detail
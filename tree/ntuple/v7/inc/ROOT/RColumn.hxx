@@ -104,7 +104,7 @@ public:
    static std::unique_ptr<RColumn> Create(const RColumnModel &model, std::uint32_t index)
    {
       auto column = std::unique_ptr<RColumn>(new RColumn(model, index));
-      column->fElement = RColumnElementBase::Generate<CppT>(model.GetType());
+      column->fElement = RColumnElementBase::Generate<CppT>(model);
       return column;
    }
 
@@ -25,10 +25,14 @@
 #include <Byteswap.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstddef> // for std::byte
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
@@ -43,6 +47,73 @@
 #endif
 #endif /* R__LITTLE_ENDIAN */
 
+namespace ROOT {
+namespace Experimental {
+namespace Internal {
+
+/// Packs the `nBits` least significant bits of `count` elements of `source` into a contiguous, little-endian bit
+/// stream in `destination`, which needs to provide space for (count * nBits + 7) / 8 bytes.  Used for column types
+/// with a configurable number of bits on storage.  Requires 1 <= nBits <= 32.
+void PackBits(void *destination, const std::uint32_t *source, std::size_t count, std::size_t nBits);
+/// Reverse of PackBits(): unpacks `count` elements of `nBits` bits each into `destination`.
+void UnpackBits(std::uint32_t *destination, const void *source, std::size_t count, std::size_t nBits);
+
+/// The instruction set extensions used by the vectorized unpacking kernels below.  On x86-64, the available level is
+/// detected at runtime; on 64bit ARM, NEON is always available.
+enum class ESimdLevel { kScalar, kSSE41, kAVX2, kNEON };
+/// The best kernel variant supported by the CPU
+ESimdLevel GetDetectedSimdLevel();
+/// The kernel variant currently in use, by default the detected level
+ESimdLevel GetSimdLevel();
+/// Selects a different kernel variant, e.g. the scalar one for testing and benchmarking.  Throws if the CPU does not
+/// support the given level.  Not thread-safe with respect to concurrent unpacking.
+void SetSimdLevel(ESimdLevel level);
+std::string GetSimdLevelName(ESimdLevel level);
+
+/// Reverse of split encoding: rearranges the `count` elements of `elementSize` bytes from the split representation
+/// (all first bytes, then all second bytes, etc.) in `source` into consecutive elements in `destination`.
+/// No byte swapping takes place.  Vectorized for element sizes 2, 4, and 8.
+void UnsplitBytes(void *destination, const void *source, std::size_t count, std::size_t elementSize);
+/// Unpacks the bit field `source` into `count` bools, with the least significant bit of the first byte being the
+/// first element.  Vectorized.
+void UnpackBitsToBool(bool *destination, const void *source, std::size_t count);
+
+/// Computes the value statistics of `count` in-memory values.  Returns false for types that have no statistics.
+/// The range of 64bit integers is widened where the values cannot be represented exactly as double.
+template <typename T>
+bool ComputeValueStatistics(const T *values, std::size_t count, RValueStatistics &statistics)
+{
+   if constexpr (!std::is_arithmetic_v<T>) {
+      return false;
+   } else {
+      statistics = RValueStatistics();
+      if (count == 0)
+         return true;
+      if constexpr (std::is_floating_point_v<T>) {
+         // Comparisons with NaN are false, so NaNs do not contribute
+         for (std::size_t i = 0; i < count; ++i) {
+            if (values[i] < statistics.fMin)
+               statistics.fMin = values[i];
+            if (values[i] > statistics.fMax)
+               statistics.fMax = values[i];
+         }
+      } else {
+         const auto [minIt, maxIt] = std::minmax_element(values, values + count);
+         statistics.fMin = static_cast<double>(*minIt);
+         statistics.fMax = static_cast<double>(*maxIt);
+         if constexpr (std::numeric_limits<T>::digits > std::numeric_limits<double>::digits) {
+            statistics.fMin = std::nextafter(statistics.fMin, -std::numeric_limits<double>::infinity());
+            statistics.fMax = std::nextafter(statistics.fMax, std::numeric_limits<double>::infinity());
+         }
+      }
+      return true;
+   }
+}
+
+} // namespace Internal
+} // namespace Experimental
+} // namespace ROOT
+
 namespace {
 
 // In this namespace, common routines are defined for element packing and unpacking of ints and floats.
@@ -64,6 +135,7 @@ namespace {
 // Encodings/conversions can be fused:
 //
 //  - Delta/Zigzag + Splitting (there is no only-delta/zigzag encoding)
+//  - Delta + Zigzag + Splitting, for integers that change in small steps of either sign
 //  - (Delta/Zigzag + ) Splitting + Casting
 //  - Everything + Byteswap
 
@@ -146,12 +218,27 @@ static void CastSplitPack(void *destination, const void *source, std::size_t cou
    }
 }
 
+/// Whether a split column of SourceT elements can be unsplit directly into the memory of DestT elements, which allows
+/// for using the vectorized Internal::UnsplitBytes() kernel.  This is the case on little-endian architectures if the
+/// types are identical or integers of the same width.
+template <typename DestT, typename SourceT>
+constexpr bool CanUnsplitInPlace()
+{
+   return (R__LITTLE_ENDIAN == 1) && (sizeof(DestT) == sizeof(SourceT)) && (sizeof(SourceT) > 1) &&
+          (std::is_same_v<DestT, SourceT> || (std::is_integral_v<DestT> && std::is_integral_v<SourceT>));
+}
+
 /// \brief Reverse split encoding of elements
 ///
 /// Used to first unsplit a column, possibly storing elements in wider C++ types. Swaps bytes if necessary
 template <typename DestT, typename SourceT>
 static void CastSplitUnpack(void *destination, const void *source, std::size_t count)
 {
+   if constexpr (CanUnsplitInPlace<DestT, SourceT>()) {
+      ROOT::Experimental::Internal::UnsplitBytes(destination, source, count, sizeof(SourceT));
+      return;
+   }
+
    constexpr std::size_t N = sizeof(SourceT);
    auto dst = reinterpret_cast<DestT *>(destination);
    auto splitArray = reinterpret_cast<const char *>(source);
@@ -232,6 +319,18 @@ static void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
+
+   if constexpr (CanUnsplitInPlace<DestT, SourceT>()) {
+      ROOT::Experimental::Internal::UnsplitBytes(destination, source, count, N);
+      // Signed and unsigned integers of the same width may alias
+      auto unsplit = reinterpret_cast<USourceT *>(destination);
+      for (std::size_t i = 0; i < count; ++i) {
+         const USourceT val = unsplit[i];
+         dst[i] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
+      }
+      return;
+   }
+
    for (std::size_t i = 0; i < count; ++i) {
       USourceT val = 0;
       for (std::size_t b = 0; b < N; ++b) {
@@ -242,6 +341,58 @@ static void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    }
 }
 
+/// \brief Packing of columns with delta + zigzag + split encoding
+///
+/// Used for integer columns whose values are close to their predecessors, such as event numbers or time stamps.
+/// The differences to the previous element are taken in the (wrapping) unsigned on-disk type and zigzag-encoded,
+/// so that small negative differences result in small values, too. The first element of the page is stored as
+/// difference to zero.
+template <typename DestT, typename SourceT>
+static void CastDeltaZigzagSplitPack(void *destination, const void *source, std::size_t count)
+{
+   using UDestT = std::make_unsigned_t<DestT>;
+   using SDestT = std::make_signed_t<DestT>;
+   constexpr std::size_t kNBitsDestT = sizeof(DestT) * 8;
+   constexpr std::size_t N = sizeof(DestT);
+   auto src = reinterpret_cast<const SourceT *>(source);
+   auto splitArray = reinterpret_cast<char *>(destination);
+   UDestT prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      const auto current = static_cast<UDestT>(src[i]);
+      const auto delta = static_cast<SDestT>(static_cast<UDestT>(current - prev));
+      prev = current;
+      UDestT val =
+         static_cast<UDestT>(static_cast<UDestT>(delta) << 1) ^ static_cast<UDestT>(delta >> (kNBitsDestT - 1));
+      ByteSwapIfNecessary(val);
+      for (std::size_t b = 0; b < N; ++b) {
+         splitArray[b * count + i] = reinterpret_cast<char *>(&val)[b];
+      }
+   }
+}
+
+/// \brief Unsplit and unwind delta + zigzag encoding
+///
+/// Unsplit a column, reverse the zigzag encoding of the differences and sum them up
+template <typename DestT, typename SourceT>
+static void CastDeltaZigzagSplitUnpack(void *destination, const void *source, std::size_t count)
+{
+   using USourceT = std::make_unsigned_t<SourceT>;
+   constexpr std::size_t N = sizeof(SourceT);
+   auto splitArray = reinterpret_cast<const char *>(source);
+   auto dst = reinterpret_cast<DestT *>(destination);
+   USourceT prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      USourceT val = 0;
+      for (std::size_t b = 0; b < N; ++b) {
+         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
+      }
+      ByteSwapIfNecessary(val);
+      const auto delta = static_cast<USourceT>((val >> 1) ^ static_cast<USourceT>(0 - (val & 1)));
+      prev = static_cast<USourceT>(prev + delta);
+      dst[i] = static_cast<SourceT>(prev);
+   }
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -284,7 +435,15 @@ public:
    /// If CppT == void, use the default C++ type for the given column type
    template <typename CppT = void>
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
+   /// Applies the configurable bit width and the value range of the column model to the generated element
+   template <typename CppT = void>
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model);
    static std::size_t GetBitsOnStorage(EColumnType type);
+   /// Takes into account the bit width of column types with a configurable number of bits on storage
+   static std::size_t GetBitsOnStorage(const RColumnModel &model);
+   /// The minimum and maximum number of bits on storage; they are different only for column types with a
+   /// configurable bit width, such as kReal32Trunc and kReal32Quant.
+   static std::pair<std::uint16_t, std::uint16_t> GetValidBitRange(EColumnType type);
    static std::string GetTypeName(EColumnType type);
 
    /// Derived, typed classes tell whether the on-storage layout is bitwise identical to the memory layout
@@ -306,6 +465,30 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// Only column types with a configurable bit width accept a value different from the default
+   virtual void SetBitsOnStorage(std::size_t bitsOnStorage)
+   {
+      if (bitsOnStorage != fBitsOnStorage)
+         throw RException(R__FAIL("internal error: cannot change the number of bits on storage of this column type"));
+   }
+   /// Only quantized column types have a value range
+   virtual void SetValueRange(double /* min */, double /* max */)
+   {
+      throw RException(R__FAIL("internal error: this column type has no value range"));
+   }
+
+   /// Whether unpacking packed elements may not restore the original in-memory values, e.g. for floating point
+   /// columns of reduced precision.  The page value statistics of such columns are computed on the unpacked values.
+   virtual bool IsLossy() const { return false; }
+
+   /// Computes the statistics of `count` elements in memory representation, used for the page value statistics.
+   /// Returns false if the element type does not support statistics, e.g. for offset and switch columns.
+   virtual bool ComputeStatistics(const void * /* source */, std::size_t /* count */,
+                                  RValueStatistics & /* statistics */) const
+   {
+      return false;
+   }
+
    std::size_t GetSize() const { return fSize; }
    std::size_t GetBitsOnStorage() const { return fBitsOnStorage; }
    std::size_t GetPackedSize(std::size_t nElements = 1U) const { return (nElements * fBitsOnStorage + 7) / 8; }
@@ -357,6 +540,7 @@ public:
 
    void Pack(void *dst, void *src, std::size_t count) const final { CastPack<NarrowT, CppT>(dst, src, count); }
    void Unpack(void *dst, void *src, std::size_t count) const final { CastUnpack<CppT, NarrowT>(dst, src, count); }
+   bool IsLossy() const final { return std::is_floating_point_v<CppT> && sizeof(NarrowT) < sizeof(CppT); }
 }; // class RColumnElementCastLE
 
 /**
@@ -376,6 +560,7 @@ public:
 
    void Pack(void *dst, void *src, std::size_t count) const final { CastSplitPack<NarrowT, CppT>(dst, src, count); }
    void Unpack(void *dst, void *src, std::size_t count) const final { CastSplitUnpack<CppT, NarrowT>(dst, src, count); }
+   bool IsLossy() const final { return std::is_floating_point_v<CppT> && sizeof(NarrowT) < sizeof(CppT); }
 }; // class RColumnElementSplitLE
 
 /**
@@ -430,6 +615,32 @@ public:
    }
 }; // class RColumnElementZigzagSplitLE
 
+/**
+ * Base class for delta + zigzag + split columns (integer columns of slowly changing values) whose on-storage
+ * representation is little-endian. The implementation of `Pack` and `Unpack` takes care of splitting and,
+ * if necessary, byteswap. The NarrowT on-disk integer type can be smaller than the CppT source type.
+ */
+template <typename CppT, typename NarrowT>
+class RColumnElementDeltaZigzagSplitLE : public RColumnElementBase {
+protected:
+   explicit RColumnElementDeltaZigzagSplitLE(std::size_t size, std::size_t bitsOnStorage)
+      : RColumnElementBase(size, bitsOnStorage)
+   {
+   }
+
+public:
+   static constexpr bool kIsMappable = false;
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      CastDeltaZigzagSplitPack<NarrowT, CppT>(dst, src, count);
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      CastDeltaZigzagSplitUnpack<CppT, NarrowT>(dst, src, count);
+   }
+}; // class RColumnElementDeltaZigzagSplitLE
+
 ////////////////////////////////////////////////////////////////////////////////
 // Pairs of C++ type and column type, like float and EColumnType::kReal32
 ////////////////////////////////////////////////////////////////////////////////
@@ -614,6 +825,10 @@ public:
 
    void Pack(void *dst, void *src, std::size_t count) const final;
    void Unpack(void *dst, void *src, std::size_t count) const final;
+   bool ComputeStatistics(const void *source, std::size_t count, RValueStatistics &statistics) const final
+   {
+      return Internal::ComputeValueStatistics(static_cast<const bool *>(source), count, statistics);
+   }
 };
 
 template <>
@@ -624,6 +839,11 @@ public:
    static constexpr std::size_t kBitsOnStorage = 16;
    RColumnElement() : RColumnElementBase(kSize, kBitsOnStorage) {}
    bool IsMappable() const final { return kIsMappable; }
+   bool IsLossy() const final { return true; }
+   bool ComputeStatistics(const void *source, std::size_t count, RValueStatistics &statistics) const final
+   {
+      return Internal::ComputeValueStatistics(static_cast<const float *>(source), count, statistics);
+   }
 
    void Pack(void *dst, void *src, std::size_t count) const final
    {
@@ -648,13 +868,168 @@ public:
    }
 };
 
-#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)  \
-   static constexpr std::size_t kSize = sizeof(CppT);           \
-   static constexpr std::size_t kBitsOnStorage = BitsOnStorage; \
-   RColumnElement() : BaseT(kSize, kBitsOnStorage) {}           \
-   bool IsMappable() const final                                \
-   {                                                            \
-      return kIsMappable;                                       \
+/**
+ * Base class for lossy float columns with a configurable number of bits on storage.  The in-memory values are
+ * translated into unsigned integers of up to 32 bits by `ToStorage()` and back by `FromStorage()` of the derived class;
+ * these integers are then bit-packed.  The translation is done in chunks of a small, fixed number of elements such
+ * that the conversion loops and the bit packing operate on cache-resident buffers.
+ */
+template <typename CppT, typename DerivedT>
+class RColumnElementBitPacked : public RColumnElementBase {
+protected:
+   /// Multiple of 8 so that chunks start at byte boundaries in the packed bit stream
+   static constexpr std::size_t kChunkSize = 256;
+
+   explicit RColumnElementBitPacked(std::size_t size, std::size_t bitsOnStorage)
+      : RColumnElementBase(size, bitsOnStorage)
+   {
+   }
+
+public:
+   static constexpr bool kIsMappable = false;
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto values = reinterpret_cast<const CppT *>(src);
+      auto packed = reinterpret_cast<unsigned char *>(dst);
+      std::uint32_t buffer[kChunkSize];
+      for (std::size_t first = 0; first < count; first += kChunkSize) {
+         const auto n = std::min(kChunkSize, count - first);
+         static_cast<const DerivedT *>(this)->ToStorage(buffer, values + first, n);
+         Internal::PackBits(packed + first * fBitsOnStorage / 8, buffer, n, fBitsOnStorage);
+      }
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      auto values = reinterpret_cast<CppT *>(dst);
+      auto packed = reinterpret_cast<const unsigned char *>(src);
+      std::uint32_t buffer[kChunkSize];
+      for (std::size_t first = 0; first < count; first += kChunkSize) {
+         const auto n = std::min(kChunkSize, count - first);
+         Internal::UnpackBits(buffer, packed + first * fBitsOnStorage / 8, n, fBitsOnStorage);
+         static_cast<const DerivedT *>(this)->FromStorage(values + first, buffer, n);
+      }
+   }
+}; // class RColumnElementBitPacked
+
+/**
+ * IEEE-754 single precision floats whose mantissa is truncated such that sign, exponent, and the most significant
+ * mantissa bits fit into the configured number of bits on storage.  Double values are converted to float first.
+ */
+template <typename CppT>
+class RColumnElementTruncReal32 : public RColumnElementBitPacked<CppT, RColumnElementTruncReal32<CppT>> {
+   using Base_t = RColumnElementBitPacked<CppT, RColumnElementTruncReal32<CppT>>;
+   friend Base_t;
+
+   void ToStorage(std::uint32_t *dst, const CppT *src, std::size_t count) const
+   {
+      const auto shift = 32 - this->fBitsOnStorage;
+      for (std::size_t i = 0; i < count; ++i) {
+         const float value = static_cast<float>(src[i]);
+         std::uint32_t bits;
+         std::memcpy(&bits, &value, sizeof(bits));
+         dst[i] = bits >> shift;
+      }
+   }
+   void FromStorage(CppT *dst, const std::uint32_t *src, std::size_t count) const
+   {
+      const auto shift = 32 - this->fBitsOnStorage;
+      for (std::size_t i = 0; i < count; ++i) {
+         const std::uint32_t bits = src[i] << shift;
+         float value;
+         std::memcpy(&value, &bits, sizeof(value));
+         dst[i] = value;
+      }
+   }
+
+protected:
+   explicit RColumnElementTruncReal32(std::size_t size, std::size_t bitsOnStorage) : Base_t(size, bitsOnStorage) {}
+
+public:
+   bool IsLossy() const final { return this->fBitsOnStorage < 8 * sizeof(CppT); }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      const auto [minBits, maxBits] = RColumnElementBase::GetValidBitRange(EColumnType::kReal32Trunc);
+      if (bitsOnStorage < minBits || bitsOnStorage > maxBits) {
+         throw RException(R__FAIL("invalid number of bits for truncated floats: " + std::to_string(bitsOnStorage)));
+      }
+      this->fBitsOnStorage = bitsOnStorage;
+   }
+}; // class RColumnElementTruncReal32
+
+/**
+ * Floating point values of a fixed [min, max] range that are mapped to equidistant unsigned integers of the
+ * configured number of bits.  Values outside the range cannot be stored.
+ */
+template <typename CppT>
+class RColumnElementQuantReal32 : public RColumnElementBitPacked<CppT, RColumnElementQuantReal32<CppT>> {
+   using Base_t = RColumnElementBitPacked<CppT, RColumnElementQuantReal32<CppT>>;
+   friend Base_t;
+
+   std::optional<RColumnModel::ValueRange_t> fValueRange;
+
+   double GetMaxQuantized() const { return static_cast<double>((std::uint64_t(1) << this->fBitsOnStorage) - 1); }
+
+   void ToStorage(std::uint32_t *dst, const CppT *src, std::size_t count) const
+   {
+      if (!fValueRange)
+         throw RException(R__FAIL("internal error: value range of quantized column not set"));
+      const auto [min, max] = *fValueRange;
+      const double scale = GetMaxQuantized() / (max - min);
+      for (std::size_t i = 0; i < count; ++i) {
+         const double value = src[i];
+         if (R__unlikely(!(value >= min && value <= max))) {
+            throw RException(R__FAIL("value " + std::to_string(value) + " out of the range [" + std::to_string(min) +
+                                     ", " + std::to_string(max) + "] of the quantized column"));
+         }
+         dst[i] = static_cast<std::uint32_t>((value - min) * scale + 0.5);
+      }
+   }
+   void FromStorage(CppT *dst, const std::uint32_t *src, std::size_t count) const
+   {
+      if (!fValueRange)
+         throw RException(R__FAIL("internal error: value range of quantized column not set"));
+      const auto [min, max] = *fValueRange;
+      const double step = (max - min) / GetMaxQuantized();
+      for (std::size_t i = 0; i < count; ++i) {
+         dst[i] = static_cast<CppT>(min + src[i] * step);
+      }
+   }
+
+protected:
+   explicit RColumnElementQuantReal32(std::size_t size, std::size_t bitsOnStorage) : Base_t(size, bitsOnStorage) {}
+
+public:
+   bool IsLossy() const final { return true; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      const auto [minBits, maxBits] = RColumnElementBase::GetValidBitRange(EColumnType::kReal32Quant);
+      if (bitsOnStorage < minBits || bitsOnStorage > maxBits) {
+         throw RException(R__FAIL("invalid number of bits for quantized floats: " + std::to_string(bitsOnStorage)));
+      }
+      this->fBitsOnStorage = bitsOnStorage;
+   }
+   void SetValueRange(double min, double max) final
+   {
+      if (!(min < max) || !std::isfinite(min) || !std::isfinite(max)) {
+         throw RException(R__FAIL("invalid value range for quantized floats: [" + std::to_string(min) + ", " +
+                                  std::to_string(max) + "]"));
+      }
+      fValueRange = RColumnModel::ValueRange_t(min, max);
+   }
+}; // class RColumnElementQuantReal32
+
+#define __RCOLUMNELEMENT_SPEC_BODY(CppT, BaseT, BitsOnStorage)                                             \
+   static constexpr std::size_t kSize = sizeof(CppT);                                                      \
+   static constexpr std::size_t kBitsOnStorage = BitsOnStorage;                                            \
+   RColumnElement() : BaseT(kSize, kBitsOnStorage) {}                                                      \
+   bool IsMappable() const final                                                                           \
+   {                                                                                                       \
+      return kIsMappable;                                                                                  \
+   }                                                                                                       \
+   bool ComputeStatistics(const void *source, std::size_t count, RValueStatistics &statistics) const final \
+   {                                                                                                       \
+      return Internal::ComputeValueStatistics(static_cast<const CppT *>(source), count, statistics);       \
    }
 /// These macros are used to declare `RColumnElement` template specializations below.  Additional arguments can be used
 /// to forward template parameters to the base class, e.g.
@@ -709,6 +1084,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitInt32, 32, RColumnE
                             <std::int32_t, std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kSplitUInt32, 32, RColumnElementSplitLE,
                             <std::int32_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kDeltaSplitInt32, 32, RColumnElementDeltaZigzagSplitLE,
+                            <std::int32_t, std::int32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int32_t, EColumnType::kDeltaSplitUInt32, 32, RColumnElementDeltaZigzagSplitLE,
+                            <std::int32_t, std::uint32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kUInt32, 32, RColumnElementLE, <std::uint32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kInt32, 32, RColumnElementLE, <std::uint32_t>);
@@ -716,6 +1095,10 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitUInt32, 32, RColum
                             <std::uint32_t, std::uint32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kSplitInt32, 32, RColumnElementZigzagSplitLE,
                             <std::uint32_t, std::int32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kDeltaSplitUInt32, 32, RColumnElementDeltaZigzagSplitLE,
+                            <std::uint32_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint32_t, EColumnType::kDeltaSplitInt32, 32, RColumnElementDeltaZigzagSplitLE,
+                            <std::uint32_t, std::int32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kInt64, 64, RColumnElementLE, <std::int64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kUInt64, 64, RColumnElementLE, <std::int64_t>);
@@ -730,6 +1113,14 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kSplitInt32, 32, RColumnE
                             <std::int64_t, std::int32_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kSplitUInt32, 32, RColumnElementSplitLE,
                             <std::int64_t, std::uint32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kDeltaSplitInt64, 64, RColumnElementDeltaZigzagSplitLE,
+                            <std::int64_t, std::int64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kDeltaSplitUInt64, 64, RColumnElementDeltaZigzagSplitLE,
+                            <std::int64_t, std::uint64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kDeltaSplitInt32, 32, RColumnElementDeltaZigzagSplitLE,
+                            <std::int64_t, std::int32_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::int64_t, EColumnType::kDeltaSplitUInt32, 32, RColumnElementDeltaZigzagSplitLE,
+                            <std::int64_t, std::uint32_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kUInt64, 64, RColumnElementLE, <std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kInt64, 64, RColumnElementLE, <std::uint64_t>);
@@ -737,14 +1128,22 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitUInt64, 64, RColum
                             <std::uint64_t, std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitInt64, 64, RColumnElementZigzagSplitLE,
                             <std::uint64_t, std::int64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kDeltaSplitUInt64, 64, RColumnElementDeltaZigzagSplitLE,
+                            <std::uint64_t, std::uint64_t>);
+DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kDeltaSplitInt64, 64, RColumnElementDeltaZigzagSplitLE,
+                            <std::uint64_t, std::int64_t>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kReal32, 32, RColumnElementLE, <float>);
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <float, float>);
+DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kReal32Trunc, 32, RColumnElementTruncReal32, <float>);
+DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kReal32Quant, 32, RColumnElementQuantReal32, <float>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal64, 64, RColumnElementLE, <double>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal64, 64, RColumnElementSplitLE, <double, double>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal32, 32, RColumnElementCastLE, <double, float>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <double, float>);
+DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal32Trunc, 32, RColumnElementTruncReal32, <double>);
+DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal32Quant, 32, RColumnElementQuantReal32, <double>);
 
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex64, 64, RColumnElementLE, <std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex32, 32, RColumnElementCastLE,
@@ -785,6 +1184,12 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt16>>();
+   case EColumnType::kDeltaSplitInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kDeltaSplitInt64>>();
+   case EColumnType::kDeltaSplitUInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kDeltaSplitUInt64>>();
+   case EColumnType::kDeltaSplitInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kDeltaSplitInt32>>();
+   case EColumnType::kDeltaSplitUInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kDeltaSplitUInt32>>();
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Trunc>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -794,6 +1199,17 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
 template <>
 std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate<void>(EColumnType type);
 
+template <typename CppT>
+std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(const RColumnModel &model)
+{
+   auto element = Generate<CppT>(model.GetType());
+   if (model.GetBitsOnStorage() > 0)
+      element->SetBitsOnStorage(model.GetBitsOnStorage());
+   if (model.GetValueRange())
+      element->SetValueRange(model.GetValueRange()->first, model.GetValueRange()->second);
+   return element;
+}
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
@@ -18,7 +18,10 @@
 
 #include <string_view>
 
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -72,6 +75,16 @@ enum class EColumnType {
    kSplitUInt32,
    kSplitInt16,
    kSplitUInt16,
+   // integer columns of values close to their predecessor, e.g. event numbers or time stamps; pages are stored
+   // in delta + zigzag + split encoding
+   kDeltaSplitInt64,
+   kDeltaSplitUInt64,
+   kDeltaSplitInt32,
+   kDeltaSplitUInt32,
+   // lossy float columns: IEEE-754 single precision floats with a truncated mantissa, and floats quantized to
+   // integers of a fixed value range. The number of bits on storage is a property of the column (see RColumnModel).
+   kReal32Trunc,
+   kReal32Quant,
    kMax,
 };
 
@@ -80,12 +93,23 @@ enum class EColumnType {
 \class ROOT::Experimental::RColumnModel
 \ingroup NTuple
 \brief Holds the static meta-data of an RNTuple column
+
+Most column types have a fixed number of bits on storage. For the lossy float types kReal32Trunc and kReal32Quant,
+the number of bits is set per column; quantized columns additionally carry the value range that is mapped onto
+the available bits.
 */
 // clang-format on
 class RColumnModel {
+public:
+   using ValueRange_t = std::pair<double, double>;
+
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// For column types with a configurable on-disk width, the number of bits per element; zero otherwise
+   std::uint16_t fBitsOnStorage = 0;
+   /// The [min, max] range of quantized columns
+   std::optional<ValueRange_t> fValueRange;
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
@@ -97,9 +121,15 @@ public:
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   /// Returns zero if the column uses the fixed number of bits of its type
+   std::uint16_t GetBitsOnStorage() const { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::uint16_t bitsOnStorage) { fBitsOnStorage = bitsOnStorage; }
+   const std::optional<ValueRange_t> &GetValueRange() const { return fValueRange; }
+   void SetValueRange(double min, double max) { fValueRange = ValueRange_t(min, max); }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fBitsOnStorage == other.fBitsOnStorage) &&
+             (fValueRange == other.fValueRange);
    }
    bool operator!=(const RColumnModel &other) const { return !(other == *this); }
 };
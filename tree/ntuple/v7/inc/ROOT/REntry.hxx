@@ -41,9 +41,11 @@ that are associated to values are managed.
 */
 // clang-format on
 class REntry {
+   friend class RCollectionField;
    friend class RCollectionNTupleWriter;
    friend class RNTupleModel;
    friend class RNTupleReader;
+   friend class RNTupleReadContext;
    friend class RNTupleFillContext;
 
    /// The entry must be linked to a specific model (or one if its clones), identified by a model ID
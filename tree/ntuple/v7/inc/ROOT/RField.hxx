@@ -39,10 +39,12 @@
 #include <map>
 #include <memory>
 #include <new>
+#include <optional>
 #include <set>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 #include <utility>
@@ -374,6 +376,8 @@ protected:
    /// Points into the static vector GetColumnRepresentations().GetSerializationTypes() when SetColumnRepresentative
    /// is called.  Otherwise GetColumnRepresentative returns the default representation.
    const ColumnRepresentation_t *fColumnRepresentative = nullptr;
+   /// If set, overrides the compression settings of the write options for this field and its sub fields
+   std::optional<int> fCompression;
 
    /// Implementations in derived classes should return a static RColumnRepresentations object. The default
    /// implementation does not attach any columns to the field.
@@ -630,6 +634,12 @@ public:
    void SetColumnRepresentative(const ColumnRepresentation_t &representative);
    /// Whether or not an explicit column representative was set
    bool HasDefaultColumnRepresentative() const { return fColumnRepresentative == nullptr; }
+   /// Sets the compression settings of the pages of the field's columns and, unless they have their own settings,
+   /// of the columns of its sub fields.  Overrides the compression of the write options.  This can only be done
+   /// _before_ connecting the field to a page sink.
+   void SetCompression(int compression);
+   /// Returns the compression settings of the field or of its closest ancestor with explicit settings, if any
+   std::optional<int> GetCompression() const;
 
    /// Fields and their columns live in the void until connected to a physical page storage.  Only once connected, data
    /// can be read or written.  In order to find the field in the page storage, the field's on-disk ID has to be set.
@@ -1584,6 +1594,8 @@ public:
    using RFieldBase::CreateValue;
    size_t GetValueSize() const final { return sizeof(ClusterSize_t); }
    size_t GetAlignment() const final { return alignof(ClusterSize_t); }
+   /// Clones of the field, e.g. in the models of the fill contexts of a parallel writer, have their own writer
+   std::shared_ptr<RCollectionNTupleWriter> GetCollectionWriter() const { return fCollectionWriter; }
 };
 
 /// The generic field for `std::pair<T1, T2>` types
@@ -1852,10 +1864,19 @@ public:
 
 template <>
 class RField<float> : public RFieldBase {
+private:
+   /// For truncated and quantized column representations, the number of bits per value on storage
+   std::uint16_t fBitsOnStorage = 0;
+   /// For the quantized column representation, the range of representable values
+   std::optional<RColumnModel::ValueRange_t> fValueRange;
+
 protected:
    std::unique_ptr<RFieldBase> CloneImpl(std::string_view newName) const final
    {
-      return std::make_unique<RField>(newName);
+      auto clone = std::make_unique<RField>(newName);
+      clone->fBitsOnStorage = fBitsOnStorage;
+      clone->fValueRange = fValueRange;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1891,14 +1912,29 @@ public:
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
 
    void SetHalfPrecision();
+   /// Store values as single precision floats whose mantissa is truncated such that the value fits into nBits,
+   /// with 10 <= nBits <= 32. Sign and exponent are preserved, so the relative precision is 2^-(nBits - 9).
+   void SetTruncated(std::size_t nBits);
+   /// Store values of the range [min, max] as equidistant integers of nBits, with 1 <= nBits <= 32.  The absolute
+   /// precision is (max - min) / (2^nBits - 1).  Writing values outside the range throws an exception.
+   void SetQuantized(double min, double max, std::size_t nBits);
 };
 
 template <>
 class RField<double> : public RFieldBase {
+private:
+   /// For truncated and quantized column representations, the number of bits per value on storage
+   std::uint16_t fBitsOnStorage = 0;
+   /// For the quantized column representation, the range of representable values
+   std::optional<RColumnModel::ValueRange_t> fValueRange;
+
 protected:
    std::unique_ptr<RFieldBase> CloneImpl(std::string_view newName) const final
    {
-      return std::make_unique<RField>(newName);
+      auto clone = std::make_unique<RField>(newName);
+      clone->fBitsOnStorage = fBitsOnStorage;
+      clone->fValueRange = fValueRange;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1935,6 +1971,10 @@ public:
 
    // Set the column representation to 32 bit floating point and the type alias to Double32_t
    void SetDouble32();
+   /// Store values as single precision floats with truncated mantissa; see RField<float>::SetTruncated()
+   void SetTruncated(std::size_t nBits);
+   /// Store values of the range [min, max] as equidistant integers of nBits; see RField<float>::SetQuantized()
+   void SetQuantized(double min, double max, std::size_t nBits);
 };
 
 template <>
@@ -2351,7 +2391,21 @@ public:
 template <>
 class RField<std::string> : public RFieldBase {
 private:
+   /// The dictionary of the cluster that is currently read; loaded on demand
+   struct RReadDictionary {
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      /// Number of strings in the dictionary of the cluster
+      std::uint64_t fSize = 0;
+      /// Filled on the first lookup in the cluster
+      std::unordered_map<std::string, std::uint32_t> fCodes;
+      bool fHasCodes = false;
+   };
+
    ClusterSize_t fIndex;
+   /// Only used when writing dictionary-encoded strings: maps the strings of the current cluster to their codes
+   std::unordered_map<std::string, std::uint32_t> fWriteDictionary;
+   /// Only used when reading dictionary-encoded strings
+   RReadDictionary fReadDictionary;
 
    std::unique_ptr<RFieldBase> CloneImpl(std::string_view newName) const final
    {
@@ -2368,7 +2422,14 @@ private:
    std::size_t AppendImpl(const void *from) final;
    void ReadGlobalImpl(ROOT::Experimental::NTupleSize_t globalIndex, void *to) final;
 
-   void CommitClusterImpl() final { fIndex = 0; }
+   void CommitClusterImpl() final
+   {
+      fIndex = 0;
+      fWriteDictionary.clear();
+   }
+
+   /// Makes fReadDictionary refer to the given cluster
+   void SwitchReadDictionary(DescriptorId_t clusterId);
 
 public:
    static std::string TypeName() { return "std::string"; }
@@ -2384,6 +2445,24 @@ public:
    size_t GetValueSize() const final { return sizeof(std::string); }
    size_t GetAlignment() const final { return std::alignment_of<std::string>(); }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Dictionary-encoded strings are stored as a code per entry that refers to the dictionary of distinct strings of
+   /// the cluster, which is much smaller than the regular encoding for strings with few distinct values.
+   /// Once the field is connected to a page source or sink, refers to its columns; before, to the column representative.
+   bool IsDictionaryEncoded() const
+   {
+      return fColumns.empty() ? (GetColumnRepresentative().size() == 3) : (fColumns.size() == 3);
+   }
+   void SetDictionaryEncoded() { SetColumnRepresentative({EColumnType::kSplitUInt32, EColumnType::kSplitIndex64,
+                                                          EColumnType::kChar}); }
+
+   /// For dictionary-encoded strings, returns the position of the entry's string in the dictionary of its cluster.
+   /// Two entries of the same cluster have equal strings if and only if their dictionary indexes are equal.
+   RClusterIndex GetDictionaryIndex(NTupleSize_t globalIndex);
+   /// For dictionary-encoded strings, returns the position of the given string in the dictionary of the given
+   /// cluster or an invalid cluster index if no entry of the cluster has the given value.  Together with
+   /// GetDictionaryIndex(), this allows for equality comparisons without reading the strings of the entries.
+   RClusterIndex FindInDictionary(DescriptorId_t clusterId, std::string_view value);
 };
 
 template <typename ItemT, std::size_t N>
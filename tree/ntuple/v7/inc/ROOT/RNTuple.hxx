@@ -35,6 +35,7 @@
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -270,6 +271,26 @@ public:
    /// ~~~
    RNTupleGlobalRange GetEntryRange() { return RNTupleGlobalRange(0, GetNEntries()); }
 
+   /// Returns the entry ranges that can contain values of the given field within [min, max], based on the value
+   /// statistics stored for the pages and clusters (see RNTupleWriteOptions::SetEnableValueStatistics()).  For a
+   /// collection field, the range applies to the collection size.  Entries outside the returned ranges cannot match the
+   /// range predicate.  Clusters without selected entries are excluded from the read-ahead, so that they are neither
+   /// read nor decompressed.  Within the selected clusters, the pages of non-matching entries are unpacked only if
+   /// they are accessed, unless implicit multi-threading is enabled: then all the pages of a loaded cluster are
+   /// unpacked in the background.  The selection replaces the one of a previous call.
+   ///
+   /// **Example: process only the entries that can have a "pt" value above 30**
+   /// ~~~ {.cpp}
+   /// auto ntuple = RNTupleReader::Open("myNTuple", "some/file.root");
+   /// auto pt = ntuple->GetView<float>("pt");
+   /// for (const auto &range : ntuple->SelectEntryRanges("pt", 30, std::numeric_limits<double>::infinity())) {
+   ///    for (auto i : range) {
+   ///       if (pt(i) > 30) { ... }
+   ///    }
+   /// }
+   /// ~~~
+   std::vector<RNTupleGlobalRange> SelectEntryRanges(std::string_view fieldName, double min, double max);
+
    /// Provides access to an individual field that can contain either a scalar value or a collection, e.g.
    /// GetView<double>("particles.pt") or GetView<std::vector<double>>("particle").  It can as well be the index
    /// field of a collection itself, like GetView<NTupleSize_t>("particle").
@@ -415,6 +436,8 @@ public:
    void CommitCluster();
 
    std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   /// The context's own clone of the writer's model
+   const RNTupleModel &GetModel() const { return *fModel; }
 
    /// Return the entry number that was last committed in a cluster.
    NTupleSize_t GetLastCommitted() const { return fLastCommitted; }
@@ -561,6 +584,8 @@ public:
    }
 
    ClusterSize_t *GetOffsetPtr() { return &fOffset; }
+   /// Returns nullptr if the collection was created from a bare model
+   REntry *GetDefaultEntry() { return fDefaultEntry.get(); }
 };
 
 } // namespace Experimental
@@ -30,6 +30,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <vector>
 #include <set>
@@ -229,13 +230,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The value statistics of the column in the cluster, set if all the pages of the column range have statistics
+      std::optional<RValueStatistics> fStatistics;
 
       bool operator==(const RColumnRange &other) const {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStatistics == other.fStatistics;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -252,9 +253,11 @@ public:
          std::uint32_t fNElements = std::uint32_t(-1);
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// Optional value statistics of the page, see RNTupleWriteOptions::SetEnableValueStatistics()
+         std::optional<RValueStatistics> fStatistics;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fStatistics == other.fStatistics;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -784,6 +787,12 @@ public:
    DescriptorId_t FindClusterId(DescriptorId_t physicalColumnId, NTupleSize_t index) const;
    DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
    DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
+   /// Returns the sorted, disjoint entry ranges [first, last) that can contain values of the given field within
+   /// [min, max] according to the value statistics of the field's principal column.  For collection fields, the
+   /// predicate applies to the collection size.  Clusters and pages without statistics are always included.
+   /// The ranges have page granularity for fields outside collections and cluster granularity otherwise.
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>>
+   FindCandidateEntryRanges(DescriptorId_t fieldId, double min, double max) const;
 
    /// Walks up the parents of the field ID and returns a field name of the form a.b.c.d
    /// In case of invalid field ID, an empty string is returned.
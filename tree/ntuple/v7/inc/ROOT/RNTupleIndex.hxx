@@ -0,0 +1,116 @@
+/// \file ROOT/RNTupleIndex.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleIndex
+#define ROOT7_RNTupleIndex
+
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class TFile;
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleReader;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleIndex
+\ingroup NTuple
+\brief A sorted index that maps the values of one or two integer fields to entry numbers
+
+The index is the RNTuple counterpart of TTreeIndex.  It is built from a major and an optional minor field, e.g.
+(run, event), of integral type.  Lookups are binary searches over the sorted (major, minor) pairs.  If several entries
+share the same key, the lookup returns the smallest entry number.  Signed values are converted to std::uint64_t;
+the same conversion applies to the values passed to GetEntryNumber().
+
+The index can be built from any reader, including a reader created by RNTupleReader::OpenFriends(); in that case,
+the field names are qualified by the ntuple name, e.g. "ntpl1.run".  Conversely, an index over an ntuple that is not
+aligned with another one provides the entry numbers in that ntuple for the keys read from the other ntuple.
+
+The index can be stored in a TFile, typically next to the indexed ntuple.  It is stored as an additional RNTuple
+(anchor) with the fields "major", ["minor",] and "entry", whose descriptions record the names of the indexed fields.
+
+~~~ {.cpp}
+auto reader = RNTupleReader::Open("Events", "data.root");
+auto index = RNTupleIndex::Create(*reader, "run", "event");
+auto entry = index->GetEntryNumber(run, event);
+if (entry != kInvalidNTupleIndex)
+   reader->LoadEntry(entry);
+~~~
+*/
+// clang-format on
+class RNTupleIndex {
+private:
+   std::string fMajorFieldName;
+   /// Empty if the index is built from the major field only
+   std::string fMinorFieldName;
+   struct RIndexEntry {
+      std::uint64_t fMajor = 0;
+      /// Zero if the index is built from the major field only
+      std::uint64_t fMinor = 0;
+      NTupleSize_t fEntry = kInvalidNTupleIndex;
+   };
+   /// Sorted by (major, minor, entry)
+   std::vector<RIndexEntry> fIndexEntries;
+
+   RNTupleIndex(std::string_view majorFieldName, std::string_view minorFieldName)
+      : fMajorFieldName(majorFieldName), fMinorFieldName(minorFieldName)
+   {
+   }
+   static bool IsLess(const RIndexEntry &a, const RIndexEntry &b);
+   /// Sorts the index entries after they have been filled
+   void Sort();
+   /// Returns the first index entry whose key is not smaller than (major, minor)
+   std::vector<RIndexEntry>::const_iterator FindFirst(std::uint64_t major, std::uint64_t minor) const;
+
+public:
+   /// Builds the index from the given field(s) of all the entries of the reader.  The fields need to be of integral
+   /// type.  An empty minor field name creates an index on the major field only.
+   static std::unique_ptr<RNTupleIndex>
+   Create(RNTupleReader &reader, std::string_view majorFieldName, std::string_view minorFieldName = "");
+   /// Loads an index previously stored with Write()
+   static std::unique_ptr<RNTupleIndex> Open(std::string_view indexName, std::string_view storage);
+
+   RNTupleIndex(const RNTupleIndex &other) = delete;
+   RNTupleIndex &operator=(const RNTupleIndex &other) = delete;
+   RNTupleIndex(RNTupleIndex &&other) = default;
+   RNTupleIndex &operator=(RNTupleIndex &&other) = default;
+   ~RNTupleIndex() = default;
+
+   /// Stores the index as an RNTuple named indexName in the given, writable file
+   void Write(std::string_view indexName, TFile &file) const;
+
+   /// Returns the smallest entry number with the given key or kInvalidNTupleIndex if there is no such entry.
+   /// For an index without minor field, the minor value is ignored.
+   NTupleSize_t GetEntryNumber(std::uint64_t major, std::uint64_t minor = 0) const;
+   /// Returns all the entry numbers with the given key in ascending order
+   std::vector<NTupleSize_t> GetEntryNumbers(std::uint64_t major, std::uint64_t minor = 0) const;
+
+   const std::string &GetMajorFieldName() const { return fMajorFieldName; }
+   const std::string &GetMinorFieldName() const { return fMinorFieldName; }
+   bool HasMinorField() const { return !fMinorFieldName.empty(); }
+   /// The number of indexed entries
+   std::size_t GetSize() const { return fIndexEntries.size(); }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -25,16 +25,39 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ROOT {
 namespace Experimental {
 namespace Internal {
 
+/// Determines how the merger treats sources whose fields differ from the fields of the first source
+enum class ENTupleMergingMode {
+   /// All the sources must have the same fields as the first source
+   kStrict,
+   /// The output contains the union of the fields of all sources.  Fields missing in a source are filled with
+   /// default values for the entries of that source.
+   kUnion
+};
+
+struct RNTupleMergeOptions {
+   ENTupleMergingMode fMergingMode = ENTupleMergingMode::kStrict;
+};
+
 // clang-format off
 /**
  * \class ROOT::Experimental::RNTupleMerger
  * \ingroup NTuple
  * \brief Given a set of RPageSources merge them into an RPageSink
+ *
+ * The merger concatenates the clusters of the sources without unpacking the pages.  The sealed pages of a cluster
+ * are read in one go and committed verbatim to the destination.  Pages are only decompressed and compressed again if
+ * the compression settings of the source column range differ from the compression of the destination.  If implicit
+ * multi-threading is enabled, the sources are attached and the pages are recompressed in parallel.
+ *
+ * In union mode, fields that appear only in later sources are added to the destination by late model extension.
+ * Their deferred columns read back as default values for the entries of the earlier sources.  The columns of fields
+ * missing in a later source are filled with zero pages, which read back as default values as well.
  */
 // clang-format on
 class RNTupleMerger {
@@ -46,6 +69,12 @@ private:
       std::string fColumnTypeAndVersion; ///< "<type>.<version>" of the field to which the column belongs
       DescriptorId_t fColumnInputId;
       DescriptorId_t fColumnOutputId;
+      std::size_t fBitsOnStorage = 0;
+      /// Number of column elements per entry; zero for columns whose number of elements depends on the data, i.e.
+      /// columns that are not the principal column of their field or whose field is part of a collection or variant
+      std::uint64_t fNElementsPerEntry = 0;
+      /// Set for the principal columns of fields added by late model extension
+      bool fIsDeferred = false;
 
       RColumnInfo(const std::string &name, const std::string &typeAndVersion, const DescriptorId_t &inputId,
                   const DescriptorId_t &outputId)
@@ -54,6 +83,13 @@ private:
       }
    };
 
+   /// Sealed page of zeros, compressed with the compression of the destination
+   struct RZeroPage {
+      std::unique_ptr<unsigned char[]> fBuffer;
+      const void *fAddress = nullptr;
+      std::uint32_t fSize = 0;
+   };
+
    /// Build the internal column id map from the first source
    /// This is where we assign the output ids for the first source
    void BuildColumnIdMap(std::vector<RColumnInfo> &columns);
@@ -62,19 +98,50 @@ private:
    /// This is where we assign the output ids for the remaining sources
    void ValidateColumns(std::vector<RColumnInfo> &columns);
 
+   /// Assign the output ids of the columns in union mode.  Columns of the given new top-level fields are appended
+   /// to the internal map; all other columns must be known.
+   void MapColumns(std::vector<RColumnInfo> &columns, const std::unordered_set<std::string> &newFields);
+
    /// Recursively add columns from a given field
    void AddColumnsFromField(std::vector<RColumnInfo> &columns, const RNTupleDescriptor &desc,
-                            const RFieldDescriptor &fieldDesc, const std::string &prefix = "");
+                            const RFieldDescriptor &fieldDesc, const std::string &prefix = "",
+                            std::uint64_t nRepetitions = 1);
 
    /// Recursively collect all the columns for all the fields rooted at field zero
-   std::vector<RColumnInfo> CollectColumns(const Detail::RPageSource &source, bool firstSource);
+   std::vector<RColumnInfo> CollectColumns(const Detail::RPageSource &source, bool firstSource,
+                                           ENTupleMergingMode mergingMode,
+                                           const std::unordered_set<std::string> &newFields);
+
+   /// Add the top-level fields of the source that are unknown to the model to the model and to the destination.
+   /// Returns the names of the added fields.
+   static std::unordered_set<std::string>
+   ExtendModel(const Detail::RPageSource &source, RNTupleModel &model, Detail::RPageSink &destination,
+               NTupleSize_t firstEntry);
+
+   /// Returns a sealed page of zeros of the given packed size, compressed with the given compression
+   const RZeroPage &GetZeroPage(std::size_t bytesPacked, int compression);
+
+   /// Attach all the sources, concurrently if a task scheduler is given
+   static void AttachSources(std::span<Detail::RPageSource *> sources, Detail::RPageStorage::RTaskScheduler *scheduler);
+
+   /// Copy the pages of the given cluster of the source to the destination and commit the cluster.  Recompresses
+   /// the pages if the compression of a column range differs from the compression of the destination.
+   /// The output columns in missingColumns are filled with zero pages.
+   void MergeCluster(Detail::RPageSource &source, DescriptorId_t clusterId, const std::vector<RColumnInfo> &columns,
+                     const std::vector<DescriptorId_t> &missingColumns, Detail::RPageSink &destination,
+                     Detail::RPageStorage::RTaskScheduler *scheduler);
 
    // Internal map that holds column name, type, and type id : output ID information
    std::unordered_map<std::string, DescriptorId_t> fOutputIdMap;
+   /// The column information of the source that introduced the output column, indexed by the output column id
+   std::vector<RColumnInfo> fOutputColumns;
+   /// Zero pages by packed size
+   std::unordered_map<std::size_t, RZeroPage> fZeroPages;
 
 public:
    /// Merge a given set of sources into the destination
-   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination,
+              const RNTupleMergeOptions &options = RNTupleMergeOptions());
 
 }; // end of class RNTupleMerger
 
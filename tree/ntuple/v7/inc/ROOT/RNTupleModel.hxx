@@ -317,6 +317,11 @@ public:
 
    std::string GetDescription() const { return fDescription; }
    void SetDescription(std::string_view description);
+
+   /// Overrides the compression settings of the write options for the given (possibly nested) field and its sub
+   /// fields, see RFieldBase::SetCompression().  Throws an exception if the model is frozen or if there is no field
+   /// with the given name.
+   void SetFieldCompression(std::string_view fieldName, int compression);
 };
 
 } // namespace Experimental
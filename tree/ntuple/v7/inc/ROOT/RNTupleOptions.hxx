@@ -19,7 +19,10 @@
 #include <Compression.h>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -64,6 +67,29 @@ protected:
    /// If set, 64bit index columns are replaced by 32bit index columns. This limits the cluster size to 512MB
    /// but it can result in smaller file sizes for data sets with many collections and lz4 or no compression.
    bool fHasSmallClusters = false;
+   /// If set, the minimum and maximum value of every page of numeric and collection columns is stored in the page
+   /// list, which allows readers to skip pages and clusters that cannot match a range predicate.
+   bool fEnableValueStatistics = false;
+   /// Upper limit of the memory of released page buffers that the page allocator keeps for reuse by new pages.
+   /// Zero disables the recycling of page buffers.
+   std::size_t fMaxPooledPageMemory = 128 * 1024 * 1024;
+   /// With implicit multi-threading and buffered writes, the pages of a committed cluster are compressed in the
+   /// background while the next cluster is filled.  Committing a cluster blocks until all pages are written if more
+   /// than this number of committed clusters are still being compressed.  Zero makes cluster commits synchronous.
+   std::size_t fMaxInFlightClusters = 1;
+   /// If non-zero, a file page sink writes the sealed pages from a background I/O thread.  The thread works off a
+   /// queue of sealed page blobs of at most this many bytes; committing pages blocks while the queue is full.
+   /// Only applies to files created by the page sink, not to RNTuples appended to an existing TFile.
+   std::size_t fMaxAsyncWriteBytes = 0;
+   /// If set, the compression settings of every column without an explicit setting for its field (see
+   /// RFieldBase::SetCompression()) are selected by trial compression of the first page of the column.  The trial
+   /// compares no compression with the candidate settings.
+   bool fUseAutoCompression = false;
+   /// The compression settings tried in automatic mode, in addition to no compression
+   std::vector<int> fAutoCompressionCandidates{404, 505};
+   /// In automatic mode, only settings that compress the trial page at this many nanoseconds per uncompressed byte
+   /// or faster are selected
+   double fAutoCompressionCpuBudget = 20.;
 
 public:
    /// A maximum size of 512MB still allows for a vector of bool to be stored in a small cluster.  This is the
@@ -97,6 +123,27 @@ public:
 
    bool GetHasSmallClusters() const { return fHasSmallClusters; }
    void SetHasSmallClusters(bool val) { fHasSmallClusters = val; }
+
+   bool GetEnableValueStatistics() const { return fEnableValueStatistics; }
+   void SetEnableValueStatistics(bool val) { fEnableValueStatistics = val; }
+
+   std::size_t GetMaxPooledPageMemory() const { return fMaxPooledPageMemory; }
+   void SetMaxPooledPageMemory(std::size_t val) { fMaxPooledPageMemory = val; }
+
+   std::size_t GetMaxInFlightClusters() const { return fMaxInFlightClusters; }
+   void SetMaxInFlightClusters(std::size_t val) { fMaxInFlightClusters = val; }
+
+   std::size_t GetMaxAsyncWriteBytes() const { return fMaxAsyncWriteBytes; }
+   void SetMaxAsyncWriteBytes(std::size_t val) { fMaxAsyncWriteBytes = val; }
+
+   bool GetUseAutoCompression() const { return fUseAutoCompression; }
+   void SetUseAutoCompression(bool val) { fUseAutoCompression = val; }
+
+   const std::vector<int> &GetAutoCompressionCandidates() const { return fAutoCompressionCandidates; }
+   void SetAutoCompressionCandidates(const std::vector<int> &val) { fAutoCompressionCandidates = val; }
+
+   double GetAutoCompressionCpuBudget() const { return fAutoCompressionCpuBudget; }
+   void SetAutoCompressionCpuBudget(double val) { fAutoCompressionCpuBudget = val; }
 };
 
 // clang-format off
@@ -148,15 +195,65 @@ public:
       kDefault = kOn,
    };
 
+   /// Order in which pages are removed from the disk cache once it exceeds its size limit
+   enum class EDiskCacheEviction {
+      kLRU,  ///< Least recently read or written pages first
+      kFIFO, ///< Least recently written pages first
+   };
+
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// If set, the cluster pool starts with fClusterBunchSize clusters per vector read and then adapts the bunch size
+   /// to the observed read latency and consumption rate, between 1 and fMaxClusterBunchSize
+   bool fUseAdaptiveClusterBunchSize = false;
+   unsigned int fMaxClusterBunchSize = 16;
+   /// Limits the estimated compressed size of the clusters in the look-ahead window if the bunch size is adaptive.
+   /// The window comprises at least one cluster bunch of one cluster, even if that exceeds the budget.
+   std::size_t fClusterPoolMemoryBudget = 512 * 1024 * 1024;
+   /// If set and the file is local, uncompressed pages are served from a read-only memory mapping of the file instead
+   /// of being read into memory buffers.  Pages of columns whose in-memory layout matches the on-disk layout are
+   /// views into the mapping, i.e. they are neither copied nor allocated.
+   bool fUseMemoryMap = false;
+   /// Upper limit of the memory of released page buffers that the page allocator keeps for reuse by new pages.
+   /// Zero disables the recycling of page buffers.
+   std::size_t fMaxPooledPageMemory = 128 * 1024 * 1024;
+   /// If set, unsealed pages are taken from and added to the process-wide Internal::RSharedPageCache, so that all
+   /// page sources with this option reading the same ntuple share the I/O and decompression of the pages.
+   /// The cache's memory budget is set through Internal::RSharedPageCache::Instance().SetMemoryBudget().
+   bool fUseSharedPageCache = false;
+   /// If non-empty, sealed pages read from storage are additionally stored in this local directory and subsequently
+   /// served from there, also across processes. Meant for remote files whose data is read repeatedly.
+   std::string fDiskCacheDir;
+   /// Upper limit of the total size of the pages in the disk cache directory.  The limit is enforced per process: each
+   /// process accounts for the pages found in the directory when it first opens it and for the pages it adds itself.
+   /// With several processes filling the same directory concurrently, the directory can grow beyond the limit.
+   std::uint64_t fDiskCacheMaxSize = std::uint64_t(10) * 1024 * 1024 * 1024;
+   EDiskCacheEviction fDiskCacheEviction = EDiskCacheEviction::kLRU;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   bool GetUseAdaptiveClusterBunchSize() const { return fUseAdaptiveClusterBunchSize; }
+   void SetUseAdaptiveClusterBunchSize(bool val) { fUseAdaptiveClusterBunchSize = val; }
+   unsigned int GetMaxClusterBunchSize() const { return fMaxClusterBunchSize; }
+   void SetMaxClusterBunchSize(unsigned int val);
+   std::size_t GetClusterPoolMemoryBudget() const { return fClusterPoolMemoryBudget; }
+   void SetClusterPoolMemoryBudget(std::size_t val) { fClusterPoolMemoryBudget = val; }
+   bool GetUseMemoryMap() const { return fUseMemoryMap; }
+   void SetUseMemoryMap(bool val) { fUseMemoryMap = val; }
+   std::size_t GetMaxPooledPageMemory() const { return fMaxPooledPageMemory; }
+   void SetMaxPooledPageMemory(std::size_t val) { fMaxPooledPageMemory = val; }
+   bool GetUseSharedPageCache() const { return fUseSharedPageCache; }
+   void SetUseSharedPageCache(bool val) { fUseSharedPageCache = val; }
+   const std::string &GetDiskCacheDir() const { return fDiskCacheDir; }
+   void SetDiskCacheDir(const std::string &val) { fDiskCacheDir = val; }
+   std::uint64_t GetDiskCacheMaxSize() const { return fDiskCacheMaxSize; }
+   void SetDiskCacheMaxSize(std::uint64_t val) { fDiskCacheMaxSize = val; }
+   EDiskCacheEviction GetDiskCacheEviction() const { return fDiskCacheEviction; }
+   void SetDiskCacheEviction(EDiskCacheEviction val) { fDiskCacheEviction = val; }
 };
 
 } // namespace Experimental
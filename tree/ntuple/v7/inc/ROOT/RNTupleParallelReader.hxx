@@ -0,0 +1,195 @@
+/// \file ROOT/RNTupleParallelReader.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleParallelReader
+#define ROOT7_RNTupleParallelReader
+
+#include <ROOT/RConfig.hxx> // for R__unlikely
+#include <ROOT/REntry.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleView.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleParallelReader;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleReadContext
+\ingroup NTuple
+\brief A context for reading entries of an RNTuple in one thread
+
+Read contexts are created by RNTupleParallelReader::CreateReadContext(). Every context owns a clone of the parallel
+reader's page source, its own model, and its own cluster pool. A context is not thread-safe; it is meant to be used
+from a single thread at a time. The entries are processed range by range, where each range comprises one or several
+complete clusters. A range is handed out to exactly one context, so that the clusters read by different contexts
+do not overlap.
+
+~~~ {.cpp}
+auto reader = RNTupleParallelReader::Open("myNTuple", "some/file.root");
+// in every thread
+auto context = reader->CreateReadContext();
+auto pt = context->GetModel().GetDefaultEntry().GetPtr<float>("pt");
+while (context->NextRange()) {
+   for (auto i : context->GetEntryRange()) {
+      context->LoadEntry(i);
+      // ... use *pt
+   }
+}
+~~~
+*/
+// clang-format on
+class RNTupleReadContext {
+   friend class RNTupleParallelReader;
+
+private:
+   /// The parallel reader that hands out the entry ranges
+   RNTupleParallelReader *fParallelReader;
+   std::unique_ptr<Detail::RPageSource> fSource;
+   /// Needs to be destructed before fSource
+   std::unique_ptr<RNTupleModel> fModel;
+   /// The entry range assigned by the last call to NextRange()
+   NTupleSize_t fFirstEntry = kInvalidNTupleIndex;
+   NTupleSize_t fNEntries = 0;
+   Detail::RNTupleMetrics fMetrics;
+
+   RNTupleReadContext(RNTupleParallelReader &parallelReader, std::unique_ptr<RNTupleModel> model,
+                      std::unique_ptr<Detail::RPageSource> source);
+   RNTupleReadContext(const RNTupleReadContext &) = delete;
+   RNTupleReadContext &operator=(const RNTupleReadContext &) = delete;
+
+   void ConnectModel(RNTupleModel &model);
+
+public:
+   ~RNTupleReadContext();
+
+   const RNTupleModel &GetModel() const { return *fModel; }
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   /// Fetches the next range of entries from the parallel reader. Returns false if all ranges have already been
+   /// assigned to this or other contexts. Restricts the read-ahead of the context's cluster pool to the new range.
+   bool NextRange();
+   /// Returns the entry range assigned by the last call to NextRange(); empty before the first call.
+   RNTupleGlobalRange GetEntryRange() const { return RNTupleGlobalRange(fFirstEntry, fFirstEntry + fNEntries); }
+
+   /// Fills the default entry of the model. The index should be within the current entry range: reading entries
+   /// outside of it is correct but slow, as these clusters are not prefetched.
+   void LoadEntry(NTupleSize_t index) { LoadEntry(index, fModel->GetDefaultEntry()); }
+   /// Fills a user provided entry after checking that the entry has been instantiated from the context's model
+   void LoadEntry(NTupleSize_t index, REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+      entry.Read(index);
+   }
+
+   template <typename T>
+   RNTupleView<T> GetView(std::string_view fieldName)
+   {
+      auto fieldId = fSource->GetSharedDescriptorGuard()->FindFieldId(fieldName);
+      if (fieldId == kInvalidDescriptorId) {
+         throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
+                                  fSource->GetSharedDescriptorGuard()->GetName() + "'"));
+      }
+      return RNTupleView<T>(fieldId, fSource.get());
+   }
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelReader
+\ingroup NTuple
+\brief A reader to process the entries of an RNTuple from multiple threads
+
+The parallel reader opens the storage and deserializes the meta-data (header, footer, page list) once. Read contexts
+created by CreateReadContext() open the storage again but reuse a copy of the already deserialized descriptor, so
+creating a context does not read meta-data. Every context reads and decompresses its own clusters.
+
+The entries are split into ranges of whole clusters; the number of clusters per range is given by the cluster bunch
+size of the read options. Ranges are handed out dynamically, in order of increasing entry numbers, to the contexts
+calling RNTupleReadContext::NextRange(), which balances the load between threads that progress at different speed.
+The order in which a given context sees the ranges is therefore indeterminate.
+
+All read contexts must be destroyed before the parallel reader.
+*/
+// clang-format on
+class RNTupleParallelReader {
+   friend class RNTupleReadContext;
+
+private:
+   /// A global mutex to protect the internal data structures of this object.
+   std::mutex fMutex;
+   /// The attached page source that holds the meta-data; used as a prototype for the page sources of the contexts
+   std::unique_ptr<Detail::RPageSource> fSource;
+   /// If set, the contexts use a clone of the given model; otherwise the model is created from the descriptor
+   std::unique_ptr<RNTupleModel> fModel;
+   /// The entry ranges of whole clusters, sorted by first entry number. Every element is a pair of first entry and
+   /// number of entries.
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> fRanges;
+   /// The index in fRanges of the next range handed out by NextRange()
+   std::atomic<std::size_t> fNextRange{0};
+   /// List of all created read contexts. They must be destroyed before this RNTupleParallelReader is destructed.
+   std::vector<std::weak_ptr<RNTupleReadContext>> fReadContexts;
+
+   RNTupleParallelReader(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSource> source);
+   RNTupleParallelReader(const RNTupleParallelReader &) = delete;
+   RNTupleParallelReader &operator=(const RNTupleParallelReader &) = delete;
+
+   /// Returns the index into fRanges of the next unassigned range; a value >= fRanges.size() if there is none left
+   std::size_t AssignNextRange() { return fNextRange.fetch_add(1, std::memory_order_relaxed); }
+
+public:
+   /// Open an RNTuple for reading from multiple threads. The model must not have projected fields.
+   static std::unique_ptr<RNTupleParallelReader> Open(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                      std::string_view storage,
+                                                      const RNTupleReadOptions &options = RNTupleReadOptions());
+   /// The model of the read contexts is generated from the ntuple meta-data on storage.
+   static std::unique_ptr<RNTupleParallelReader> Open(std::string_view ntupleName, std::string_view storage,
+                                                      const RNTupleReadOptions &options = RNTupleReadOptions());
+
+   ~RNTupleParallelReader();
+
+   NTupleSize_t GetNEntries() const { return fSource->GetNEntries(); }
+   /// The number of entry ranges handed out by RNTupleReadContext::NextRange() in total
+   std::size_t GetNRanges() const { return fRanges.size(); }
+
+   /// Create a new RNTupleReadContext. This method is thread-safe and may be called from multiple threads in parallel.
+   ///
+   /// Note that all read contexts must be destroyed before the RNTupleParallelReader is destructed.
+   std::shared_ptr<RNTupleReadContext> CreateReadContext();
+   /// Hand out all the entry ranges again to the existing and new read contexts. Must not be called while any of
+   /// the contexts calls NextRange().
+   void Rewind() { fNextRange = 0; }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -16,7 +16,9 @@
 #ifndef ROOT7_RNTupleUtil
 #define ROOT7_RNTupleUtil
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 
 #include <string>
 #include <variant>
@@ -97,6 +99,32 @@ public:
    std::uint32_t GetTag() const { return fTag; }
 };
 
+/// Value statistics of the elements of a page or of a column in a cluster, used to skip data that cannot match a
+/// range predicate.  For columns of numbers and booleans, fMin and fMax are the smallest and the largest value; NaNs are
+/// ignored.  For offset columns, fMin and fMax are the smallest and the largest collection size and fNNulls is the
+/// number of empty collections, e.g. unset optionals.  Without any value, fMin is larger than fMax.
+struct RValueStatistics {
+   double fMin = std::numeric_limits<double>::infinity();
+   double fMax = -std::numeric_limits<double>::infinity();
+   std::uint64_t fNNulls = 0;
+
+   bool operator==(const RValueStatistics &other) const
+   {
+      return fMin == other.fMin && fMax == other.fMax && fNNulls == other.fNNulls;
+   }
+   bool operator!=(const RValueStatistics &other) const { return !(*this == other); }
+
+   /// Returns false if none of the described values can be in [min, max]
+   bool Overlaps(double min, double max) const { return (fMin <= max) && (fMax >= min); }
+   /// Combines the statistics of two pages or clusters of the same column
+   void Merge(const RValueStatistics &other)
+   {
+      fMin = std::min(fMin, other.fMin);
+      fMax = std::max(fMax, other.fMax);
+      fNNulls += other.fNNulls;
+   }
+};
+
 /// Uniquely identifies a physical column within the scope of the current process, used to tag pages
 using ColumnId_t = std::int64_t;
 constexpr ColumnId_t kInvalidColumnId = -1;
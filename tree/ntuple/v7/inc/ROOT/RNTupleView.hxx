@@ -18,8 +18,10 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <string_view>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -134,12 +136,14 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access.  For these fields,
+GetSpan() provides contiguous access to the values of an index range, e.g. for vectorized loops.
 */
 // clang-format on
 template <typename T>
 class RNTupleView {
    friend class RNTupleReader;
+   friend class RNTupleReadContext;
    friend class RNTupleViewCollection;
 
    using FieldT = RField<T>;
@@ -149,6 +153,35 @@ private:
    FieldT fField;
    /// Used as a Read() destination for fields that are not mappable
    RFieldBase::RValue fValue;
+   /// Backs the spans returned by GetSpan() whose index range crosses page boundaries
+   std::unique_ptr<T[]> fSpanBuffer;
+   std::size_t fSpanBufferSize = 0;
+
+   template <typename IndexT>
+   std::span<const T> GetSpanImpl(IndexT firstIndex, NTupleSize_t count)
+   {
+      if (count == 0)
+         return std::span<const T>();
+      NTupleSize_t nItems;
+      const T *values = fField.MapV(firstIndex, nItems);
+      if (nItems >= count)
+         return std::span<const T>(values, count);
+
+      if (count > fSpanBufferSize) {
+         fSpanBuffer = std::make_unique<T[]>(count);
+         fSpanBufferSize = count;
+      }
+      NTupleSize_t nCopied = 0;
+      while (true) {
+         const auto nBatch = std::min(nItems, count - nCopied);
+         std::copy(values, values + nBatch, fSpanBuffer.get() + nCopied);
+         nCopied += nBatch;
+         if (nCopied == count)
+            break;
+         values = fField.MapV(firstIndex + nCopied, nItems);
+      }
+      return std::span<const T>(fSpanBuffer.get(), count);
+   }
 
    RNTupleView(DescriptorId_t fieldId, Detail::RPageSource *pageSource)
       : fField(pageSource->GetSharedDescriptorGuard()->GetFieldDescriptor(fieldId).GetFieldName()),
@@ -203,6 +236,37 @@ public:
    {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Returns the values of the index range [globalIndex, globalIndex + count) as a contiguous span.  If the range
+   /// is contained in a single page, the span points into the page and no values are copied.  Otherwise, the values
+   /// are copied into a buffer owned by the view.  In both cases, the span is only valid until the next access
+   /// through the view.
+   template <typename C = T, std::enable_if_t<Internal::isMappable<FieldT>, C *> = nullptr>
+   std::span<const C> GetSpan(NTupleSize_t globalIndex, NTupleSize_t count)
+   {
+      return GetSpanImpl(globalIndex, count);
+   }
+
+   /// Like GetSpan(NTupleSize_t, NTupleSize_t) for an index range within a cluster
+   template <typename C = T, std::enable_if_t<Internal::isMappable<FieldT>, C *> = nullptr>
+   std::span<const C> GetSpan(RClusterIndex clusterIndex, NTupleSize_t count)
+   {
+      return GetSpanImpl(clusterIndex, count);
+   }
+
+   /// For views on dictionary-encoded strings, see RField<std::string>::GetDictionaryIndex()
+   template <typename C = T, std::enable_if_t<std::is_same_v<C, std::string>, C *> = nullptr>
+   RClusterIndex GetDictionaryIndex(NTupleSize_t globalIndex)
+   {
+      return fField.GetDictionaryIndex(globalIndex);
+   }
+
+   /// For views on dictionary-encoded strings, see RField<std::string>::FindInDictionary()
+   template <typename C = T, std::enable_if_t<std::is_same_v<C, std::string>, C *> = nullptr>
+   RClusterIndex FindInDictionary(DescriptorId_t clusterId, std::string_view value)
+   {
+      return fField.FindInDictionary(clusterId, value);
+   }
 };
 
 // clang-format off
@@ -218,6 +282,7 @@ in addition to the field, so that the read object can be retrieved.
 template <>
 class RNTupleView<void> {
    friend class RNTupleReader;
+   friend class RNTupleReadContext;
    friend class RNTupleViewCollection;
 
 private:
@@ -264,6 +329,9 @@ class RNTupleViewCollection : public RNTupleView<ClusterSize_t> {
 private:
    Detail::RPageSource* fSource;
    DescriptorId_t fCollectionFieldId;
+   /// Backs the spans returned by GetOffsetSpan() for ranges that start at the beginning of a cluster
+   std::unique_ptr<ClusterSize_t[]> fOffsetBuffer;
+   std::size_t fOffsetBufferSize = 0;
 
    RNTupleViewCollection(DescriptorId_t fieldId, Detail::RPageSource* source)
       : RNTupleView<ClusterSize_t>(fieldId, source)
@@ -294,6 +362,27 @@ public:
                                  collectionStart.GetIndex() + size);
    }
 
+   /// Returns the count + 1 offsets that delimit the collections [clusterIndex, clusterIndex + count), i.e. the items
+   /// of collection i are the items [offsets[i], offsets[i + 1]) of the cluster.  The items of all the collections
+   /// can be accessed in one go by GetSpan(RClusterIndex(clusterId, offsets[0]), offsets[count] - offsets[0]) on
+   /// the views of the item fields.  The same validity and copy rules as for GetSpan() apply.
+   std::span<const ClusterSize_t> GetOffsetSpan(RClusterIndex clusterIndex, NTupleSize_t count)
+   {
+      // The end offset of the previous collection is the start offset of the first one
+      if (clusterIndex.GetIndex() > 0)
+         return GetSpan(clusterIndex - 1, count + 1);
+
+      // Offsets implicitly start at zero at the beginning of a cluster
+      if (count + 1 > fOffsetBufferSize) {
+         fOffsetBuffer = std::make_unique<ClusterSize_t[]>(count + 1);
+         fOffsetBufferSize = count + 1;
+      }
+      fOffsetBuffer[0] = 0;
+      auto endOffsets = GetSpan(clusterIndex, count);
+      std::copy(endOffsets.begin(), endOffsets.end(), fOffsetBuffer.get() + 1);
+      return std::span<const ClusterSize_t>(fOffsetBuffer.get(), count + 1);
+   }
+
    /// Raises an exception if there is no field with the given name.
    template <typename T>
    RNTupleView<T> GetView(std::string_view fieldName) {
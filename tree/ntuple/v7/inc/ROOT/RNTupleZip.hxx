@@ -189,7 +189,7 @@ public:
     * The nbytes parameter provides the size ls of the from buffer. The dataLen gives the size of the uncompressed data.
     * The block is uncompressed iff nbytes == dataLen.
     */
-   void Unzip(const void *from, size_t nbytes, size_t dataLen, void *to) {
+   static void Unzip(const void *from, size_t nbytes, size_t dataLen, void *to) {
       if (dataLen == nbytes) {
          memcpy(to, from, nbytes);
          return;
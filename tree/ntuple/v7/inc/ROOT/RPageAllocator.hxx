@@ -16,11 +16,16 @@
 #ifndef ROOT7_RPageAllocator
 #define ROOT7_RPageAllocator
 
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPage.hxx>
 
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -77,6 +82,62 @@ public:
    static void DeletePage(const Detail::RPage &page);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RPageAllocatorPool
+\ingroup NTuple
+\brief Recycles the memory of released pages for new pages of the same size class
+
+Page buffers are rounded up to size classes with four steps per power of two.  Released buffers are kept in a free
+list per size class and handed out again to subsequent pages of the same size class, as long as the memory of the
+kept buffers stays below a configurable limit.  Page sinks and sources allocate and release pages for every cluster;
+recycling the buffers avoids the churn on the system allocator and the fragmentation of long-running jobs.
+The allocator is thread-safe.
+*/
+// clang-format on
+class RPageAllocatorPool {
+private:
+   struct RCounters {
+      Detail::RNTupleAtomicCounter &fNPageAllocHit;
+      Detail::RNTupleAtomicCounter &fNPageAllocMiss;
+      Detail::RNTupleAtomicCounter &fSzPeak;
+   };
+
+   std::mutex fLock;
+   /// Released buffers by size class
+   std::unordered_map<std::size_t, std::vector<unsigned char *>> fFreeLists;
+   /// Upper limit of fSzCached; buffers released beyond this limit are freed
+   std::size_t fMaxCachedBytes;
+   /// Memory of the buffers in the free lists
+   std::size_t fSzCached = 0;
+   /// Memory of the buffers handed out and not yet released
+   std::size_t fSzInUse = 0;
+   /// Maximum of fSzCached + fSzInUse
+   std::size_t fSzPeak = 0;
+   Detail::RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+
+public:
+   /// The buffer size used for a page of nbytes bytes: nbytes rounded up to a quarter of the next smaller power of two
+   static std::size_t GetSizeClass(std::size_t nbytes);
+
+   explicit RPageAllocatorPool(std::size_t maxCachedBytes);
+   RPageAllocatorPool(const RPageAllocatorPool &other) = delete;
+   RPageAllocatorPool &operator=(const RPageAllocatorPool &other) = delete;
+   ~RPageAllocatorPool();
+
+   /// Reserves memory large enough to hold nElements of the given size, recycling a released buffer if possible.
+   /// The page is immediately tagged with a column id.
+   Detail::RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements);
+   /// Returns the page's memory to the free list of its size class or, if the memory limit is reached, frees it
+   void DeletePage(const Detail::RPage &page);
+   /// Frees the memory of all released buffers
+   void Trim();
+
+   std::size_t GetMaxCachedBytes() const { return fMaxCachedBytes; }
+   Detail::RNTupleMetrics &GetMetrics() { return fMetrics; }
+};
+
 } // namespace Internal
 } // namespace Experimental
 } // namespace ROOT
@@ -0,0 +1,117 @@
+/// \file ROOT/RPageDiskCache.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageDiskCache
+#define ROOT7_RPageDiskCache
+
+#include <ROOT/RNTupleOptions.hxx>
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Internal {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RPageDiskCache
+\ingroup NTuple
+\brief A persistent cache of sealed pages in a local directory
+
+Every cached page is stored in its own file.  The file name is derived from the identity of the ntuple (the checksums
+of its header and footer envelopes) and the location of the page in the ntuple's file.  Since the content of a page at
+a given location of a given ntuple never changes, the cache needs no invalidation.  The page payload is followed by its
+xxhash3 checksum, which is verified on every read; corrupt files are removed from the cache.
+
+New files are written under a temporary name and then atomically renamed, so that multiple processes can share the
+cache directory.  The index of cached pages and their total size is kept in memory; it is initialized from the
+directory content.  Once the total size exceeds the limit, files are removed according to the eviction policy.
+The modification time of the files tracks the order of use across processes.
+
+The size limit is enforced per process.  Files added by other processes after the directory scan are not part of the
+index, so they neither count against the limit nor get evicted by this process.  With several processes writing
+concurrently, the directory size is therefore only bounded by about the limit times the number of processes.
+*/
+// clang-format on
+class RPageDiskCache {
+public:
+   using EEviction_t = RNTupleReadOptions::EDiskCacheEviction;
+
+private:
+   struct RFileInfo {
+      std::string fName;
+      std::uint64_t fSize = 0;
+   };
+   using RQueue_t = std::list<RFileInfo>;
+
+   std::string fDirectory;
+   std::uint64_t fMaxSize;
+   EEviction_t fEviction;
+   /// Protects the index
+   std::mutex fLock;
+   /// The front of the queue is the next file to evict
+   RQueue_t fQueue;
+   std::unordered_map<std::string, RQueue_t::iterator> fIndex;
+   /// Sum of the file sizes in fQueue
+   std::uint64_t fSize = 0;
+   /// Makes the names of temporary files unique within the process
+   std::atomic<std::uint64_t> fNTmpFiles{0};
+
+   std::string GetPath(const std::string &name) const { return fDirectory + "/" + name; }
+   /// Initializes the index with the cached pages found in the directory, ordered by modification time
+   void ScanDirectory();
+   /// Adds a file to the back of the queue or, if it is already in the index, moves it to the back of the queue
+   void TouchUnlocked(const std::string &name, std::uint64_t size);
+   void RemoveUnlocked(const std::string &name);
+   void EvictUnlocked();
+
+public:
+   /// Returns the cache instance for the given directory; page sources using the same directory share the instance.
+   /// Creates the directory if necessary.  The size limit and eviction policy of the first instance remain in effect
+   /// for as long as the instance exists.
+   static std::shared_ptr<RPageDiskCache> Get(const std::string &directory, std::uint64_t maxSize, EEviction_t eviction);
+
+   RPageDiskCache(const std::string &directory, std::uint64_t maxSize, EEviction_t eviction);
+   RPageDiskCache(const RPageDiskCache &other) = delete;
+   RPageDiskCache &operator=(const RPageDiskCache &other) = delete;
+   ~RPageDiskCache() = default;
+
+   /// The name of the cache file for the page of the given size at the given offset of the file of the ntuple with the
+   /// given identity
+   static std::string GetFileName(std::uint64_t ntupleId, std::uint64_t offset, std::uint64_t size);
+
+   /// Fills the buffer with the page of the given size.  Returns false if the page is not in the cache or if the cached
+   /// copy fails the validation; in the latter case, the file is removed.
+   bool Read(const std::string &name, void *buffer, std::uint64_t size);
+   /// Adds the given page to the cache.  Returns false if nothing was written, i.e. if the page is already cached, if
+   /// it exceeds the cache size, or in case of I/O errors; the page is then simply not cached.
+   bool Write(const std::string &name, const void *buffer, std::uint64_t size);
+
+   const std::string &GetDirectory() const { return fDirectory; }
+   std::uint64_t GetSize();
+   std::uint64_t GetNFiles();
+};
+
+} // namespace Internal
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -21,9 +21,12 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <atomic>
 #include <deque>
+#include <exception>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <tuple>
 
 namespace ROOT {
@@ -127,19 +130,45 @@ private:
    /// The buffered page sink maintains a copy of the RNTupleModel for the inner sink.
    /// For the unbuffered case, the RNTupleModel is instead managed by a RNTupleWriter.
    std::unique_ptr<RNTupleModel> fInnerModel;
-   /// Vector of buffered column pages. Indexed by column id.
-   std::vector<RColumnBuf> fBufferedColumns;
+
+   /// The buffered pages of a cluster.  After the cluster is committed, its pages may still be sealed by concurrent
+   /// tasks.  The task that seals the last page writes the cluster to the inner sink, provided that all the previous
+   /// clusters have been written.
+   struct RPendingCluster {
+      /// Vector of buffered column pages. Indexed by column id.
+      std::vector<RColumnBuf> fBufferedColumns;
+      NTupleSize_t fNEntries = 0;
+      /// The number of pages that are being sealed, plus one as long as the cluster is being filled
+      std::atomic<std::size_t> fNUnsealedPages{1};
+   };
+   /// The cluster that is currently being filled
+   std::unique_ptr<RPendingCluster> fOpenCluster;
+   /// Committed clusters, in entry order, that are not yet written to the inner sink. Protected by fPendingLock.
+   std::deque<std::unique_ptr<RPendingCluster>> fPendingClusters;
+   /// Set if a concurrent task failed to write a cluster to the inner sink. Protected by fPendingLock.
+   std::exception_ptr fCommitError;
+   /// Whether fCommitError has been rethrown to the filling thread. Protected by fPendingLock.
+   bool fCommitErrorReported = false;
+   std::mutex fPendingLock;
+   /// The number of bytes written by the inner sink that are not yet reported by CommitCluster()
+   std::atomic<std::uint64_t> fNBytesCommitted{0};
    DescriptorId_t fNFields = 0;
    DescriptorId_t fNColumns = 0;
 
    void ConnectFields(const std::vector<RFieldBase *> &fields, NTupleSize_t firstEntry);
+   /// Writes the committed clusters at the front of the queue whose pages are all sealed to the inner sink
+   void CommitSealedClusters();
+   /// Waits for all sealing tasks and writes all committed clusters to the inner sink
+   void CommitPendingClusters();
+   /// Rethrows fCommitError, if set. Must be called with fPendingLock held.
+   void ThrowOnCommitError();
 
 public:
    explicit RPageSinkBuf(std::unique_ptr<RPageSink> inner);
    RPageSinkBuf(const RPageSinkBuf&) = delete;
    RPageSinkBuf& operator=(const RPageSinkBuf&) = delete;
-   RPageSinkBuf(RPageSinkBuf&&) = default;
-   RPageSinkBuf& operator=(RPageSinkBuf&&) = default;
+   RPageSinkBuf(RPageSinkBuf&&) = delete;
+   RPageSinkBuf& operator=(RPageSinkBuf&&) = delete;
    ~RPageSinkBuf() override;
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
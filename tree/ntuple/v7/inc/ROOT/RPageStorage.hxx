@@ -32,8 +32,10 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace ROOT {
@@ -91,6 +93,10 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// Set by the page sink if value statistics are enabled in the write options
+      std::optional<RValueStatistics> fStatistics;
+      /// Set by the page sink that sealed the page; pages of different columns may use different compression settings
+      std::optional<int> fCompressionSettings;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -203,7 +209,34 @@ protected:
    static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting, void *buf,
                                bool allowAlias = true);
 
+   /// Returns the value statistics of the page if enabled in the write options and supported by the column type.
+   /// The pages of a column need to be passed in order.  Derived sinks call ResetStatistics() when a cluster is
+   /// committed.
+   std::optional<RValueStatistics> ComputeStatistics(ColumnHandle_t columnHandle, const RPage &page);
+   void ResetStatistics() { fLastOffsets.clear(); }
+
+   /// Records the compression settings of the given field for the columns added since the last call, i.e. up to
+   /// the physical column id nColumns - 1.  Called by derived sinks after connecting a field.
+   void SetColumnCompression(const RFieldBase &field, std::size_t nColumns);
+   /// Returns the compression settings for the pages of the given column.  In automatic compression mode, the first
+   /// call for a column selects the settings by trial compression of the given page.
+   int GetColumnCompression(ColumnHandle_t columnHandle, const RPage &page);
+
+private:
+   /// Indexed by physical column id, the last offset of the previous page of offset columns in the open cluster.
+   /// Required to compute the size of the first collection of a page.
+   std::vector<ClusterSize_t::ValueType> fLastOffsets;
+   /// Indexed by physical column id, the compression settings of the columns, possibly kAutoCompression
+   std::vector<int> fColumnCompression;
+
+   /// Compresses the page with every candidate of the write options and returns the cheapest settings that do not
+   /// leave significant size savings to a more expensive candidate within the CPU budget
+   int SelectCompression(const RPage &page, const RColumnElementBase &element) const;
+
 public:
+   /// Marks the columns in fColumnCompression whose settings are selected from their first page
+   static constexpr int kAutoCompression = -1;
+
    RPageSink(std::string_view ntupleName, const RNTupleWriteOptions &options);
 
    RPageSink(const RPageSink&) = delete;
@@ -432,6 +465,8 @@ private:
    RNTupleDescriptor fDescriptor;
    mutable std::shared_mutex fDescriptorLock;
    REntryRange fEntryRange; ///< Used by the cluster pool to prevent reading beyond the given range
+   /// Clusters that the reader promises to skip; the cluster pool does not read them ahead
+   std::unordered_set<DescriptorId_t> fSkippedClusters;
 
 protected:
    /// Default I/O performance counters that get registered in fMetrics
@@ -478,8 +513,14 @@ protected:
    /// Not all page sources need a decompressor (e.g. virtual ones for chains and friends don't), thus we
    /// leave it up to the derived class whether or not the decompressor gets constructed.
    std::unique_ptr<Internal::RNTupleDecompressor> fDecompressor;
+   /// Allocates the pages returned by UnsealPage(). Page deleters of the page pool should keep a reference to the
+   /// allocator so that pages can be released after the destruction of the page source.
+   std::shared_ptr<Internal::RPageAllocatorPool> fPageAllocator;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
+   /// Whether a clone of this page source can be attached by copying the in-memory descriptor instead of calling
+   /// AttachImpl(). Page sources that set up additional state from the meta-data on storage must return false.
+   virtual bool CanAttachFromDescriptor() const { return false; }
    // Only called if a task scheduler is set. No-op be default.
    virtual void UnzipClusterImpl(RCluster * /* cluster */)
       { }
@@ -488,7 +529,7 @@ protected:
    /// currently always makes a memory copy, even if the sealed page is uncompressed and in the final memory layout.
    /// The optimization of directly mapping pages is left to the concrete page source implementations.
    /// Usage of this method requires construction of fDecompressor. Memory is allocated via
-   /// `RPageAllocatorHeap`; use `RPageAllocatorHeap::DeletePage()` to deallocate returned pages.
+   /// fPageAllocator; use `fPageAllocator->DeletePage()` to deallocate returned pages.
    RPage UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element, DescriptorId_t physicalColumnId);
 
    /// Prepare a page range read for the column set in `clusterKey`.  Specifically, pages referencing the
@@ -521,6 +562,9 @@ public:
                                               const RNTupleReadOptions &options = RNTupleReadOptions());
    /// Open the same storage multiple time, e.g. for reading in multiple threads
    virtual std::unique_ptr<RPageSource> Clone() const = 0;
+   /// Returns an attached clone of this attached page source. If supported by the concrete page source, the clone
+   /// copies the already deserialized descriptor instead of reading and parsing the meta-data from storage again.
+   std::unique_ptr<RPageSource> CloneAttached() const;
 
    EPageStorageType GetType() final { return EPageStorageType::kSource; }
    const RNTupleReadOptions &GetReadOptions() const { return fOptions; }
@@ -550,6 +594,10 @@ public:
    /// the given range. The range needs to be within [0, GetNEntries()).
    void SetEntryRange(const REntryRange &range);
    REntryRange GetEntryRange() const { return fEntryRange; }
+   /// Promise to not read from the given clusters, e.g. because they cannot match a selection. Prevents the cluster
+   /// pool from reading them ahead; they are still loaded if pages from them are requested.
+   void SetSkippedClusters(std::unordered_set<DescriptorId_t> clusterIds) { fSkippedClusters = std::move(clusterIds); }
+   bool IsSkippedCluster(DescriptorId_t clusterId) const { return fSkippedClusters.count(clusterId) > 0; }
 
    /// Allocates and fills a page that contains the index-th element
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
@@ -572,6 +620,13 @@ public:
    /// LoadClusters() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) = 0;
+   /// Called by LoadClustersIncrementally() with the index into the cluster keys and the corresponding loaded cluster
+   using ROnClusterLoaded_t = std::function<void(std::size_t, std::unique_ptr<RCluster>)>;
+   /// Like LoadClusters() but hands over every cluster as soon as all its pages are read, possibly out of order
+   /// and before the other clusters of the bunch are complete. This allows for overlapping the I/O of a cluster bunch
+   /// with the decompression of its first clusters. The default implementation calls LoadClusters() and then hands
+   /// over all clusters in order.
+   virtual void LoadClustersIncrementally(std::span<RCluster::RKey> clusterKeys, const ROnClusterLoaded_t &onLoaded);
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
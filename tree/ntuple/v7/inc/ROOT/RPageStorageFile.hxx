@@ -19,14 +19,23 @@
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleSerialize.hxx>
 #include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageDiskCache.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RSharedPageCache.hxx>
 #include <string_view>
 
 #include <array>
+#include <condition_variable>
 #include <cstdio>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
 #include <utility>
 
 class TFile;
@@ -41,7 +50,7 @@ namespace Experimental {
 class RNTuple; // for making RPageSourceFile a friend of RNTuple
 
 namespace Internal {
-class RPageAllocatorHeap;
+class RPageAllocatorPool;
 class RPagePool;
 }
 
@@ -60,16 +69,62 @@ The written file can be either in ROOT format or in RNTuple bare format.
 // clang-format on
 class RPageSinkFile : public RPagePersistentSink {
 private:
-   std::unique_ptr<Internal::RPageAllocatorHeap> fPageAllocator;
+   /// A byte range of the file, reserved by the filling thread, that still needs to be written by the I/O thread.
+   /// The request owns a copy of the sealed pages so that the caller can reuse its buffers right away.
+   struct RWriteRequest {
+      std::unique_ptr<unsigned char[]> fBuffer;
+      std::size_t fSize = 0;
+      std::uint64_t fOffset = 0;
+   };
+
+   /// Counters of the asynchronous write path that get registered in fMetrics
+   struct RAsyncWriteCounters {
+      RNTupleAtomicCounter &fNWriteQueueStall;
+      RNTupleAtomicCounter &fTimeWallWriteQueueStall;
+      RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuWriteQueueStall;
+      RNTupleAtomicCounter &fSzWriteQueued;
+   };
+
+   std::unique_ptr<Internal::RPageAllocatorPool> fPageAllocator;
 
    std::unique_ptr<Internal::RNTupleFileWriter> fWriter;
    /// Number of bytes committed to storage in the current cluster
    std::uint64_t fNBytesCurrentCluster = 0;
+
+   /// Serializes the access to fWriter between the filling thread and the I/O thread
+   std::mutex fLockWriter;
+   /// Protects the write queue and the associated state
+   std::mutex fLockWriteQueue;
+   /// Signals a non-empty write queue or the shutdown of the I/O thread
+   std::condition_variable fCvHasWriteWork;
+   /// Signals that the I/O thread made room in the write queue or drained it
+   std::condition_variable fCvWriteDone;
+   /// The communication channel to the I/O thread
+   std::deque<RWriteRequest> fWriteQueue;
+   /// Sum of the sizes of the requests in fWriteQueue plus the request being written
+   std::size_t fNBytesQueued = 0;
+   /// Set by the destructor to terminate the I/O thread
+   bool fIsShutdown = false;
+   /// The first error of the I/O thread, rethrown by the next call that enqueues or drains write requests
+   std::exception_ptr fWriteError;
+   std::unique_ptr<RAsyncWriteCounters> fAsyncWriteCounters;
+   /// If RNTupleWriteOptions::GetMaxAsyncWriteBytes() is set and the sink writes its own file, the payload of sealed
+   /// pages is written by the I/O thread, so that compression and filling continue while the previous pages are
+   /// being written.  Blob offsets are still reserved synchronously, so that locators are known right away.
+   std::thread fThreadIo;
+
    RPageSinkFile(std::string_view ntupleName, const RNTupleWriteOptions &options);
 
    RNTupleLocator WriteSealedPage(const RPageStorage::RSealedPage &sealedPage,
                                                 std::size_t bytesPacked);
 
+   /// The main loop of the I/O thread
+   void ExecWrite();
+   /// Hands the request over to the I/O thread; blocks as long as the write queue is full
+   void EnqueueWrite(RWriteRequest &&request);
+   /// Blocks until the write queue is empty
+   void DrainWriteQueue();
+
 protected:
    void InitImpl(unsigned char *serializedHeader, std::uint32_t length) final;
    RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
@@ -85,8 +140,8 @@ public:
    RPageSinkFile(std::string_view ntupleName, TFile &file, const RNTupleWriteOptions &options);
    RPageSinkFile(const RPageSinkFile&) = delete;
    RPageSinkFile& operator=(const RPageSinkFile&) = delete;
-   RPageSinkFile(RPageSinkFile&&) = default;
-   RPageSinkFile& operator=(RPageSinkFile&&) = default;
+   RPageSinkFile(RPageSinkFile &&) = delete;
+   RPageSinkFile &operator=(RPageSinkFile &&) = delete;
    ~RPageSinkFile() override;
 
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
@@ -114,6 +169,30 @@ private:
       std::uint64_t fColumnOffset = 0;
    };
 
+   /// A read-only memory mapping of the entire file, used if RNTupleReadOptions::GetUseMemoryMap() is set.
+   /// Pages that are views into the mapping keep a reference to it, so that the mapping can outlive the page source.
+   class RMappedFile {
+   private:
+      /// The mapping keeps its own raw file for unmapping, independent of the lifetime of the page source
+      std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+      unsigned char *fBase = nullptr;
+      std::uint64_t fSize = 0;
+
+   public:
+      explicit RMappedFile(const ROOT::Internal::RRawFile &file);
+      RMappedFile(const RMappedFile &) = delete;
+      RMappedFile &operator=(const RMappedFile &) = delete;
+      ~RMappedFile();
+
+      bool Contains(std::uint64_t offset, std::uint64_t size) const { return (offset + size) <= fSize; }
+      bool Contains(const void *address) const
+      {
+         return (address >= fBase) && (address < static_cast<const void *>(fBase + fSize));
+      }
+      const unsigned char *GetAddress(std::uint64_t offset) const { return fBase + offset; }
+   };
+
+
    /// Populated pages might be shared; the page pool might, at some point, be used by multiple page sources
    std::shared_ptr<Internal::RPagePool> fPagePool;
    /// The last cluster from which a page got populated.  Points into fClusterPool->fPool
@@ -124,9 +203,39 @@ private:
    Internal::RMiniFileReader fReader;
    /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor
    Internal::RNTupleDescriptorBuilder fDescriptorBuilder;
-   /// The cluster pool asynchronously preloads the next few clusters
+   /// Set on attaching if memory mapping is requested and supported by the raw file; shared with clones
+   std::shared_ptr<RMappedFile> fMappedFile;
+   /// Number of pages that are views into fMappedFile
+   RNTupleAtomicCounter *fNPageMapped = nullptr;
+   /// Identifies the ntuple in the shared page cache; empty unless the shared page cache is used
+   std::string fSharedPageCacheId;
+   /// Number of pages taken from the shared page cache
+   RNTupleAtomicCounter *fNPageShared = nullptr;
+   /// The in-memory element types of the connected columns, by physical column id.  The background unzipping of
+   /// clusters unpacks the pages with the default element of the column type; these pages are exchanged with the shared
+   /// page cache only if the connected column uses the same element type, so that their cache keys match the ones of
+   /// PopulatePageFromCluster().  Accessed by the I/O thread of the cluster pool, protected by fElementTypesLock.
+   std::unordered_map<DescriptorId_t, std::type_index> fElementTypes;
+   std::mutex fElementTypesLock;
+   /// Set if a disk cache directory is given in the read options; shared with clones
+   std::shared_ptr<Internal::RPageDiskCache> fDiskCache;
+   /// Identifies the ntuple in the disk cache; derived from the checksums of the header and footer envelopes
+   std::uint64_t fDiskCacheNTupleId = 0;
+   RNTupleAtomicCounter *fNDiskCacheHit = nullptr;
+   RNTupleAtomicCounter *fNDiskCacheMiss = nullptr;
+   RNTupleAtomicCounter *fSzDiskCacheRead = nullptr;
+   RNTupleAtomicCounter *fSzDiskCacheWrite = nullptr;
+   /// The cluster pool asynchronously preloads the next few clusters.  Its I/O and unzip threads use the members
+   /// above, so it must be declared last: it is destructed first and joins its threads before they go away.
    std::unique_ptr<RClusterPool> fClusterPool;
 
+   /// A page read from the file that is added to the disk cache once the read request completed
+   struct RDiskCacheItem {
+      std::uint64_t fOffset = 0;
+      std::uint64_t fSize = 0;
+      const unsigned char *fBuffer = nullptr;
+   };
+
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const RNTuple &anchor);
 
@@ -135,16 +244,39 @@ private:
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
 
+   /// Returns a page that points directly into the memory mapped file if the sealed page is located in the mapping,
+   /// it is stored uncompressed, its elements need no unpacking, and its address is suitably aligned.
+   /// Otherwise, returns a null page and the sealed page needs to be unsealed.
+   RPage MapSealedPage(const RSealedPage &sealedPage, const RColumnElementBase &element, DescriptorId_t physicalColumnId);
+   /// Page deleter for the page pool that returns the memory of unsealed pages to the page allocator and releases the
+   /// reference to the mapped file of mapped pages
+   Internal::RPageDeleter MakePageDeleter(const RPage &page) const;
+   Internal::RSharedPageCache::RKey MakeSharedPageKey(DescriptorId_t physicalColumnId, DescriptorId_t clusterId,
+                                                      NTupleSize_t pageNo, const RColumnElementBase &element) const;
+   /// Whether the pages of the given column that are loaded and unzipped in the background with the given element
+   /// can be exchanged with the shared page cache
+   bool IsSharedInBackground(DescriptorId_t physicalColumnId, const RColumnElementBase &element);
+   /// Registers (or preloads) a page owned by the shared page cache with the page pool. The page pool keeps a
+   /// reference to the cache entry until the page is released.
+   void RegisterSharedPage(const std::shared_ptr<Internal::RSharedPageCache::REntry> &entry, bool isPreload);
+
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
    /// the provided vector.  This way, requests can be collected for multiple clusters before
    /// sending them to RRawFile::ReadV().
-   std::unique_ptr<RCluster> PrepareSingleCluster(
-      const RCluster::RKey &clusterKey,
-      std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
+   /// Pages that are served from the disk cache are directly copied into the cluster.  Pages to be read from the file
+   /// are appended to diskCacheItems if the disk cache is used.
+   std::unique_ptr<RCluster> PrepareSingleCluster(const RCluster::RKey &clusterKey,
+                                                  std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests,
+                                                  std::vector<RDiskCacheItem> &diskCacheItems);
+   /// Fills the buffer with the page of the given size at the given file offset from the disk cache.
+   /// Returns false if the disk cache is not used or if it does not contain the page.
+   bool ReadFromDiskCache(void *buffer, std::uint64_t size, std::uint64_t offset);
+   void WriteToDiskCache(const void *buffer, std::uint64_t size, std::uint64_t offset);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
+   bool CanAttachFromDescriptor() const final { return true; }
    void UnzipClusterImpl(RCluster *cluster) final;
 
 public:
@@ -154,7 +286,7 @@ public:
    static std::unique_ptr<RPageSourceFile>
    CreateFromAnchor(const RNTuple &anchor, const RNTupleReadOptions &options = RNTupleReadOptions());
    /// The cloned page source creates a new raw file and reader and opens its own file descriptor to the data.
-   /// The meta-data (header and footer) is reread and parsed by the clone.
+   /// The meta-data (header and footer) is reread and parsed by the clone unless it is created by CloneAttached().
    std::unique_ptr<RPageSource> Clone() const final;
 
    RPageSourceFile(const RPageSourceFile&) = delete;
@@ -163,6 +295,8 @@ public:
    RPageSourceFile &operator=(RPageSourceFile &&) = delete;
    ~RPageSourceFile() override;
 
+   ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
+
    RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) final;
    RPage PopulatePage(ColumnHandle_t columnHandle, RClusterIndex clusterIndex) final;
    void ReleasePage(RPage &page) final;
@@ -170,6 +304,9 @@ public:
    void LoadSealedPage(DescriptorId_t physicalColumnId, RClusterIndex clusterIndex, RSealedPage &sealedPage) final;
 
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+   /// Submits the read requests of all clusters as vector reads; with io_uring, the clusters are handed over
+   /// as their requests complete
+   void LoadClustersIncrementally(std::span<RCluster::RKey> clusterKeys, const ROnClusterLoaded_t &onLoaded) final;
 };
 
 
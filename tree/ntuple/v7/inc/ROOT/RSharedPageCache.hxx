@@ -0,0 +1,157 @@
+/// \file ROOT/RSharedPageCache.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RSharedPageCache
+#define ROOT7_RSharedPageCache
+
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Internal {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Internal::RSharedPageCache
+\ingroup NTuple
+\brief A process-wide cache of unsealed pages that is shared by all page sources that opt in to it.
+
+Page sources reading the same ntuple from the same file (e.g., several readers, friends, or the slots of RNTupleDS)
+share the cached pages and thus both the I/O and the decompression of the underlying clusters.  Pages are keyed by
+the ntuple, the physical column, the cluster, the page number, and the in-memory type of the column elements.
+
+Cached pages are reference counted: a page source that takes a page from the cache keeps it alive until it releases
+the page, even if the cache evicted it in the meantime.  Pages in the cache beyond the memory budget are evicted in
+least-recently-used order.  Memory of evicted pages that are still in use does not count against the budget.
+*/
+// clang-format on
+class RSharedPageCache {
+public:
+   /// Identifies a page of a given ntuple
+   struct RKey {
+      /// Distinguishes different ntuples; set by the page source, e.g. from the file URL and the anchor
+      std::string fNTupleId;
+      DescriptorId_t fPhysicalColumnId = kInvalidDescriptorId;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      NTupleSize_t fPageNo = 0;
+      /// Type of the column element that unpacked the page; different readers may use different in-memory types
+      std::type_index fElementType = std::type_index(typeid(void));
+
+      bool operator==(const RKey &other) const
+      {
+         return fPhysicalColumnId == other.fPhysicalColumnId && fClusterId == other.fClusterId &&
+                fPageNo == other.fPageNo && fElementType == other.fElementType && fNTupleId == other.fNTupleId;
+      }
+   };
+
+   struct RKeyHash {
+      std::size_t operator()(const RKey &key) const
+      {
+         auto h = std::hash<std::string>()(key.fNTupleId);
+         h ^= std::hash<DescriptorId_t>()(key.fPhysicalColumnId) + 0x9e3779b9 + (h << 6) + (h >> 2);
+         h ^= std::hash<DescriptorId_t>()(key.fClusterId) + 0x9e3779b9 + (h << 6) + (h >> 2);
+         h ^= std::hash<NTupleSize_t>()(key.fPageNo) + 0x9e3779b9 + (h << 6) + (h >> 2);
+         h ^= key.fElementType.hash_code() + 0x9e3779b9 + (h << 6) + (h >> 2);
+         return h;
+      }
+   };
+
+   /// A cached page together with the deleter of the page source that created it.  The deleter is called once the
+   /// last reference to the entry is gone.
+   class REntry {
+   private:
+      Detail::RPage fPage;
+      RPageDeleter fDeleter;
+
+   public:
+      REntry(const Detail::RPage &page, const RPageDeleter &deleter) : fPage(page), fDeleter(deleter) {}
+      REntry(const REntry &other) = delete;
+      REntry &operator=(const REntry &other) = delete;
+      ~REntry() { fDeleter(fPage); }
+
+      const Detail::RPage &GetPage() const { return fPage; }
+   };
+
+   static constexpr std::size_t kDefaultMemoryBudget = 256 * 1024 * 1024;
+
+private:
+   using RLruList_t = std::list<RKey>;
+
+   struct RSlot {
+      std::shared_ptr<REntry> fEntry;
+      /// Position of the key in fLruList
+      RLruList_t::iterator fLruPosition;
+   };
+
+   /// Protects all members
+   std::mutex fLock;
+   std::size_t fMemoryBudget = kDefaultMemoryBudget;
+   /// Sum of the page sizes of the cached pages
+   std::size_t fMemoryUsage = 0;
+   /// The front of the list is the most recently used page
+   RLruList_t fLruList;
+   std::unordered_map<RKey, RSlot, RKeyHash> fSlots;
+   std::uint64_t fNHit = 0;
+   std::uint64_t fNMiss = 0;
+
+   RSharedPageCache() = default;
+
+   /// Removes least-recently used pages until the memory usage is within the budget
+   void EvictUnlocked();
+
+public:
+   RSharedPageCache(const RSharedPageCache &other) = delete;
+   RSharedPageCache &operator=(const RSharedPageCache &other) = delete;
+   ~RSharedPageCache() = default;
+
+   static RSharedPageCache &Instance();
+
+   std::size_t GetMemoryBudget();
+   /// Setting a smaller budget immediately evicts pages
+   void SetMemoryBudget(std::size_t budget);
+   std::size_t GetMemoryUsage();
+   std::size_t GetNPages();
+   std::uint64_t GetNHit();
+   std::uint64_t GetNMiss();
+
+   /// Returns the cached page and marks it as most recently used, or nullptr if the page is not in the cache
+   std::shared_ptr<REntry> Find(const RKey &key);
+   /// Like Find() but neither touches the LRU order nor the hit statistics
+   bool Contains(const RKey &key);
+   /// Takes ownership of the given page.  If another page source inserted the same page in the meantime, the
+   /// given page is released right away and the existing entry is returned.  A page larger than the memory budget
+   /// is not cached but still returned wrapped in an entry.
+   std::shared_ptr<REntry> Insert(const RKey &key, const Detail::RPage &page, const RPageDeleter &deleter);
+   /// Drops all pages from the cache and resets the statistics; pages in use remain valid
+   void Clear();
+};
+
+} // namespace Internal
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
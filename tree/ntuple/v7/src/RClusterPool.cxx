@@ -51,13 +51,40 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
 ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
    : fPageSource(pageSource)
    , fClusterBunchSize(clusterBunchSize)
+   , fMaxClusterBunchSize(clusterBunchSize)
    , fPool(2 * clusterBunchSize)
+   , fMetrics("RClusterPool")
+   , fCounters(std::make_unique<RCounters>(RCounters{
+      *fMetrics.MakeCounter<RNTupleCalcPerf *>(
+         "clusterBunchSize", "", "current number of clusters per vector read", fMetrics,
+         [this](const RNTupleMetrics &) -> std::pair<bool, double> { return {true, fClusterBunchSize.load()}; }),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nBunchSizeGrow", "", "number of cluster bunch size increases"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nBunchSizeShrink", "", "number of cluster bunch size decreases"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nClusterStall", "",
+                                                    "number of requested clusters that were still in flight"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nClusterExpired", "",
+                                                    "number of preloaded clusters discarded before use"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallBunchRead", "ns",
+                                                    "wall clock time spent loading cluster bunches"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallWait", "ns",
+                                                    "wall clock time spent waiting for clusters")}))
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
 }
 
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, const RNTupleReadOptions &options)
+   : RClusterPool(pageSource, options.GetClusterBunchSize())
+{
+   if (!options.GetUseAdaptiveClusterBunchSize())
+      return;
+
+   fIsAdaptive = true;
+   fMaxClusterBunchSize = std::max(options.GetMaxClusterBunchSize(), fClusterBunchSize.load());
+   fMemoryBudget = options.GetClusterPoolMemoryBudget();
+}
+
 ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
 {
    {
@@ -131,32 +158,44 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
-         auto clusters = fPageSource.LoadClusters(clusterKeys);
-         bool unzipQueueDirty = false;
-         for (std::size_t i = 0; i < clusters.size(); ++i) {
+         // Clusters are handed over to the unzip thread one by one as soon as they are loaded, so that decompression
+         // of the first clusters of the bunch overlaps with reading the remaining ones
+         auto fnOnLoaded = [&](std::size_t i, std::unique_ptr<RCluster> cluster) {
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
             // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
             bool discard;
             {
                std::unique_lock<std::mutex> lock(fLockWorkQueue);
                discard = std::any_of(fInFlightClusters.begin(), fInFlightClusters.end(),
-                                     [thisClusterId = clusters[i]->GetId()](auto &inFlight) {
+                                     [thisClusterId = cluster->GetId()](auto &inFlight) {
                                         return inFlight.fClusterKey.fClusterId == thisClusterId && inFlight.fIsExpired;
                                      });
             }
             if (discard) {
-               clusters[i].reset();
-               readItems[i].fPromise.set_value(std::move(clusters[i]));
+               fCounters->fNClusterExpired.Inc();
+               cluster.reset();
+               readItems[i].fPromise.set_value(std::move(cluster));
             } else {
                // Hand-over the loaded cluster pages to the unzip thread
-               std::unique_lock<std::mutex> lock(fLockUnzipQueue);
-               fUnzipQueue.emplace_back(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
-               unzipQueueDirty = true;
+               {
+                  std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+                  fUnzipQueue.emplace_back(RUnzipItem{std::move(cluster), std::move(readItems[i].fPromise)});
+               }
+               fCvHasUnzipWork.notify_one();
             }
+         };
+
+         {
+            const auto tStart = std::chrono::steady_clock::now();
+            fPageSource.LoadClustersIncrementally(clusterKeys, fnOnLoaded);
+            const auto readTimeNs =
+               std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStart).count();
+            fCounters->fTimeWallBunchRead.Add(readTimeNs);
+            // Moving average with a weight of 1/4 for the most recent measurement
+            const auto avgReadTimeNs = fAvgBunchReadTimeNs.load();
+            fAvgBunchReadTimeNs.store(avgReadTimeNs == 0 ? readTimeNs : (3 * avgReadTimeNs + readTimeNs) / 4);
          }
-         readItems.erase(readItems.begin(), readItems.begin() + clusters.size());
-         if (unzipQueueDirty)
-            fCvHasUnzipWork.notify_one();
+         readItems.erase(readItems.begin(), readItems.begin() + clusterKeys.size());
       }
    } // while (true)
 }
@@ -244,9 +283,24 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
 {
    std::set<DescriptorId_t> keep;
    RProvides provide;
+   // Only used in adaptive mode: the cluster id following clusterId and the size of the requested columns
+   const bool isClusterSwitch = fIsAdaptive && (clusterId != fAdaptiveState.fLastClusterId);
+   DescriptorId_t nextClusterId = kInvalidDescriptorId;
+   std::uint64_t clusterBytes = 0;
    {
       auto descriptorGuard = fPageSource.GetSharedDescriptorGuard();
 
+      if (isClusterSwitch) {
+         const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+         for (auto physicalColumnId : physicalColumns) {
+            if (!clusterDesc.ContainsColumn(physicalColumnId))
+               continue;
+            for (const auto &pageInfo : clusterDesc.GetPageRange(physicalColumnId).fPageInfos)
+               clusterBytes += pageInfo.fLocator.fBytesOnStorage;
+         }
+         nextClusterId = descriptorGuard->FindNextClusterId(clusterId);
+      }
+
       // Determine previous cluster ids that we keep if they happen to be in the pool
       auto prev = clusterId;
       for (unsigned int i = 0; i < fWindowPre; ++i) {
@@ -267,6 +321,8 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
 
          auto cid = next;
          next = descriptorGuard->FindNextClusterId(cid);
+         while ((next != kInvalidDescriptorId) && fPageSource.IsSkippedCluster(next))
+            next = descriptorGuard->FindNextClusterId(next);
          if (next != kInvalidClusterIndex) {
             if (!fPageSource.GetEntryRange().IntersectsWith(descriptorGuard->GetClusterDescriptor(next)))
                next = kInvalidClusterIndex;
@@ -294,6 +350,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
    }
 
    // Move clusters that meanwhile arrived into cache pool
+   bool isStalled = false;
    {
       // This lock is held during iteration over several data structures: the collection of in-flight clusters,
       // the current pool of cached clusters, and the set of cluster ids to be preloaded.
@@ -308,6 +365,9 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
             !provide.Contains(itr->fClusterKey.fClusterId) && (keep.count(itr->fClusterKey.fClusterId) == 0);
 
          if (itr->fFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            // The requested cluster has been scheduled for preloading before but did not yet arrive
+            if (itr->fClusterKey.fClusterId == clusterId)
+               isStalled = true;
             // Remove the set of columns that are already scheduled for being loaded
             provide.Erase(itr->fClusterKey.fClusterId, itr->fClusterKey.fPhysicalColumnSet);
             ++itr;
@@ -378,7 +438,83 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
       }
    } // work queue lock guard
 
-   return WaitFor(clusterId, physicalColumns);
+   if (isStalled)
+      fCounters->fNClusterStall.Inc();
+   if (isClusterSwitch)
+      AdaptClusterBunchSize(clusterId, nextClusterId, clusterBytes, isStalled);
+
+   const auto tStartWait = std::chrono::steady_clock::now();
+   auto result = WaitFor(clusterId, physicalColumns);
+   const auto waitTime =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStartWait);
+   fCounters->fTimeWallWait.Add(waitTime.count());
+   fAdaptiveState.fWaitTime += waitTime;
+   return result;
+}
+
+void ROOT::Experimental::Detail::RClusterPool::AdaptClusterBunchSize(DescriptorId_t clusterId,
+                                                                     DescriptorId_t nextClusterId,
+                                                                     std::uint64_t clusterBytes, bool isStalled)
+{
+   auto &state = fAdaptiveState;
+   const auto now = std::chrono::steady_clock::now();
+   const bool isFirstCluster = (state.fLastClusterId == kInvalidDescriptorId);
+   const bool isLinearAccess = (clusterId == state.fExpectedClusterId);
+
+   // Moving averages with a weight of 1/4 for the most recent measurement
+   if (!isFirstCluster) {
+      const double consumeTimeNs = std::max(
+         0.0, double(std::chrono::duration_cast<std::chrono::nanoseconds>(now - state.fLastSwitch - state.fWaitTime)
+                        .count()));
+      state.fAvgConsumeTimeNs =
+         (state.fAvgConsumeTimeNs == 0.0) ? consumeTimeNs : (0.75 * state.fAvgConsumeTimeNs + 0.25 * consumeTimeNs);
+   }
+   state.fAvgClusterBytes =
+      (state.fAvgClusterBytes == 0.0) ? double(clusterBytes) : (0.75 * state.fAvgClusterBytes + 0.25 * clusterBytes);
+   state.fLastClusterId = clusterId;
+   state.fExpectedClusterId = nextClusterId;
+   state.fLastSwitch = now;
+   state.fWaitTime = std::chrono::nanoseconds(0);
+
+   // The look-ahead window comprises two bunches, both of which should fit in the memory budget
+   unsigned int maxBunchSize = fMaxClusterBunchSize;
+   if (state.fAvgClusterBytes > 0.0) {
+      const double nClustersInBudget = double(fMemoryBudget) / (2.0 * state.fAvgClusterBytes);
+      if (nClustersInBudget < maxBunchSize)
+         maxBunchSize = std::max(1U, static_cast<unsigned int>(nClustersInBudget));
+   }
+
+   const unsigned int currentBunchSize = fClusterBunchSize.load();
+   auto bunchSize = currentBunchSize;
+   if (isFirstCluster) {
+      // No measurements yet
+   } else if (!isLinearAccess) {
+      // Jumps in the access pattern render large parts of the look-ahead window useless
+      bunchSize = currentBunchSize / 2;
+   } else if (isStalled) {
+      // The consumer caught up with the preloading: reading is latency bound, so read more clusters at once
+      bunchSize = 2 * currentBunchSize;
+   } else if (++state.fNCalmSwitches >= 2 * currentBunchSize) {
+      // After a full window without stalls, release memory if loading a bunch takes considerably less time than
+      // processing it
+      if (2.0 * fAvgBunchReadTimeNs.load() < currentBunchSize * state.fAvgConsumeTimeNs)
+         bunchSize = currentBunchSize - 1;
+      state.fNCalmSwitches = 0;
+   }
+   bunchSize = std::max(1U, std::min(bunchSize, maxBunchSize));
+
+   if (bunchSize == currentBunchSize)
+      return;
+   if (bunchSize > currentBunchSize) {
+      fCounters->fNBunchSizeGrow.Inc();
+   } else {
+      fCounters->fNBunchSizeShrink.Inc();
+   }
+   fClusterBunchSize = bunchSize;
+   state.fNCalmSwitches = 0;
+   // The pool never shrinks; clusters outside the smaller window are evicted by the next call to GetCluster()
+   if (fPool.size() < 2 * bunchSize)
+      fPool.resize(2 * bunchSize);
 }
 
 ROOT::Experimental::Detail::RCluster *
@@ -18,11 +18,277 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <cstdint>
 #include <memory>
 #include <utility>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define R__NTUPLE_X86_KERNELS
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define R__NTUPLE_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using ROOT::Experimental::Internal::ESimdLevel;
+
+static_assert(sizeof(bool) == 1, "vectorized unpacking of bit columns requires one byte bools");
+
+// The vectorized kernels process as many full vectors as possible and leave the remaining elements, starting at
+// `first`, to the scalar kernels.
+
+void UnsplitBytesScalar(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t N,
+                        std::size_t first = 0)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      for (std::size_t b = 0; b < N; ++b) {
+         dst[i * N + b] = src[b * count + i];
+      }
+   }
+}
+
+void UnpackBitsToBoolScalar(bool *dst, const unsigned char *src, std::size_t count, std::size_t first = 0)
+{
+   for (std::size_t i = first; i < count; ++i) {
+      dst[i] = (src[i / 8] >> (i % 8)) & 1;
+   }
+}
+
+#ifdef R__NTUPLE_X86_KERNELS
+// The unsplit kernels only use interleaving instructions from SSE2, which is part of the x86-64 baseline.
+// They process 16 elements per iteration.
+void UnsplitBytesSSE(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t N)
+{
+   auto fnLoad = [&](std::size_t b, std::size_t i) {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + b * count + i));
+   };
+   auto fnStore = [](unsigned char *to, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(to), v); };
+
+   std::size_t i = 0;
+   switch (N) {
+   case 2:
+      for (; i + 16 <= count; i += 16) {
+         const __m128i x0 = fnLoad(0, i);
+         const __m128i x1 = fnLoad(1, i);
+         fnStore(dst + 2 * i, _mm_unpacklo_epi8(x0, x1));
+         fnStore(dst + 2 * i + 16, _mm_unpackhi_epi8(x0, x1));
+      }
+      break;
+   case 4:
+      for (; i + 16 <= count; i += 16) {
+         // Pairs of bytes 0+1 and 2+3 of elements 0-7 (lo) and 8-15 (hi)
+         const __m128i x0 = fnLoad(0, i);
+         const __m128i x1 = fnLoad(1, i);
+         const __m128i x2 = fnLoad(2, i);
+         const __m128i x3 = fnLoad(3, i);
+         const __m128i a01lo = _mm_unpacklo_epi8(x0, x1);
+         const __m128i a01hi = _mm_unpackhi_epi8(x0, x1);
+         const __m128i a23lo = _mm_unpacklo_epi8(x2, x3);
+         const __m128i a23hi = _mm_unpackhi_epi8(x2, x3);
+         fnStore(dst + 4 * i, _mm_unpacklo_epi16(a01lo, a23lo));
+         fnStore(dst + 4 * i + 16, _mm_unpackhi_epi16(a01lo, a23lo));
+         fnStore(dst + 4 * i + 32, _mm_unpacklo_epi16(a01hi, a23hi));
+         fnStore(dst + 4 * i + 48, _mm_unpackhi_epi16(a01hi, a23hi));
+      }
+      break;
+   case 8:
+      for (; i + 16 <= count; i += 16) {
+         __m128i a[8];
+         for (std::size_t b = 0; b < 8; b += 2) {
+            const __m128i x0 = fnLoad(b, i);
+            const __m128i x1 = fnLoad(b + 1, i);
+            // Byte pairs b+(b+1) of elements 0-7 and 8-15
+            a[b] = _mm_unpacklo_epi8(x0, x1);
+            a[b + 1] = _mm_unpackhi_epi8(x0, x1);
+         }
+         // Bytes 0-3 and 4-7 of elements 0-3, 4-7, 8-11, 12-15
+         const __m128i lo[4] = {_mm_unpacklo_epi16(a[0], a[2]), _mm_unpackhi_epi16(a[0], a[2]),
+                                _mm_unpacklo_epi16(a[1], a[3]), _mm_unpackhi_epi16(a[1], a[3])};
+         const __m128i hi[4] = {_mm_unpacklo_epi16(a[4], a[6]), _mm_unpackhi_epi16(a[4], a[6]),
+                                _mm_unpacklo_epi16(a[5], a[7]), _mm_unpackhi_epi16(a[5], a[7])};
+         for (std::size_t j = 0; j < 4; ++j) {
+            fnStore(dst + 8 * i + 32 * j, _mm_unpacklo_epi32(lo[j], hi[j]));
+            fnStore(dst + 8 * i + 32 * j + 16, _mm_unpackhi_epi32(lo[j], hi[j]));
+         }
+      }
+      break;
+   }
+   UnsplitBytesScalar(dst, src, count, N, i);
+}
+
+#define R__LOAD256(PTR) _mm256_loadu_si256(reinterpret_cast<const __m256i *>(PTR))
+#define R__STORE256(PTR, V) _mm256_storeu_si256(reinterpret_cast<__m256i *>(PTR), V)
+
+// 32 elements per iteration for element sizes 2 and 4.  The AVX2 interleaving instructions operate on the two 128bit
+// lanes independently, so that the lanes of the results need to be recombined.
+// Lambdas would not inherit the target attribute, hence the macros for loads and stores.
+__attribute__((target("avx2"))) void
+UnsplitBytesAVX2(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t N)
+{
+   std::size_t i = 0;
+   switch (N) {
+   case 2:
+      for (; i + 32 <= count; i += 32) {
+         const __m256i x0 = R__LOAD256(src + i);
+         const __m256i x1 = R__LOAD256(src + count + i);
+         // Elements [0-7 | 16-23] and [8-15 | 24-31]
+         const __m256i lo = _mm256_unpacklo_epi8(x0, x1);
+         const __m256i hi = _mm256_unpackhi_epi8(x0, x1);
+         R__STORE256(dst + 2 * i, _mm256_permute2x128_si256(lo, hi, 0x20));
+         R__STORE256(dst + 2 * i + 32, _mm256_permute2x128_si256(lo, hi, 0x31));
+      }
+      break;
+   case 4:
+      for (; i + 32 <= count; i += 32) {
+         const __m256i x0 = R__LOAD256(src + i);
+         const __m256i x1 = R__LOAD256(src + count + i);
+         const __m256i x2 = R__LOAD256(src + 2 * count + i);
+         const __m256i x3 = R__LOAD256(src + 3 * count + i);
+         const __m256i a01lo = _mm256_unpacklo_epi8(x0, x1);
+         const __m256i a01hi = _mm256_unpackhi_epi8(x0, x1);
+         const __m256i a23lo = _mm256_unpacklo_epi8(x2, x3);
+         const __m256i a23hi = _mm256_unpackhi_epi8(x2, x3);
+         // Elements [0-3 | 16-19], [4-7 | 20-23], [8-11 | 24-27], [12-15 | 28-31]
+         const __m256i o0 = _mm256_unpacklo_epi16(a01lo, a23lo);
+         const __m256i o1 = _mm256_unpackhi_epi16(a01lo, a23lo);
+         const __m256i o2 = _mm256_unpacklo_epi16(a01hi, a23hi);
+         const __m256i o3 = _mm256_unpackhi_epi16(a01hi, a23hi);
+         R__STORE256(dst + 4 * i, _mm256_permute2x128_si256(o0, o1, 0x20));
+         R__STORE256(dst + 4 * i + 32, _mm256_permute2x128_si256(o2, o3, 0x20));
+         R__STORE256(dst + 4 * i + 64, _mm256_permute2x128_si256(o0, o1, 0x31));
+         R__STORE256(dst + 4 * i + 96, _mm256_permute2x128_si256(o2, o3, 0x31));
+      }
+      break;
+   default:
+      // For 8 byte elements, the lane recombination outweighs the wider registers
+      UnsplitBytesSSE(dst, src, count, N);
+      return;
+   }
+   UnsplitBytesScalar(dst, src, count, N, i);
+}
+
+#undef R__LOAD256
+#undef R__STORE256
+
+// Every byte of the bit field is broadcast to 8 bytes, which are then masked with the bit belonging to their position.
+__attribute__((target("sse4.1"))) void UnpackBitsToBoolSSE41(bool *dst, const unsigned char *src, std::size_t count)
+{
+   const __m128i shuffle = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+   const __m128i bitMask = _mm_set1_epi64x(0x8040201008040201LL);
+   const __m128i one = _mm_set1_epi8(1);
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      std::uint16_t word;
+      std::memcpy(&word, src + i / 8, sizeof(word));
+      const __m128i bytes = _mm_shuffle_epi8(_mm_set1_epi16(static_cast<short>(word)), shuffle);
+      const __m128i bits = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(bytes, bitMask), bitMask), one);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), bits);
+   }
+   UnpackBitsToBoolScalar(dst, src, count, i);
+}
+
+__attribute__((target("avx2"))) void UnpackBitsToBoolAVX2(bool *dst, const unsigned char *src, std::size_t count)
+{
+   // The shuffle operates per 128bit lane; every lane holds all four input bytes
+   const __m256i shuffle = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+                                            3, 3, 3, 3, 3, 3, 3);
+   const __m256i bitMask = _mm256_set1_epi64x(0x8040201008040201LL);
+   const __m256i one = _mm256_set1_epi8(1);
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      std::uint32_t word;
+      std::memcpy(&word, src + i / 8, sizeof(word));
+      const __m256i bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(word)), shuffle);
+      const __m256i bits = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(bytes, bitMask), bitMask), one);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), bits);
+   }
+   UnpackBitsToBoolScalar(dst, src, count, i);
+}
+#endif // R__NTUPLE_X86_KERNELS
+
+#ifdef R__NTUPLE_NEON_KERNELS
+// The NEON interleaving stores handle 2 and 4 streams directly; 8 streams are first interleaved pairwise.
+void UnsplitBytesNEON(unsigned char *dst, const unsigned char *src, std::size_t count, std::size_t N)
+{
+   std::size_t i = 0;
+   switch (N) {
+   case 2:
+      for (; i + 16 <= count; i += 16) {
+         uint8x16x2_t v;
+         v.val[0] = vld1q_u8(src + i);
+         v.val[1] = vld1q_u8(src + count + i);
+         vst2q_u8(dst + 2 * i, v);
+      }
+      break;
+   case 4:
+      for (; i + 16 <= count; i += 16) {
+         uint8x16x4_t v;
+         for (std::size_t b = 0; b < 4; ++b)
+            v.val[b] = vld1q_u8(src + b * count + i);
+         vst4q_u8(dst + 4 * i, v);
+      }
+      break;
+   case 8:
+      for (; i + 16 <= count; i += 16) {
+         uint16x8x4_t lo;
+         uint16x8x4_t hi;
+         for (std::size_t b = 0; b < 4; ++b) {
+            const uint8x16x2_t pairs =
+               vzipq_u8(vld1q_u8(src + 2 * b * count + i), vld1q_u8(src + (2 * b + 1) * count + i));
+            lo.val[b] = vreinterpretq_u16_u8(pairs.val[0]);
+            hi.val[b] = vreinterpretq_u16_u8(pairs.val[1]);
+         }
+         vst4q_u16(reinterpret_cast<std::uint16_t *>(dst + 8 * i), lo);
+         vst4q_u16(reinterpret_cast<std::uint16_t *>(dst + 8 * i + 64), hi);
+      }
+      break;
+   }
+   UnsplitBytesScalar(dst, src, count, N, i);
+}
+
+void UnpackBitsToBoolNEON(bool *dst, const unsigned char *src, std::size_t count)
+{
+   static const std::uint8_t kBitMask[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+   const uint8x16_t bitMask = vld1q_u8(kBitMask);
+   const uint8x16_t one = vdupq_n_u8(1);
+   std::size_t i = 0;
+   for (; i + 16 <= count; i += 16) {
+      const uint8x16_t bytes = vcombine_u8(vdup_n_u8(src[i / 8]), vdup_n_u8(src[i / 8 + 1]));
+      vst1q_u8(reinterpret_cast<std::uint8_t *>(dst + i), vandq_u8(vtstq_u8(bytes, bitMask), one));
+   }
+   UnpackBitsToBoolScalar(dst, src, count, i);
+}
+#endif // R__NTUPLE_NEON_KERNELS
+
+ESimdLevel DetectSimdLevel()
+{
+#if defined(R__NTUPLE_X86_KERNELS)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return ESimdLevel::kAVX2;
+   if (__builtin_cpu_supports("sse4.1"))
+      return ESimdLevel::kSSE41;
+   return ESimdLevel::kScalar;
+#elif defined(R__NTUPLE_NEON_KERNELS)
+   return ESimdLevel::kNEON;
+#else
+   return ESimdLevel::kScalar;
+#endif
+}
+
+std::atomic<ESimdLevel> &GetSimdLevelRef()
+{
+   static std::atomic<ESimdLevel> gSimdLevel{ROOT::Experimental::Internal::GetDetectedSimdLevel()};
+   return gSimdLevel;
+}
+
+} // anonymous namespace
+
 template <>
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
@@ -58,6 +324,16 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<std::uint32_t, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<std::uint16_t, EColumnType::kSplitUInt16>>();
+   case EColumnType::kDeltaSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kDeltaSplitInt64>>();
+   case EColumnType::kDeltaSplitUInt64:
+      return std::make_unique<RColumnElement<std::uint64_t, EColumnType::kDeltaSplitUInt64>>();
+   case EColumnType::kDeltaSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kDeltaSplitInt32>>();
+   case EColumnType::kDeltaSplitUInt32:
+      return std::make_unique<RColumnElement<std::uint32_t, EColumnType::kDeltaSplitUInt32>>();
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<float, EColumnType::kReal32Trunc>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<float, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -93,12 +369,40 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
    case EColumnType::kSplitUInt32: return 32;
    case EColumnType::kSplitInt16: return 16;
    case EColumnType::kSplitUInt16: return 16;
+   case EColumnType::kDeltaSplitInt64: return 64;
+   case EColumnType::kDeltaSplitUInt64: return 64;
+   case EColumnType::kDeltaSplitInt32: return 32;
+   case EColumnType::kDeltaSplitUInt32: return 32;
+   // Configurable bit width; the maximum value is used unless set by the column model
+   case EColumnType::kReal32Trunc: return 32;
+   case EColumnType::kReal32Quant: return 32;
    default: R__ASSERT(false);
    }
    // never here
    return 0;
 }
 
+std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(const RColumnModel &model)
+{
+   if (model.GetBitsOnStorage() > 0)
+      return model.GetBitsOnStorage();
+   return GetBitsOnStorage(model.GetType());
+}
+
+std::pair<std::uint16_t, std::uint16_t>
+ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(EColumnType type)
+{
+   switch (type) {
+   // Sign and exponent need to be preserved, plus at least one mantissa bit
+   case EColumnType::kReal32Trunc: return std::make_pair(10, 32);
+   case EColumnType::kReal32Quant: return std::make_pair(1, 32);
+   default: {
+      const auto bitsOnStorage = GetBitsOnStorage(type);
+      return std::make_pair(bitsOnStorage, bitsOnStorage);
+   }
+   }
+}
+
 std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnType type) {
    switch (type) {
    case EColumnType::kIndex64: return "Index64";
@@ -128,6 +432,12 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
    case EColumnType::kSplitUInt32: return "SplitUInt32";
    case EColumnType::kSplitInt16: return "SplitInt16";
    case EColumnType::kSplitUInt16: return "SplitUInt16";
+   case EColumnType::kDeltaSplitInt64: return "DeltaSplitInt64";
+   case EColumnType::kDeltaSplitUInt64: return "DeltaSplitUInt64";
+   case EColumnType::kDeltaSplitInt32: return "DeltaSplitInt32";
+   case EColumnType::kDeltaSplitUInt32: return "DeltaSplitUInt32";
+   case EColumnType::kReal32Trunc: return "Real32Trunc";
+   case EColumnType::kReal32Quant: return "Real32Quant";
    default: return "UNKNOWN";
    }
 }
@@ -155,13 +465,113 @@ void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColum
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Unpack(
   void *dst, void *src, std::size_t count) const
 {
-   bool *boolArray = reinterpret_cast<bool *>(dst);
-   char *charArray = reinterpret_cast<char *>(src);
-   std::bitset<8> bitSet;
-   for (std::size_t i = 0; i < count; i += 8) {
-      bitSet = charArray[i / 8];
-      for (std::size_t j = i; j < std::min(count, i + 8); ++j) {
-         boolArray[j] = bitSet[j % 8];
+   Internal::UnpackBitsToBool(reinterpret_cast<bool *>(dst), src, count);
+}
+
+void ROOT::Experimental::Internal::PackBits(void *destination, const std::uint32_t *source, std::size_t count,
+                                            std::size_t nBits)
+{
+   R__ASSERT(nBits >= 1 && nBits <= 32);
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   const std::uint64_t mask = (std::uint64_t(1) << nBits) - 1;
+   // Holds less than 8 bits between iterations, so that it never overflows when adding up to 32 bits
+   std::uint64_t accumulator = 0;
+   std::size_t nAccumulated = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      accumulator |= (source[i] & mask) << nAccumulated;
+      nAccumulated += nBits;
+      while (nAccumulated >= 8) {
+         *dst++ = static_cast<unsigned char>(accumulator);
+         accumulator >>= 8;
+         nAccumulated -= 8;
       }
    }
+   if (nAccumulated > 0)
+      *dst = static_cast<unsigned char>(accumulator);
+}
+
+void ROOT::Experimental::Internal::UnpackBits(std::uint32_t *destination, const void *source, std::size_t count,
+                                              std::size_t nBits)
+{
+   R__ASSERT(nBits >= 1 && nBits <= 32);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   const std::uint64_t mask = (std::uint64_t(1) << nBits) - 1;
+   std::uint64_t accumulator = 0;
+   std::size_t nAccumulated = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      while (nAccumulated < nBits) {
+         accumulator |= std::uint64_t(*src++) << nAccumulated;
+         nAccumulated += 8;
+      }
+      destination[i] = static_cast<std::uint32_t>(accumulator & mask);
+      accumulator >>= nBits;
+      nAccumulated -= nBits;
+   }
+}
+
+ROOT::Experimental::Internal::ESimdLevel ROOT::Experimental::Internal::GetDetectedSimdLevel()
+{
+   static const ESimdLevel gDetectedLevel = DetectSimdLevel();
+   return gDetectedLevel;
+}
+
+ROOT::Experimental::Internal::ESimdLevel ROOT::Experimental::Internal::GetSimdLevel()
+{
+   return GetSimdLevelRef().load(std::memory_order_relaxed);
+}
+
+void ROOT::Experimental::Internal::SetSimdLevel(ESimdLevel level)
+{
+   const auto detected = GetDetectedSimdLevel();
+   bool isSupported = (level == ESimdLevel::kScalar) || (level == detected);
+   if (level == ESimdLevel::kSSE41 && detected == ESimdLevel::kAVX2)
+      isSupported = true;
+   if (!isSupported) {
+      throw RException(R__FAIL("SIMD level " + GetSimdLevelName(level) + " not supported, the CPU supports up to " +
+                               GetSimdLevelName(detected)));
+   }
+   GetSimdLevelRef().store(level, std::memory_order_relaxed);
+}
+
+std::string ROOT::Experimental::Internal::GetSimdLevelName(ESimdLevel level)
+{
+   switch (level) {
+   case ESimdLevel::kScalar: return "scalar";
+   case ESimdLevel::kSSE41: return "SSE4.1";
+   case ESimdLevel::kAVX2: return "AVX2";
+   case ESimdLevel::kNEON: return "NEON";
+   }
+   return "UNKNOWN";
+}
+
+void ROOT::Experimental::Internal::UnsplitBytes(void *destination, const void *source, std::size_t count,
+                                                std::size_t elementSize)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   switch (GetSimdLevel()) {
+#ifdef R__NTUPLE_X86_KERNELS
+   case ESimdLevel::kAVX2: UnsplitBytesAVX2(dst, src, count, elementSize); return;
+   case ESimdLevel::kSSE41: UnsplitBytesSSE(dst, src, count, elementSize); return;
+#endif
+#ifdef R__NTUPLE_NEON_KERNELS
+   case ESimdLevel::kNEON: UnsplitBytesNEON(dst, src, count, elementSize); return;
+#endif
+   default: UnsplitBytesScalar(dst, src, count, elementSize);
+   }
+}
+
+void ROOT::Experimental::Internal::UnpackBitsToBool(bool *destination, const void *source, std::size_t count)
+{
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   switch (GetSimdLevel()) {
+#ifdef R__NTUPLE_X86_KERNELS
+   case ESimdLevel::kAVX2: UnpackBitsToBoolAVX2(destination, src, count); return;
+   case ESimdLevel::kSSE41: UnpackBitsToBoolSSE41(destination, src, count); return;
+#endif
+#ifdef R__NTUPLE_NEON_KERNELS
+   case ESimdLevel::kNEON: UnpackBitsToBoolNEON(destination, src, count); return;
+#endif
+   default: UnpackBitsToBoolScalar(destination, src, count);
+   }
 }
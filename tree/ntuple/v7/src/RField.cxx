@@ -22,6 +22,7 @@
 #include <ROOT/RLogger.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageStorage.hxx>
 
 #include <TBaseClass.h>
 #include <TClass.h>
@@ -41,6 +42,7 @@
 #include <algorithm>
 #include <cctype> // for isspace
 #include <charconv>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib> // for malloc, free
 #include <cstring> // for memset
@@ -48,6 +50,7 @@
 #include <iostream>
 #include <memory>
 #include <new> // hardware_destructive_interference_size
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
 
@@ -298,6 +301,61 @@ void DestroyRVecWithChecks(std::size_t alignOfT, void **beginPtr, char *begin, s
       free(begin);
 }
 
+/// Used by the truncated and quantized representations of RField<float> and RField<double>
+void EnsureValidBitsOnStorage(ROOT::Experimental::EColumnType type, std::size_t nBits)
+{
+   const auto [minBits, maxBits] = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(type);
+   if (nBits < minBits || nBits > maxBits) {
+      throw ROOT::Experimental::RException(
+         R__FAIL("invalid number of bits for " + ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(type) +
+                 " column: " + std::to_string(nBits) + ", must be between " + std::to_string(minBits) + " and " +
+                 std::to_string(maxBits)));
+   }
+}
+
+void EnsureValidValueRange(double min, double max)
+{
+   if (!(min < max) || !std::isfinite(min) || !std::isfinite(max)) {
+      throw ROOT::Experimental::RException(
+         R__FAIL("invalid value range [" + std::to_string(min) + ", " + std::to_string(max) + "]"));
+   }
+}
+
+/// Creates the column model of floating point fields for writing, which includes the settings of truncated
+/// and quantized column representations
+ROOT::Experimental::RColumnModel
+CreateRealColumnModel(ROOT::Experimental::EColumnType type, std::uint16_t bitsOnStorage,
+                      const std::optional<ROOT::Experimental::RColumnModel::ValueRange_t> &valueRange,
+                      const std::string &fieldName)
+{
+   using ROOT::Experimental::EColumnType;
+   ROOT::Experimental::RColumnModel model(type);
+   if (type != EColumnType::kReal32Trunc && type != EColumnType::kReal32Quant)
+      return model;
+
+   if (bitsOnStorage == 0 || (type == EColumnType::kReal32Quant && !valueRange)) {
+      throw ROOT::Experimental::RException(R__FAIL("field `" + fieldName +
+                                                   "`: use SetTruncated() or SetQuantized() to select a lossy "
+                                                   "floating point column representation"));
+   }
+   model.SetBitsOnStorage(bitsOnStorage);
+   if (type == EColumnType::kReal32Quant)
+      model.SetValueRange(valueRange->first, valueRange->second);
+   return model;
+}
+
+/// Returns the full column model of the first column of the given field, including the number of bits on storage
+/// and the value range of lossy floating point columns
+ROOT::Experimental::RColumnModel
+GetOnDiskColumnModel(const ROOT::Experimental::RNTupleDescriptor &desc, ROOT::Experimental::DescriptorId_t fieldId)
+{
+   for (const auto &c : desc.GetColumnIterable(fieldId)) {
+      if (c.GetIndex() == 0)
+         return c.GetModel();
+   }
+   throw ROOT::Experimental::RException(R__FAIL("no on-disk column found for field ID " + std::to_string(fieldId)));
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -636,6 +694,7 @@ std::unique_ptr<ROOT::Experimental::RFieldBase> ROOT::Experimental::RFieldBase::
    clone->fDescription = fDescription;
    // We can just copy the pointer because fColumnRepresentative points into a static structure
    clone->fColumnRepresentative = fColumnRepresentative;
+   clone->fCompression = fCompression;
    return clone;
 }
 
@@ -768,6 +827,22 @@ void ROOT::Experimental::RFieldBase::SetColumnRepresentative(const ColumnReprese
    fColumnRepresentative = &(*itRepresentative);
 }
 
+void ROOT::Experimental::RFieldBase::SetCompression(int compression)
+{
+   if (fState != EState::kUnconnected)
+      throw RException(R__FAIL("cannot set compression once field is connected"));
+   fCompression = compression;
+}
+
+std::optional<int> ROOT::Experimental::RFieldBase::GetCompression() const
+{
+   for (auto f = this; f; f = f->GetParent()) {
+      if (f->fCompression)
+         return f->fCompression;
+   }
+   return std::nullopt;
+}
+
 const ROOT::Experimental::RFieldBase::ColumnRepresentation_t &
 ROOT::Experimental::RFieldBase::EnsureCompatibleColumnTypes(const RNTupleDescriptor &desc) const
 {
@@ -808,7 +883,10 @@ void ROOT::Experimental::RFieldBase::RemoveReadCallback(size_t idx)
 
 void ROOT::Experimental::RFieldBase::AutoAdjustColumnTypes(const RNTupleWriteOptions &options)
 {
-   if ((options.GetCompression() == 0) && HasDefaultColumnRepresentative()) {
+   // In automatic compression mode, columns may end up compressed; split encodings are kept
+   const auto compression = GetCompression().value_or(
+      options.GetUseAutoCompression() ? Detail::RPageSink::kAutoCompression : options.GetCompression());
+   if ((compression == 0) && HasDefaultColumnRepresentative()) {
       ColumnRepresentation_t rep = GetColumnRepresentative();
       for (auto &colType : rep) {
          switch (colType) {
@@ -1119,20 +1197,25 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<float>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitReal32}, {EColumnType::kReal32}, {EColumnType::kReal16}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal16},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {});
    return representations;
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<float>(
+      CreateRealColumnModel(GetColumnRepresentative()[0], fBitsOnStorage, fValueRange, GetQualifiedFieldName()), 0));
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   fColumns.emplace_back(Detail::RColumn::Create<float>(GetOnDiskColumnModel(desc, GetOnDiskId()), 0));
 }
 
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -1145,25 +1228,48 @@ void ROOT::Experimental::RField<float>::SetHalfPrecision()
    SetColumnRepresentative({EColumnType::kReal16});
 }
 
+void ROOT::Experimental::RField<float>::SetTruncated(std::size_t nBits)
+{
+   EnsureValidBitsOnStorage(EColumnType::kReal32Trunc, nBits);
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fBitsOnStorage = nBits;
+   fValueRange.reset();
+}
+
+void ROOT::Experimental::RField<float>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   EnsureValidBitsOnStorage(EColumnType::kReal32Quant, nBits);
+   EnsureValidValueRange(min, max);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fBitsOnStorage = nBits;
+   fValueRange = RColumnModel::ValueRange_t(min, max);
+}
+
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<double>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitReal64}, {EColumnType::kReal64}, {EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal64},
+                                                  {EColumnType::kReal64},
+                                                  {EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {});
    return representations;
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<double>(
+      CreateRealColumnModel(GetColumnRepresentative()[0], fBitsOnStorage, fValueRange, GetQualifiedFieldName()), 0));
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   fColumns.emplace_back(Detail::RColumn::Create<double>(GetOnDiskColumnModel(desc, GetOnDiskId()), 0));
 }
 
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -1176,6 +1282,23 @@ void ROOT::Experimental::RField<double>::SetDouble32()
    fTypeAlias = "Double32_t";
 }
 
+void ROOT::Experimental::RField<double>::SetTruncated(std::size_t nBits)
+{
+   EnsureValidBitsOnStorage(EColumnType::kReal32Trunc, nBits);
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fBitsOnStorage = nBits;
+   fValueRange.reset();
+}
+
+void ROOT::Experimental::RField<double>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   EnsureValidBitsOnStorage(EColumnType::kReal32Quant, nBits);
+   EnsureValidValueRange(min, max);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fBitsOnStorage = nBits;
+   fValueRange = RColumnModel::ValueRange_t(min, max);
+}
+
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
@@ -1233,8 +1356,9 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt32}, {EColumnType::kInt32}},
-                                                 {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt32}, {EColumnType::kInt32}, {EColumnType::kDeltaSplitInt32}},
+      {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}, {EColumnType::kDeltaSplitUInt32}});
    return representations;
 }
 
@@ -1259,8 +1383,9 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint32_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}},
-                                                 {{EColumnType::kSplitInt32}, {EColumnType::kInt32}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitUInt32}, {EColumnType::kUInt32}, {EColumnType::kDeltaSplitUInt32}},
+      {{EColumnType::kSplitInt32}, {EColumnType::kInt32}, {EColumnType::kDeltaSplitInt32}});
    return representations;
 }
 
@@ -1285,8 +1410,9 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::uint64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}},
-                                                 {{EColumnType::kSplitInt64}, {EColumnType::kInt64}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitUInt64}, {EColumnType::kUInt64}, {EColumnType::kDeltaSplitUInt64}},
+      {{EColumnType::kSplitInt64}, {EColumnType::kInt64}, {EColumnType::kDeltaSplitInt64}});
    return representations;
 }
 
@@ -1311,13 +1437,17 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::int64_t>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitInt64}, {EColumnType::kInt64}},
-                                                 {{EColumnType::kSplitUInt64},
-                                                  {EColumnType::kUInt64},
-                                                  {EColumnType::kInt32},
-                                                  {EColumnType::kSplitInt32},
-                                                  {EColumnType::kUInt32},
-                                                  {EColumnType::kSplitUInt32}});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitInt64}, {EColumnType::kInt64}, {EColumnType::kDeltaSplitInt64}},
+      {{EColumnType::kSplitUInt64},
+       {EColumnType::kUInt64},
+       {EColumnType::kDeltaSplitUInt64},
+       {EColumnType::kInt32},
+       {EColumnType::kSplitInt32},
+       {EColumnType::kDeltaSplitInt32},
+       {EColumnType::kUInt32},
+       {EColumnType::kSplitUInt32},
+       {EColumnType::kDeltaSplitUInt32}});
    return representations;
 }
 
@@ -1342,23 +1472,41 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 const ROOT::Experimental::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<std::string>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitIndex64, EColumnType::kChar},
-                                                  {EColumnType::kIndex64, EColumnType::kChar},
-                                                  {EColumnType::kSplitIndex32, EColumnType::kChar},
-                                                  {EColumnType::kIndex32, EColumnType::kChar}},
-                                                 {});
+   // The dictionary-encoded representations consist of a code column with one element per entry, followed by the
+   // offset and character columns of the dictionary, which only contain the distinct strings of the cluster.
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitIndex64, EColumnType::kChar},
+       {EColumnType::kIndex64, EColumnType::kChar},
+       {EColumnType::kSplitIndex32, EColumnType::kChar},
+       {EColumnType::kIndex32, EColumnType::kChar},
+       {EColumnType::kSplitUInt32, EColumnType::kSplitIndex64, EColumnType::kChar},
+       {EColumnType::kSplitUInt32, EColumnType::kSplitIndex32, EColumnType::kChar}},
+      {});
    return representations;
 }
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
-   fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(GetColumnRepresentative()[1]), 1));
+   const auto &representative = GetColumnRepresentative();
+   if (representative.size() == 3) {
+      fColumns.emplace_back(Detail::RColumn::Create<std::uint32_t>(RColumnModel(representative[0]), 0));
+      fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(representative[1]), 1));
+      fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(representative[2]), 2));
+      return;
+   }
+   fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(representative[0]), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(representative[1]), 1));
 }
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
    auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
+   if (onDiskTypes.size() == 3) {
+      fColumns.emplace_back(Detail::RColumn::Create<std::uint32_t>(RColumnModel(onDiskTypes[0]), 0));
+      fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[1]), 1));
+      fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(onDiskTypes[2]), 2));
+      return;
+   }
    fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[0]), 0));
    fColumns.emplace_back(Detail::RColumn::Create<char>(RColumnModel(onDiskTypes[1]), 1));
 }
@@ -1367,23 +1515,110 @@ std::size_t ROOT::Experimental::RField<std::string>::AppendImpl(const void *from
 {
    auto typedValue = static_cast<const std::string *>(from);
    auto length = typedValue->length();
+
+   if (fColumns.size() == 3) {
+      std::size_t nbytes = 0;
+      if (fWriteDictionary.empty()) {
+         // Code 0 is reserved for the empty string, such that zero-filled codes read back as empty strings, e.g. the
+         // ones of the entries of a cluster that precede a late model extension
+         fWriteDictionary.emplace(std::string(), 0);
+         fColumns[1]->Append(&fIndex);
+         nbytes += fColumns[1]->GetElement()->GetPackedSize();
+      }
+      auto [itr, isNew] =
+         fWriteDictionary.try_emplace(*typedValue, static_cast<std::uint32_t>(fWriteDictionary.size()));
+      if (isNew) {
+         fColumns[2]->AppendV(typedValue->data(), length);
+         fIndex += length;
+         fColumns[1]->Append(&fIndex);
+         nbytes += length + fColumns[1]->GetElement()->GetPackedSize();
+      }
+      fColumns[0]->Append(&itr->second);
+      return nbytes + fColumns[0]->GetElement()->GetPackedSize();
+   }
+
    fColumns[1]->AppendV(typedValue->data(), length);
    fIndex += length;
    fColumns[0]->Append(&fIndex);
    return length + fColumns[0]->GetElement()->GetPackedSize();
 }
 
+void ROOT::Experimental::RField<std::string>::SwitchReadDictionary(DescriptorId_t clusterId)
+{
+   if (fReadDictionary.fClusterId == clusterId)
+      return;
+
+   fReadDictionary.fClusterId = clusterId;
+   fReadDictionary.fSize = 0;
+   fReadDictionary.fCodes.clear();
+   fReadDictionary.fHasCodes = false;
+   // The dictionary is empty in clusters that were written before the field was added or that have been filled
+   // with zero codes by the merger
+   const auto physicalId = fColumns[1]->GetHandleSource().fPhysicalId;
+   auto descriptorGuard = fColumns[1]->GetPageSource()->GetSharedDescriptorGuard();
+   const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+   if (clusterDesc.ContainsColumn(physicalId))
+      fReadDictionary.fSize = clusterDesc.GetColumnRange(physicalId).fNElements;
+}
+
+ROOT::Experimental::RClusterIndex
+ROOT::Experimental::RField<std::string>::GetDictionaryIndex(NTupleSize_t globalIndex)
+{
+   if (fColumns.size() != 3)
+      throw RException(R__FAIL("field '" + GetQualifiedFieldName() + "' is not dictionary-encoded"));
+   const auto clusterIndex = fPrincipalColumn->GetClusterIndex(globalIndex);
+   return RClusterIndex(clusterIndex.GetClusterId(), *fPrincipalColumn->Map<std::uint32_t>(clusterIndex));
+}
+
+ROOT::Experimental::RClusterIndex
+ROOT::Experimental::RField<std::string>::FindInDictionary(DescriptorId_t clusterId, std::string_view value)
+{
+   if (fColumns.size() != 3)
+      throw RException(R__FAIL("field '" + GetQualifiedFieldName() + "' is not dictionary-encoded"));
+
+   SwitchReadDictionary(clusterId);
+   if (!fReadDictionary.fHasCodes) {
+      std::string str;
+      for (std::uint32_t code = 0; code < fReadDictionary.fSize; ++code) {
+         RClusterIndex collectionStart;
+         ClusterSize_t nChars;
+         fColumns[1]->GetCollectionInfo(RClusterIndex(clusterId, code), &collectionStart, &nChars);
+         str.resize(nChars);
+         if (nChars > 0)
+            fColumns[2]->ReadV(collectionStart, nChars, str.data());
+         fReadDictionary.fCodes.emplace(str, code);
+      }
+      fReadDictionary.fHasCodes = true;
+   }
+
+   auto itr = fReadDictionary.fCodes.find(std::string(value));
+   if (itr == fReadDictionary.fCodes.end())
+      return RClusterIndex();
+   return RClusterIndex(clusterId, itr->second);
+}
+
 void ROOT::Experimental::RField<std::string>::ReadGlobalImpl(ROOT::Experimental::NTupleSize_t globalIndex, void *to)
 {
    auto typedValue = static_cast<std::string *>(to);
    RClusterIndex collectionStart;
    ClusterSize_t nChars;
-   fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nChars);
+   if (fColumns.size() == 3) {
+      const auto dictionaryIndex = GetDictionaryIndex(globalIndex);
+      SwitchReadDictionary(dictionaryIndex.GetClusterId());
+      if (dictionaryIndex.GetIndex() >= fReadDictionary.fSize) {
+         // Zero-filled code without a dictionary
+         typedValue->clear();
+         return;
+      }
+      fColumns[1]->GetCollectionInfo(dictionaryIndex, &collectionStart, &nChars);
+   } else {
+      fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nChars);
+   }
    if (nChars == 0) {
       typedValue->clear();
    } else {
       typedValue->resize(nChars);
-      fColumns[1]->ReadV(collectionStart, nChars, const_cast<char *>(typedValue->data()));
+      fColumns.back()->ReadV(collectionStart, nChars, const_cast<char *>(typedValue->data()));
    }
 }
 
@@ -3298,7 +3533,16 @@ ROOT::Experimental::RCollectionField::CloneImpl(std::string_view newName) const
    for (auto& f : fSubFields) {
       parent->Attach(f->Clone(f->GetFieldName()));
    }
-   return std::make_unique<RCollectionField>(newName, fCollectionWriter, std::move(parent));
+   // The clone gets its own writer: the offset is reset on committing the clone's clusters, and the items need to be
+   // appended to the cloned sub fields
+   std::unique_ptr<REntry> defaultEntry;
+   if (fCollectionWriter->GetDefaultEntry()) {
+      defaultEntry = std::unique_ptr<REntry>(new REntry());
+      for (auto f : parent->GetSubFields())
+         defaultEntry->AddValue(f->CreateValue());
+   }
+   auto collectionWriter = std::make_shared<RCollectionNTupleWriter>(std::move(defaultEntry));
+   return std::make_unique<RCollectionField>(newName, collectionWriter, std::move(parent));
 }
 
 void ROOT::Experimental::RCollectionField::CommitClusterImpl()
@@ -1372,7 +1372,9 @@ std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::WriteBlob(const v
    if (fFileSimple) {
       if (fIsBare) {
          offset = fFileSimple.fKeyOffset;
-         fFileSimple.Write(data, nbytes);
+         // Reserved blobs before this one may not have been written yet, so the stream position is not necessarily
+         // at the end of the file
+         fFileSimple.Write(data, nbytes, offset);
          fFileSimple.fKeyOffset += nbytes;
       } else {
          offset = fFileSimple.WriteKey(data, nbytes, len, -1, 100, kBlobClassName);
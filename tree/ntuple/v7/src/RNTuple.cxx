@@ -39,6 +39,7 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #ifdef R__USE_IMT
@@ -267,6 +268,38 @@ const ROOT::Experimental::RNTupleDescriptor &ROOT::Experimental::RNTupleReader::
    return *fCachedDescriptor;
 }
 
+std::vector<ROOT::Experimental::RNTupleGlobalRange>
+ROOT::Experimental::RNTupleReader::SelectEntryRanges(std::string_view fieldName, double min, double max)
+{
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> candidates;
+   std::unordered_set<DescriptorId_t> skippedClusters;
+   {
+      auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+      auto fieldId = descriptorGuard->FindFieldId(fieldName);
+      if (fieldId == kInvalidDescriptorId) {
+         throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
+                                  descriptorGuard->GetName() + "'"));
+      }
+      candidates = descriptorGuard->FindCandidateEntryRanges(fieldId, min, max);
+
+      for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+         const auto firstEntry = clusterDesc.GetFirstEntryIndex();
+         const auto lastEntry = firstEntry + clusterDesc.GetNEntries();
+         // The first candidate range that ends after the start of the cluster
+         auto itr = std::lower_bound(candidates.begin(), candidates.end(), firstEntry,
+                                     [](const auto &range, NTupleSize_t entry) { return range.second <= entry; });
+         if ((itr == candidates.end()) || (itr->first >= lastEntry))
+            skippedClusters.insert(clusterDesc.GetId());
+      }
+   }
+   fSource->SetSkippedClusters(std::move(skippedClusters));
+
+   std::vector<RNTupleGlobalRange> ranges;
+   for (const auto &c : candidates)
+      ranges.emplace_back(c.first, c.second);
+   return ranges;
+}
+
 //------------------------------------------------------------------------------
 
 ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
@@ -310,11 +343,15 @@ void ROOT::Experimental::RNTupleFillContext::CommitCluster()
    fNBytesCommitted += fSink->CommitCluster(nEntriesInCluster);
    fNBytesFilled += fUnzippedClusterSize;
 
-   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
-   const float compressionFactor =
-      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
-   fUnzippedClusterSizeEst =
-      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+   // A sink that compresses in the background may not report the written bytes of the cluster right away; keep the
+   // current estimate until the first cluster is written
+   if (fNBytesCommitted > 0) {
+      // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+      const float compressionFactor =
+         std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+      fUnzippedClusterSizeEst =
+         compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+   }
 
    fLastCommitted = fNEntries;
    fUnzippedClusterSize = 0;
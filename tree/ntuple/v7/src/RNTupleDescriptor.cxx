@@ -339,6 +339,69 @@ ROOT::Experimental::RNTupleDescriptor::FindPrevClusterId(DescriptorId_t clusterI
    return kInvalidDescriptorId;
 }
 
+std::vector<std::pair<ROOT::Experimental::NTupleSize_t, ROOT::Experimental::NTupleSize_t>>
+ROOT::Experimental::RNTupleDescriptor::FindCandidateEntryRanges(DescriptorId_t fieldId, double min, double max) const
+{
+   if (fFieldDescriptors.count(fieldId) == 0)
+      throw RException(R__FAIL("invalid field ID for entry range selection"));
+
+   // Entries correspond to a fixed number of elements of the principal column unless the field is part of a collection
+   bool isEntryAligned = true;
+   std::uint64_t nRepetitions = 1;
+   for (auto id = fieldId; id != GetFieldZeroId(); id = GetFieldDescriptor(id).GetParentId()) {
+      const auto &fieldDesc = GetFieldDescriptor(id);
+      nRepetitions *= std::max(fieldDesc.GetNRepetitions(), std::uint64_t{1U});
+      if ((id != fieldId) && (fieldDesc.GetStructure() != ENTupleStructure::kRecord) &&
+          (fieldDesc.GetStructure() != ENTupleStructure::kLeaf)) {
+         isEntryAligned = false;
+      }
+   }
+   const auto physicalId = FindPhysicalColumnId(fieldId, 0);
+
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> ranges;
+   for (const auto &cd : fClusterDescriptors) {
+      const auto &clusterDesc = cd.second;
+      const auto clusterFirst = clusterDesc.GetFirstEntryIndex();
+      const auto clusterLast = clusterFirst + clusterDesc.GetNEntries();
+      if ((physicalId == kInvalidDescriptorId) || !clusterDesc.ContainsColumn(physicalId)) {
+         ranges.emplace_back(clusterFirst, clusterLast);
+         continue;
+      }
+
+      const auto &columnRange = clusterDesc.GetColumnRange(physicalId);
+      if (columnRange.fStatistics && !columnRange.fStatistics->Overlaps(min, max))
+         continue;
+      if (!isEntryAligned) {
+         ranges.emplace_back(clusterFirst, clusterLast);
+         continue;
+      }
+
+      auto firstElementInPage = columnRange.fFirstElementIndex;
+      for (const auto &pageInfo : clusterDesc.GetPageRange(physicalId).fPageInfos) {
+         if (!pageInfo.fStatistics || pageInfo.fStatistics->Overlaps(min, max)) {
+            const auto first = std::max(clusterFirst, firstElementInPage / nRepetitions);
+            const auto last =
+               std::min(clusterLast, (firstElementInPage + pageInfo.fNElements + nRepetitions - 1) / nRepetitions);
+            if (first < last)
+               ranges.emplace_back(first, last);
+         }
+         firstElementInPage += pageInfo.fNElements;
+      }
+   }
+
+   // Sort and merge adjacent and overlapping ranges
+   std::sort(ranges.begin(), ranges.end());
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> result;
+   for (const auto &r : ranges) {
+      if (!result.empty() && (r.first <= result.back().second)) {
+         result.back().second = std::max(result.back().second, r.second);
+      } else {
+         result.emplace_back(r);
+      }
+   }
+   return result;
+}
+
 std::vector<ROOT::Experimental::DescriptorId_t>
 ROOT::Experimental::RNTupleDescriptor::RHeaderExtension::GetTopLevelFields(const RNTupleDescriptor &desc) const
 {
@@ -530,9 +593,18 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RClusterDescript
       return R__FAIL("column ID conflict");
    RClusterDescriptor::RColumnRange columnRange{physicalId, firstElementIndex, ClusterSize_t{0}};
    columnRange.fCompressionSettings = compressionSettings;
+   bool hasStatistics = !pageRange.fPageInfos.empty();
+   RValueStatistics statistics;
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
+      if (pi.fStatistics) {
+         statistics.Merge(*pi.fStatistics);
+      } else {
+         hasStatistics = false;
+      }
    }
+   if (hasStatistics)
+      columnRange.fStatistics = statistics;
    fCluster.fPageRanges[physicalId] = pageRange.Clone();
    fCluster.fColumnRanges[physicalId] = columnRange;
    return RResult<void>::Success();
@@ -581,8 +653,10 @@ ROOT::Experimental::Internal::RClusterDescriptorBuilder::AddDeferredColumnRanges
                if (c.IsDeferredColumn()) {
                   columnRange.fFirstElementIndex = fCluster.GetFirstEntryIndex() * nRepetitions;
                   columnRange.fNElements = fCluster.GetNEntries() * nRepetitions;
-                  const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel().GetType());
-                  pageRange.ExtendToFitColumnRange(columnRange, *element, Detail::RPage::kPageZeroSize);
+                  const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel());
+                  // The synthesized zero pages have no statistics
+                  if (pageRange.ExtendToFitColumnRange(columnRange, *element, Detail::RPage::kPageZeroSize) > 0)
+                     columnRange.fStatistics.reset();
                }
             }
          },
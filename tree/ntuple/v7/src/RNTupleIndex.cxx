@@ -0,0 +1,205 @@
+/// \file RNTupleIndex.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleIndex.hxx>
+
+#include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleView.hxx>
+
+#include <TFile.h>
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+template <typename T>
+void ReadKeysAs(ROOT::Experimental::RNTupleReader &reader, ROOT::Experimental::DescriptorId_t fieldId,
+                std::vector<std::uint64_t> &keys)
+{
+   auto view = reader.GetView<T>(fieldId);
+   for (auto i : reader.GetEntryRange())
+      keys[i] = static_cast<std::uint64_t>(view(i));
+}
+
+/// Reads the values of the given integral field for all entries of the reader
+std::vector<std::uint64_t> ReadKeys(ROOT::Experimental::RNTupleReader &reader, std::string_view fieldName)
+{
+   using ROOT::Experimental::RException;
+   using ROOT::Experimental::RField;
+
+   ROOT::Experimental::DescriptorId_t fieldId;
+   std::string typeName;
+   {
+      const auto &desc = reader.GetDescriptor();
+      fieldId = desc.FindFieldId(fieldName);
+      if (fieldId == ROOT::Experimental::kInvalidDescriptorId) {
+         throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" + desc.GetName() +
+                                  "'"));
+      }
+      typeName = desc.GetFieldDescriptor(fieldId).GetTypeName();
+   }
+
+   std::vector<std::uint64_t> keys(reader.GetNEntries());
+   if (typeName == RField<std::int8_t>::TypeName()) {
+      ReadKeysAs<std::int8_t>(reader, fieldId, keys);
+   } else if (typeName == RField<std::uint8_t>::TypeName()) {
+      ReadKeysAs<std::uint8_t>(reader, fieldId, keys);
+   } else if (typeName == RField<std::int16_t>::TypeName()) {
+      ReadKeysAs<std::int16_t>(reader, fieldId, keys);
+   } else if (typeName == RField<std::uint16_t>::TypeName()) {
+      ReadKeysAs<std::uint16_t>(reader, fieldId, keys);
+   } else if (typeName == RField<std::int32_t>::TypeName()) {
+      ReadKeysAs<std::int32_t>(reader, fieldId, keys);
+   } else if (typeName == RField<std::uint32_t>::TypeName()) {
+      ReadKeysAs<std::uint32_t>(reader, fieldId, keys);
+   } else if (typeName == RField<std::int64_t>::TypeName()) {
+      ReadKeysAs<std::int64_t>(reader, fieldId, keys);
+   } else if (typeName == RField<std::uint64_t>::TypeName()) {
+      ReadKeysAs<std::uint64_t>(reader, fieldId, keys);
+   } else {
+      throw RException(R__FAIL("cannot index field '" + std::string(fieldName) + "' of non-integral type " + typeName));
+   }
+   return keys;
+}
+
+} // anonymous namespace
+
+bool ROOT::Experimental::RNTupleIndex::IsLess(const RIndexEntry &a, const RIndexEntry &b)
+{
+   return std::tie(a.fMajor, a.fMinor, a.fEntry) < std::tie(b.fMajor, b.fMinor, b.fEntry);
+}
+
+void ROOT::Experimental::RNTupleIndex::Sort()
+{
+   std::sort(fIndexEntries.begin(), fIndexEntries.end(), IsLess);
+}
+
+std::vector<ROOT::Experimental::RNTupleIndex::RIndexEntry>::const_iterator
+ROOT::Experimental::RNTupleIndex::FindFirst(std::uint64_t major, std::uint64_t minor) const
+{
+   RIndexEntry key;
+   key.fMajor = major;
+   key.fMinor = HasMinorField() ? minor : 0;
+   // Sorts before all index entries with the same key
+   key.fEntry = 0;
+   return std::lower_bound(fIndexEntries.begin(), fIndexEntries.end(), key, IsLess);
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Create(RNTupleReader &reader, std::string_view majorFieldName,
+                                         std::string_view minorFieldName)
+{
+   auto index = std::unique_ptr<RNTupleIndex>(new RNTupleIndex(majorFieldName, minorFieldName));
+
+   const auto majors = ReadKeys(reader, majorFieldName);
+   std::vector<std::uint64_t> minors;
+   if (index->HasMinorField())
+      minors = ReadKeys(reader, minorFieldName);
+
+   index->fIndexEntries.resize(majors.size());
+   for (std::size_t i = 0; i < majors.size(); ++i) {
+      auto &indexEntry = index->fIndexEntries[i];
+      indexEntry.fMajor = majors[i];
+      indexEntry.fMinor = minors.empty() ? 0 : minors[i];
+      indexEntry.fEntry = i;
+   }
+   index->Sort();
+   return index;
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Open(std::string_view indexName, std::string_view storage)
+{
+   auto reader = RNTupleReader::Open(indexName, storage);
+
+   std::string majorFieldName;
+   std::string minorFieldName;
+   {
+      const auto &desc = reader->GetDescriptor();
+      const auto majorId = desc.FindFieldId("major");
+      const auto entryId = desc.FindFieldId("entry");
+      if (majorId == kInvalidDescriptorId || entryId == kInvalidDescriptorId)
+         throw RException(R__FAIL("RNTuple '" + std::string(indexName) + "' is not an RNTupleIndex"));
+      majorFieldName = desc.GetFieldDescriptor(majorId).GetFieldDescription();
+      const auto minorId = desc.FindFieldId("minor");
+      if (minorId != kInvalidDescriptorId)
+         minorFieldName = desc.GetFieldDescriptor(minorId).GetFieldDescription();
+   }
+
+   auto index = std::unique_ptr<RNTupleIndex>(new RNTupleIndex(majorFieldName, minorFieldName));
+   auto viewMajor = reader->GetView<std::uint64_t>("major");
+   auto viewEntry = reader->GetView<NTupleSize_t>("entry");
+   index->fIndexEntries.resize(reader->GetNEntries());
+   for (auto i : reader->GetEntryRange()) {
+      index->fIndexEntries[i].fMajor = viewMajor(i);
+      index->fIndexEntries[i].fEntry = viewEntry(i);
+   }
+   if (index->HasMinorField()) {
+      auto viewMinor = reader->GetView<std::uint64_t>("minor");
+      for (auto i : reader->GetEntryRange())
+         index->fIndexEntries[i].fMinor = viewMinor(i);
+   }
+   // Stored indexes are sorted already, unless they were written by other means
+   if (!std::is_sorted(index->fIndexEntries.begin(), index->fIndexEntries.end(), IsLess))
+      index->Sort();
+   return index;
+}
+
+void ROOT::Experimental::RNTupleIndex::Write(std::string_view indexName, TFile &file) const
+{
+   auto model = RNTupleModel::Create();
+   auto major = model->MakeField<std::uint64_t>({"major", fMajorFieldName});
+   std::shared_ptr<std::uint64_t> minor;
+   if (HasMinorField())
+      minor = model->MakeField<std::uint64_t>({"minor", fMinorFieldName});
+   auto entry = model->MakeField<NTupleSize_t>({"entry", "entry number in the indexed RNTuple"});
+
+   auto writer = RNTupleWriter::Append(std::move(model), indexName, file);
+   for (const auto &indexEntry : fIndexEntries) {
+      *major = indexEntry.fMajor;
+      if (minor)
+         *minor = indexEntry.fMinor;
+      *entry = indexEntry.fEntry;
+      writer->Fill();
+   }
+}
+
+ROOT::Experimental::NTupleSize_t
+ROOT::Experimental::RNTupleIndex::GetEntryNumber(std::uint64_t major, std::uint64_t minor) const
+{
+   if (!HasMinorField())
+      minor = 0;
+   auto itr = FindFirst(major, minor);
+   if (itr == fIndexEntries.end() || itr->fMajor != major || itr->fMinor != minor)
+      return kInvalidNTupleIndex;
+   return itr->fEntry;
+}
+
+std::vector<ROOT::Experimental::NTupleSize_t>
+ROOT::Experimental::RNTupleIndex::GetEntryNumbers(std::uint64_t major, std::uint64_t minor) const
+{
+   if (!HasMinorField())
+      minor = 0;
+   std::vector<NTupleSize_t> result;
+   for (auto itr = FindFirst(major, minor); itr != fIndexEntries.end() && itr->fMajor == major && itr->fMinor == minor;
+        ++itr) {
+      result.emplace_back(itr->fEntry);
+   }
+   return result;
+}
@@ -13,19 +13,86 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleAnchor.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#include <TCollection.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+#include <TROOT.h> // for IsImplicitMTEnabled()
+#include <TString.h>
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <utility>
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection *inputs, TFileMergeInfo *mergeInfo)
 {
-   if (inputs == nullptr || mergeInfo == nullptr) {
+   // The inputs are expected to be the ntuple name, followed by the output file, followed by the input files.
+   // The merge option "rntuple.MergingMode=Union" merges sources with different sets of fields.
+   if (inputs == nullptr || mergeInfo == nullptr || inputs->GetEntries() < 3) {
+      return -1;
+   }
+
+   TIter itr(inputs);
+   const std::string ntupleName = itr()->GetName();
+   auto outFile = dynamic_cast<TFile *>(itr());
+   if (!outFile) {
+      R__LOG_ERROR(NTupleLog()) << "RNTuple::Merge: second input is not the output file";
+      return -1;
+   }
+
+   std::vector<std::unique_ptr<Detail::RPageSourceFile>> sources;
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   try {
+      while (auto input = itr()) {
+         auto inFile = dynamic_cast<TFile *>(input);
+         std::unique_ptr<RNTuple> anchor(inFile ? inFile->Get<RNTuple>(ntupleName.c_str()) : nullptr);
+         if (!anchor) {
+            R__LOG_ERROR(NTupleLog()) << "RNTuple::Merge: cannot find RNTuple '" << ntupleName << "' in "
+                                      << input->GetName();
+            return -1;
+         }
+         sources.emplace_back(Detail::RPageSourceFile::CreateFromAnchor(*anchor));
+         sourcePtrs.emplace_back(sources.back().get());
+      }
+
+      RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(outFile->GetCompressionSettings());
+      Internal::RNTupleMergeOptions mergeOptions;
+      if (mergeInfo->fOptions.Contains("rntuple.MergingMode=Union", TString::kIgnoreCase))
+         mergeOptions.fMergingMode = Internal::ENTupleMergingMode::kUnion;
+      Detail::RPageSinkFile destination(ntupleName, *outFile, writeOptions);
+      Internal::RNTupleMerger merger;
+      merger.Merge(sourcePtrs, destination, mergeOptions);
+   } catch (const RException &e) {
+      R__LOG_ERROR(NTupleLog()) << "RNTuple::Merge: " << e.GetError().GetReport();
       return -1;
    }
-   return -1;
+
+   // Hand the anchor of the merged ntuple back to the caller, which may write it again to the output file
+   std::unique_ptr<RNTuple> outAnchor(outFile->Get<RNTuple>(ntupleName.c_str()));
+   if (!outAnchor) {
+      return -1;
+   }
+   *this = *outAnchor;
+   return 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +102,7 @@ void ROOT::Experimental::Internal::RNTupleMerger::BuildColumnIdMap(
    for (auto &column : columns) {
       column.fColumnOutputId = fOutputIdMap.size();
       fOutputIdMap[column.fColumnName + "." + column.fColumnTypeAndVersion] = column.fColumnOutputId;
+      fOutputColumns.emplace_back(column);
    }
 }
 
@@ -57,20 +125,51 @@ void ROOT::Experimental::Internal::RNTupleMerger::ValidateColumns(
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+void ROOT::Experimental::Internal::RNTupleMerger::MapColumns(
+   std::vector<ROOT::Experimental::Internal::RNTupleMerger::RColumnInfo> &columns,
+   const std::unordered_set<std::string> &newFields)
+{
+   // The destination assigns the column ids of the added fields in the same depth-first order
+   for (auto &column : columns) {
+      const auto key = column.fColumnName + "." + column.fColumnTypeAndVersion;
+      auto itr = fOutputIdMap.find(key);
+      if (itr != fOutputIdMap.end()) {
+         column.fColumnOutputId = itr->second;
+         continue;
+      }
+      const auto topLevelFieldName = column.fColumnName.substr(0, column.fColumnName.find('.'));
+      if (newFields.count(topLevelFieldName) == 0) {
+         throw RException(R__FAIL("Column NOT compatible with the previous sources w/ name " + column.fColumnName +
+                                  " type and version " + column.fColumnTypeAndVersion));
+      }
+      column.fColumnOutputId = fOutputIdMap.size();
+      column.fIsDeferred = column.fNElementsPerEntry > 0;
+      fOutputIdMap[key] = column.fColumnOutputId;
+      fOutputColumns.emplace_back(column);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 std::vector<ROOT::Experimental::Internal::RNTupleMerger::RColumnInfo>
-ROOT::Experimental::Internal::RNTupleMerger::CollectColumns(const Detail::RPageSource &source, bool firstSource)
+ROOT::Experimental::Internal::RNTupleMerger::CollectColumns(const Detail::RPageSource &source, bool firstSource,
+                                                            ENTupleMergingMode mergingMode,
+                                                            const std::unordered_set<std::string> &newFields)
 {
-   auto desc = source.GetSharedDescriptorGuard();
    std::vector<RColumnInfo> columns;
-   // Here we recursively find the columns and fill the RColumnInfo vector
-   AddColumnsFromField(columns, desc.GetRef(), desc->GetFieldZero());
+   {
+      auto desc = source.GetSharedDescriptorGuard();
+      // Here we recursively find the columns and fill the RColumnInfo vector
+      AddColumnsFromField(columns, desc.GetRef(), desc->GetFieldZero());
+   }
    // Then we either build the internal map (first source) or validate the columns against it (remaning sources)
    // In either case, we also assign the output ids here
    if (firstSource) {
       BuildColumnIdMap(columns);
-   } else {
+   } else if (mergingMode == ENTupleMergingMode::kStrict) {
       ValidateColumns(columns);
+   } else {
+      MapColumns(columns, newFields);
    }
    return columns;
 }
@@ -78,105 +177,260 @@ ROOT::Experimental::Internal::RNTupleMerger::CollectColumns(const Detail::RPageS
 ////////////////////////////////////////////////////////////////////////////////
 void ROOT::Experimental::Internal::RNTupleMerger::AddColumnsFromField(
    std::vector<ROOT::Experimental::Internal::RNTupleMerger::RColumnInfo> &columns, const RNTupleDescriptor &desc,
-   const RFieldDescriptor &fieldDesc, const std::string &prefix)
+   const RFieldDescriptor &fieldDesc, const std::string &prefix, std::uint64_t nRepetitions)
 {
+   // The number of elements of the subfields of collections and variants is not fixed per entry
+   const bool isFixedPerEntry =
+      fieldDesc.GetStructure() != ENTupleStructure::kCollection && fieldDesc.GetStructure() != ENTupleStructure::kVariant;
    for (const auto &field : desc.GetFieldIterable(fieldDesc)) {
       std::string name = prefix + field.GetFieldName() + ".";
       const std::string typeAndVersion = field.GetTypeName() + "." + std::to_string(field.GetTypeVersion());
+      const std::uint64_t nFieldRepetitions =
+         isFixedPerEntry ? nRepetitions * std::max(field.GetNRepetitions(), std::uint64_t{1U}) : 0;
       for (const auto &column : desc.GetColumnIterable(field)) {
-         columns.emplace_back(name + std::to_string(column.GetIndex()), typeAndVersion, column.GetPhysicalId(),
-                              kInvalidDescriptorId);
+         auto &columnInfo = columns.emplace_back(name + std::to_string(column.GetIndex()), typeAndVersion,
+                                                 column.GetPhysicalId(), kInvalidDescriptorId);
+         columnInfo.fBitsOnStorage = Detail::RColumnElementBase::GetBitsOnStorage(column.GetModel());
+         columnInfo.fNElementsPerEntry = (column.GetIndex() == 0) ? nFieldRepetitions : 0;
       }
-      AddColumnsFromField(columns, desc, field, name);
+      AddColumnsFromField(columns, desc, field, name, nFieldRepetitions);
    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-void ROOT::Experimental::Internal::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources,
-                                                        Detail::RPageSink &destination)
+std::unordered_set<std::string>
+ROOT::Experimental::Internal::RNTupleMerger::ExtendModel(const Detail::RPageSource &source, RNTupleModel &model,
+                                                         Detail::RPageSink &destination, NTupleSize_t firstEntry)
 {
-   // Append the sources to the destination one-by-one
-   bool isFirstSource = true;
-   for (const auto &source : sources) {
-      source->Attach();
+   std::unordered_set<std::string> knownFields;
+   for (auto f : model.GetFieldZero().GetSubFields())
+      knownFields.insert(f->GetFieldName());
 
-      // Make sure the source contains events to be merged
-      if (source->GetNEntries() == 0) {
-         continue;
+   std::unordered_set<std::string> newFields;
+   Detail::RNTupleModelChangeset changeset{model};
+   model.Unfreeze();
+   {
+      auto desc = source.GetSharedDescriptorGuard();
+      for (const auto &fieldDesc : desc->GetTopLevelFields()) {
+         if (knownFields.count(fieldDesc.GetFieldName()) > 0)
+            continue;
+         auto field = fieldDesc.CreateField(desc.GetRef());
+         changeset.fAddedFields.emplace_back(field.get());
+         model.AddField(std::move(field));
+         newFields.insert(fieldDesc.GetFieldName());
       }
+   }
+   model.Freeze();
+   if (!changeset.IsEmpty())
+      destination.UpdateSchema(changeset, firstEntry);
+   return newFields;
+}
 
-      // Collect all the columns
-      // The column name : output column id map is only built once
-      auto columns = CollectColumns(*source, isFirstSource);
+////////////////////////////////////////////////////////////////////////////////
+const ROOT::Experimental::Internal::RNTupleMerger::RZeroPage &
+ROOT::Experimental::Internal::RNTupleMerger::GetZeroPage(std::size_t bytesPacked, int compression)
+{
+   auto &zeroPage = fZeroPages[bytesPacked];
+   if (zeroPage.fAddress)
+      return zeroPage;
 
-      // Get a handle on the descriptor (metadata)
-      auto descriptor = source->GetSharedDescriptorGuard();
+   R__ASSERT(bytesPacked <= Detail::RPage::kPageZeroSize);
+   zeroPage.fBuffer = std::make_unique<unsigned char[]>(bytesPacked);
+   zeroPage.fSize = RNTupleCompressor::Zip(Detail::RPage::GetPageZeroBuffer(), bytesPacked, compression,
+                                           zeroPage.fBuffer.get());
+   zeroPage.fAddress = zeroPage.fBuffer.get();
+   return zeroPage;
+}
 
-      // Create sink from the input model of the very first input file
-      if (isFirstSource) {
-         auto model = descriptor->CreateModel();
-         destination.Init(*model.get());
-         isFirstSource = false;
-      }
+////////////////////////////////////////////////////////////////////////////////
+void ROOT::Experimental::Internal::RNTupleMerger::AttachSources(std::span<Detail::RPageSource *> sources,
+                                                                Detail::RPageStorage::RTaskScheduler *scheduler)
+{
+   if (!scheduler) {
+      for (auto source : sources)
+         source->Attach();
+      return;
+   }
 
-      // Now loop over all clusters in this file
-      // descriptor->GetClusterIterable() doesn't guarantee any specific order...
-      // Find the first cluster id and iterate from there...
-      auto clusterId = descriptor->FindClusterId(0, 0);
+   // Reading the header and the footer of many inputs is latency bound; overlap it and rethrow the first error
+   std::vector<std::exception_ptr> errors(sources.size());
+   scheduler->Reset();
+   for (std::size_t i = 0; i < sources.size(); ++i) {
+      scheduler->AddTask([&sources, &errors, i] {
+         try {
+            sources[i]->Attach();
+         } catch (...) {
+            errors[i] = std::current_exception();
+         }
+      });
+   }
+   scheduler->Wait();
+   for (const auto &e : errors) {
+      if (e)
+         std::rethrow_exception(e);
+   }
+}
 
-      while (clusterId != ROOT::Experimental::kInvalidDescriptorId) {
-         auto &cluster = descriptor->GetClusterDescriptor(clusterId);
+////////////////////////////////////////////////////////////////////////////////
+void ROOT::Experimental::Internal::RNTupleMerger::MergeCluster(
+   Detail::RPageSource &source, DescriptorId_t clusterId,
+   const std::vector<ROOT::Experimental::Internal::RNTupleMerger::RColumnInfo> &columns,
+   const std::vector<DescriptorId_t> &missingColumns, Detail::RPageSink &destination,
+   Detail::RPageStorage::RTaskScheduler *scheduler)
+{
+   const auto dstCompression = destination.GetWriteOptions().GetCompression();
 
-         for (const auto &column : columns) {
+   const auto clusterDesc = source.GetSharedDescriptorGuard()->GetClusterDescriptor(clusterId).Clone();
+   Detail::RCluster::RKey clusterKey;
+   clusterKey.fClusterId = clusterId;
+   for (const auto &column : columns) {
+      if (clusterDesc.ContainsColumn(column.fColumnInputId))
+         clusterKey.fPhysicalColumnSet.insert(column.fColumnInputId);
+   }
 
-            // See if this cluster contains this column
-            // if not, there is nothing to read/do...
-            auto columnId = column.fColumnInputId;
-            if (!cluster.ContainsColumn(columnId)) {
-               continue;
-            }
+   // Read all the sealed pages of the cluster in a single vector read
+   auto clusters = source.LoadClusters(std::span<Detail::RCluster::RKey>(&clusterKey, 1));
+   const auto &cluster = *clusters[0];
 
-            // Now get the pages for this column in this cluster
-            const auto &pages = cluster.GetPageRange(columnId);
-            size_t idx{0};
+   Detail::RPageStorage::SealedPageSequence_t sealedPages;
+   // Output column id and number of pages of every column in the cluster
+   std::vector<std::pair<DescriptorId_t, std::size_t>> pageGroups;
+   // Pages to recompress and their packed size
+   std::vector<std::pair<Detail::RPageStorage::RSealedPage *, std::size_t>> toRecompress;
+   for (std::size_t i = 0; i < columns.size(); ++i) {
+      const auto columnId = columns[i].fColumnInputId;
+      if (!clusterDesc.ContainsColumn(columnId))
+         continue;
 
-            // Loop over the pages
-            for (const auto &pageInfo : pages.fPageInfos) {
+      const bool needsRecompression = clusterDesc.GetColumnRange(columnId).fCompressionSettings != dstCompression;
+      const auto &pageRange = clusterDesc.GetPageRange(columnId);
+      NTupleSize_t pageNo = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         auto onDiskPage = cluster.GetOnDiskPage(Detail::ROnDiskPage::Key{columnId, pageNo});
+         R__ASSERT(onDiskPage);
+         // Elements of the deque are not moved by emplace_back
+         auto &sealedPage = sealedPages.emplace_back(onDiskPage->GetAddress(), onDiskPage->GetSize(),
+                                                     pageInfo.fNElements);
+         sealedPage.fStatistics = pageInfo.fStatistics;
+         const auto bytesPacked = (pageInfo.fNElements * columns[i].fBitsOnStorage + 7) / 8;
+         if (needsRecompression && bytesPacked > 0 && sealedPage.fBuffer != Detail::RPage::GetPageZeroBuffer())
+            toRecompress.emplace_back(&sealedPage, bytesPacked);
+         ++pageNo;
+      }
+      pageGroups.emplace_back(columns[i].fColumnOutputId, pageRange.fPageInfos.size());
+   }
 
-               // Each page contains N elements that we are going to read together
-               // LoadSealedPage reads packed/compressed bytes of a page into
-               // a memory buffer provided by a sealed page
-               RClusterIndex clusterIndex(clusterId, idx);
-               Detail::RPageStorage::RSealedPage sealedPage;
-               source->LoadSealedPage(columnId, clusterIndex, sealedPage);
+   // Fill the output columns that are missing in this source with zeros.  Deferred columns and columns without a
+   // fixed number of elements per entry read back as default values without any pages.
+   for (auto outputId : missingColumns) {
+      const auto &column = fOutputColumns[outputId];
+      if (column.fIsDeferred || column.fNElementsPerEntry == 0)
+         continue;
+      const std::uint64_t nElementsPerPage = Detail::RPage::kPageZeroSize * 8 / column.fBitsOnStorage;
+      std::size_t nPages = 0;
+      for (std::uint64_t nRemaining = clusterDesc.GetNEntries() * column.fNElementsPerEntry; nRemaining > 0;) {
+         const auto nElements = std::min(nElementsPerPage, nRemaining);
+         const auto &zeroPage = GetZeroPage((nElements * column.fBitsOnStorage + 7) / 8, dstCompression);
+         sealedPages.emplace_back(zeroPage.fAddress, zeroPage.fSize, nElements);
+         nRemaining -= nElements;
+         ++nPages;
+      }
+      pageGroups.emplace_back(outputId, nPages);
+   }
 
-               // The way LoadSealedPage works might require a double call
-               // See the implementation. Here we do this in any case...
-               auto buffer = std::make_unique<unsigned char[]>(sealedPage.fSize);
-               sealedPage.fBuffer = buffer.get();
-               source->LoadSealedPage(columnId, clusterIndex, sealedPage);
+   std::vector<std::unique_ptr<unsigned char[]>> zipBuffers(toRecompress.size());
+   auto fnRecompress = [&toRecompress, &zipBuffers, dstCompression](std::size_t i) {
+      auto &sealedPage = *toRecompress[i].first;
+      const auto bytesPacked = toRecompress[i].second;
+      auto packedBuffer = std::make_unique<unsigned char[]>(bytesPacked);
+      RNTupleDecompressor::Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, packedBuffer.get());
+      zipBuffers[i] = std::make_unique<unsigned char[]>(bytesPacked);
+      sealedPage.fSize = RNTupleCompressor::Zip(packedBuffer.get(), bytesPacked, dstCompression, zipBuffers[i].get());
+      sealedPage.fBuffer = zipBuffers[i].get();
+   };
+   if (scheduler && toRecompress.size() > 1) {
+      scheduler->Reset();
+      for (std::size_t i = 0; i < toRecompress.size(); ++i)
+         scheduler->AddTask([&fnRecompress, i] { fnRecompress(i); });
+      scheduler->Wait();
+   } else {
+      for (std::size_t i = 0; i < toRecompress.size(); ++i)
+         fnRecompress(i);
+   }
 
-               // Now commit this page to the output
-               // Can we do this w/ a CommitSealedPageV
-               destination.CommitSealedPage(column.fColumnOutputId, sealedPage);
+   std::vector<Detail::RPageStorage::RSealedPageGroup> sealedPageGroups;
+   auto itrPage = sealedPages.cbegin();
+   for (const auto &[outputId, nPages] : pageGroups) {
+      auto itrEnd = std::next(itrPage, nPages);
+      sealedPageGroups.emplace_back(outputId, itrPage, itrEnd);
+      itrPage = itrEnd;
+   }
+   destination.CommitSealedPageV(sealedPageGroups);
+   destination.CommitCluster(clusterDesc.GetNEntries());
+}
 
-               // Move on to the next index
-               idx += pageInfo.fNElements;
+////////////////////////////////////////////////////////////////////////////////
+void ROOT::Experimental::Internal::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources,
+                                                        Detail::RPageSink &destination,
+                                                        const RNTupleMergeOptions &options)
+{
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> taskScheduler;
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled())
+      taskScheduler = std::make_unique<RNTupleImtTaskScheduler>();
+#endif
+
+   AttachSources(sources, taskScheduler.get());
 
-            } // end of loop over pages
+   // The model of the destination; in union mode, it is extended by the fields of the later sources
+   std::unique_ptr<RNTupleModel> model;
+   NTupleSize_t nEntries = 0;
 
-         } // end of loop over columns
+   // Append the sources to the destination one-by-one
+   for (const auto &source : sources) {
+      // Make sure the source contains events to be merged
+      if (source->GetNEntries() == 0) {
+         continue;
+      }
+
+      // Create sink from the input model of the very first input file
+      const bool isFirstSource = !model;
+      std::unordered_set<std::string> newFields;
+      if (isFirstSource) {
+         model = source->GetSharedDescriptorGuard()->CreateModel();
+         destination.Init(*model.get());
+      } else if (options.fMergingMode == ENTupleMergingMode::kUnion) {
+         newFields = ExtendModel(*source, *model, destination, nEntries);
+      }
 
-         // Commit the clusters
-         destination.CommitCluster(cluster.GetNEntries());
+      // Collect all the columns
+      // The column name : output column id map is only built once
+      auto columns = CollectColumns(*source, isFirstSource, options.fMergingMode, newFields);
 
-         // Go to the next cluster
-         clusterId = descriptor->FindNextClusterId(clusterId);
+      // In union mode, the source may lack some of the output columns
+      std::vector<DescriptorId_t> missingColumns;
+      if (columns.size() < fOutputColumns.size()) {
+         std::vector<bool> isPresent(fOutputColumns.size(), false);
+         for (const auto &column : columns)
+            isPresent[column.fColumnOutputId] = true;
+         for (DescriptorId_t i = 0; i < isPresent.size(); ++i) {
+            if (!isPresent[i])
+               missingColumns.emplace_back(i);
+         }
+      }
 
-      } // end of loop over clusters
+      // Now loop over all clusters in this file
+      // descriptor->GetClusterIterable() doesn't guarantee any specific order...
+      // Find the first cluster id and iterate from there...
+      auto clusterId = source->GetSharedDescriptorGuard()->FindClusterId(0, 0);
+      while (clusterId != ROOT::Experimental::kInvalidDescriptorId) {
+         MergeCluster(*source, clusterId, columns, missingColumns, destination, taskScheduler.get());
+         clusterId = source->GetSharedDescriptorGuard()->FindNextClusterId(clusterId);
+      }
 
       // Commit all clusters for this input
       destination.CommitClusterGroup();
+      nEntries += source->GetNEntries();
 
    } // end of loop over sources
 
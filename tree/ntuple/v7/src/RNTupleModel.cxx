@@ -400,3 +400,12 @@ void ROOT::Experimental::RNTupleModel::SetDescription(std::string_view descripti
    EnsureNotFrozen();
    fDescription = std::string(description);
 }
+
+void ROOT::Experimental::RNTupleModel::SetFieldCompression(std::string_view fieldName, int compression)
+{
+   EnsureNotFrozen();
+   auto f = FindField(fieldName);
+   if (!f)
+      throw RException(R__FAIL("no such field: " + std::string(fieldName)));
+   f->SetCompression(compression);
+}
@@ -64,3 +64,11 @@ void ROOT::Experimental::RNTupleWriteOptions::SetApproxUnzippedPageSize(std::siz
    EnsureValidTunables(fApproxZippedClusterSize, fMaxUnzippedClusterSize, val);
    fApproxUnzippedPageSize = val;
 }
+
+void ROOT::Experimental::RNTupleReadOptions::SetMaxClusterBunchSize(unsigned int val)
+{
+   if (val == 0) {
+      throw RException(R__FAIL("invalid maximum cluster bunch size: 0"));
+   }
+   fMaxClusterBunchSize = val;
+}
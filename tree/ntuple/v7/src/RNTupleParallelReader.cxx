@@ -0,0 +1,144 @@
+/// \file RNTupleParallelReader.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleParallelReader.hxx>
+
+#include <ROOT/RField.hxx>
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+ROOT::Experimental::RNTupleReadContext::RNTupleReadContext(RNTupleParallelReader &parallelReader,
+                                                           std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSource> source)
+   : fParallelReader(&parallelReader),
+     fSource(std::move(source)),
+     fModel(std::move(model)),
+     fMetrics("RNTupleReadContext")
+{
+   // Until the first call to NextRange(), the cluster pool must not start reading clusters
+   fSource->SetEntryRange({0, 0});
+   fMetrics.ObserveMetrics(fSource->GetMetrics());
+   ConnectModel(*fModel);
+}
+
+ROOT::Experimental::RNTupleReadContext::~RNTupleReadContext() = default;
+
+void ROOT::Experimental::RNTupleReadContext::ConnectModel(RNTupleModel &model)
+{
+   auto &fieldZero = model.GetFieldZero();
+   // We must not use the descriptor guard to prevent recursive locking in field.ConnectPageSource
+   DescriptorId_t fieldZeroId = fSource->GetSharedDescriptorGuard()->GetFieldZeroId();
+   fieldZero.SetOnDiskId(fieldZeroId);
+   for (auto &field : fieldZero.GetSubFields()) {
+      // Models created from the descriptor have their on-disk IDs already set
+      if (field->GetOnDiskId() == kInvalidDescriptorId) {
+         field->SetOnDiskId(fSource->GetSharedDescriptorGuard()->FindFieldId(field->GetFieldName(), fieldZeroId));
+      }
+      field->ConnectPageSource(*fSource);
+   }
+}
+
+bool ROOT::Experimental::RNTupleReadContext::NextRange()
+{
+   const auto idx = fParallelReader->AssignNextRange();
+   if (idx >= fParallelReader->fRanges.size()) {
+      fFirstEntry = kInvalidNTupleIndex;
+      fNEntries = 0;
+      return false;
+   }
+
+   std::tie(fFirstEntry, fNEntries) = fParallelReader->fRanges[idx];
+   fSource->SetEntryRange({fFirstEntry, fNEntries});
+   return true;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleParallelReader::RNTupleParallelReader(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSource> source)
+   : fSource(std::move(source)), fModel(std::move(model))
+{
+   if (fModel) {
+      // Projected fields are deliberately not supported, as by RNTupleReader: only the model fields are read
+      if (!fModel->GetProjectedFields().IsEmpty()) {
+         throw RException(R__FAIL("model has projected fields, which is incompatible with providing a read model"));
+      }
+      fModel->Freeze();
+   }
+   fSource->Attach();
+
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> clusterRanges;
+   {
+      auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+      for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+         if (clusterDesc.GetNEntries() == 0)
+            continue;
+         clusterRanges.emplace_back(clusterDesc.GetFirstEntryIndex(), clusterDesc.GetNEntries());
+      }
+   }
+   std::sort(clusterRanges.begin(), clusterRanges.end());
+
+   // Merge consecutive clusters into ranges of (up to) cluster bunch size many clusters
+   const std::size_t nClustersPerRange = std::max(1u, fSource->GetReadOptions().GetClusterBunchSize());
+   for (std::size_t i = 0; i < clusterRanges.size(); i += nClustersPerRange) {
+      const auto iLast = std::min(i + nClustersPerRange, clusterRanges.size()) - 1;
+      const auto firstEntry = clusterRanges[i].first;
+      fRanges.emplace_back(firstEntry, clusterRanges[iLast].first + clusterRanges[iLast].second - firstEntry);
+   }
+}
+
+ROOT::Experimental::RNTupleParallelReader::~RNTupleParallelReader()
+{
+   for (const auto &context : fReadContexts) {
+      if (!context.expired()) {
+         R__LOG_ERROR(NTupleLog()) << "RNTupleReadContext has not been destructed";
+         return;
+      }
+   }
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelReader>
+ROOT::Experimental::RNTupleParallelReader::Open(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                std::string_view storage, const RNTupleReadOptions &options)
+{
+   // Cannot use std::make_unique because the constructor of RNTupleParallelReader is private.
+   return std::unique_ptr<RNTupleParallelReader>(
+      new RNTupleParallelReader(std::move(model), Detail::RPageSource::Create(ntupleName, storage, options)));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelReader>
+ROOT::Experimental::RNTupleParallelReader::Open(std::string_view ntupleName, std::string_view storage,
+                                                const RNTupleReadOptions &options)
+{
+   // Cannot use std::make_unique because the constructor of RNTupleParallelReader is private.
+   return std::unique_ptr<RNTupleParallelReader>(
+      new RNTupleParallelReader(nullptr, Detail::RPageSource::Create(ntupleName, storage, options)));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleReadContext> ROOT::Experimental::RNTupleParallelReader::CreateReadContext()
+{
+   std::lock_guard g(fMutex);
+
+   auto source = fSource->CloneAttached();
+   auto model = fModel ? fModel->Clone() : source->GetSharedDescriptorGuard()->CreateModel();
+
+   // Cannot use std::make_shared because the constructor of RNTupleReadContext is private.
+   std::shared_ptr<RNTupleReadContext> context(new RNTupleReadContext(*this, std::move(model), std::move(source)));
+   fReadContexts.push_back(context);
+   return context;
+}
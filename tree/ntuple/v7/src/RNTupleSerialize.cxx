@@ -35,6 +35,22 @@ using RResult = ROOT::Experimental::RResult<T>;
 namespace {
 using RNTupleSerializer = ROOT::Experimental::Internal::RNTupleSerializer;
 
+/// Doubles are stored as the little-endian integer of their IEEE-754 bit pattern
+std::uint32_t SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   std::memcpy(&bits, &val, sizeof(bits));
+   return RNTupleSerializer::SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t DeserializeDouble(const void *buffer, double &val)
+{
+   std::uint64_t bits;
+   auto nbytes = RNTupleSerializer::DeserializeUInt64(buffer, bits);
+   std::memcpy(&val, &bits, sizeof(val));
+   return nbytes;
+}
+
 std::uint32_t SerializeField(const ROOT::Experimental::RFieldDescriptor &fieldDesc,
                              ROOT::Experimental::DescriptorId_t onDiskParentId, void *buffer)
 {
@@ -183,9 +199,10 @@ std::uint32_t SerializeColumnList(const ROOT::Experimental::RNTupleDescriptor &d
          auto frame = pos;
          pos += RNTupleSerializer::SerializeRecordFramePreamble(*where);
 
-         auto type = c.GetModel().GetType();
+         const auto &model = c.GetModel();
+         auto type = model.GetType();
          pos += RNTupleSerializer::SerializeColumnType(type, *where);
-         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(type), *where);
+         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(model), *where);
          pos += RNTupleSerializer::SerializeUInt32(context.GetOnDiskFieldId(c.GetFieldId()), *where);
          std::uint32_t flags = 0;
          // TODO(jblomer): add support for descending columns in the column model
@@ -197,9 +214,15 @@ std::uint32_t SerializeColumnList(const ROOT::Experimental::RNTupleDescriptor &d
          const std::uint64_t firstElementIdx = c.GetFirstElementIndex();
          if (firstElementIdx > 0)
             flags |= RNTupleSerializer::kFlagDeferredColumn;
+         if (model.GetValueRange())
+            flags |= RNTupleSerializer::kFlagHasValueRange;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
          if (flags & RNTupleSerializer::kFlagDeferredColumn)
             pos += RNTupleSerializer::SerializeUInt64(firstElementIdx, *where);
+         if (flags & RNTupleSerializer::kFlagHasValueRange) {
+            pos += SerializeDouble(model.GetValueRange()->first, *where);
+            pos += SerializeDouble(model.GetValueRange()->second, *where);
+         }
 
          pos += RNTupleSerializer::SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
       }
@@ -228,6 +251,8 @@ RResult<std::uint32_t> DeserializeColumn(const void *buffer, std::uint64_t bufSi
    std::uint32_t fieldId;
    std::uint32_t flags;
    std::uint64_t firstElementIdx = 0;
+   double minValue = 0.0;
+   double maxValue = 0.0;
    if (fnFrameSizeLeft() < RNTupleSerializer::SerializeColumnType(type, nullptr) +
                            sizeof(std::uint16_t) + 2 * sizeof(std::uint32_t))
    {
@@ -245,12 +270,24 @@ RResult<std::uint32_t> DeserializeColumn(const void *buffer, std::uint64_t bufSi
          return R__FAIL("column record frame too short");
       bytes += RNTupleSerializer::DeserializeUInt64(bytes, firstElementIdx);
    }
+   if (flags & RNTupleSerializer::kFlagHasValueRange) {
+      if (fnFrameSizeLeft() < 2 * sizeof(std::uint64_t))
+         return R__FAIL("column record frame too short");
+      bytes += DeserializeDouble(bytes, minValue);
+      bytes += DeserializeDouble(bytes, maxValue);
+   }
 
-   if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage)
+   const auto [minBits, maxBits] = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(type);
+   if (bitsOnStorage < minBits || bitsOnStorage > maxBits)
       return R__FAIL("column element size mismatch");
 
    const bool isSorted = (flags & (RNTupleSerializer::kFlagSortAscColumn | RNTupleSerializer::kFlagSortDesColumn));
-   columnDesc.FieldId(fieldId).Model({type, isSorted}).FirstElementIndex(firstElementIdx);
+   ROOT::Experimental::RColumnModel model{type, isSorted};
+   if (minBits != maxBits)
+      model.SetBitsOnStorage(bitsOnStorage);
+   if (flags & RNTupleSerializer::kFlagHasValueRange)
+      model.SetValueRange(minValue, maxValue);
+   columnDesc.FieldId(fieldId).Model(model).FirstElementIndex(firstElementIdx);
 
    return frameSize;
 }
@@ -528,6 +565,12 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
    case EColumnType::kSplitUInt32: return SerializeUInt16(0x14, buffer);
    case EColumnType::kSplitInt16: return SerializeUInt16(0x1C, buffer);
    case EColumnType::kSplitUInt16: return SerializeUInt16(0x15, buffer);
+   case EColumnType::kDeltaSplitInt64: return SerializeUInt16(0x1D, buffer);
+   case EColumnType::kDeltaSplitUInt64: return SerializeUInt16(0x1E, buffer);
+   case EColumnType::kDeltaSplitInt32: return SerializeUInt16(0x1F, buffer);
+   case EColumnType::kDeltaSplitUInt32: return SerializeUInt16(0x20, buffer);
+   case EColumnType::kReal32Trunc: return SerializeUInt16(0x21, buffer);
+   case EColumnType::kReal32Quant: return SerializeUInt16(0x22, buffer);
    default: throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
 }
@@ -567,6 +610,12 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
    case 0x14: type = EColumnType::kSplitUInt32; break;
    case 0x1C: type = EColumnType::kSplitInt16; break;
    case 0x15: type = EColumnType::kSplitUInt16; break;
+   case 0x1D: type = EColumnType::kDeltaSplitInt64; break;
+   case 0x1E: type = EColumnType::kDeltaSplitUInt64; break;
+   case 0x1F: type = EColumnType::kDeltaSplitInt32; break;
+   case 0x20: type = EColumnType::kDeltaSplitUInt32; break;
+   case 0x21: type = EColumnType::kReal32Trunc; break;
+   case 0x22: type = EColumnType::kReal32Quant; break;
    default: return R__FAIL("unexpected on-disk column type");
    }
    return result;
@@ -1312,6 +1361,18 @@ ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList(void *buffer,
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
 
+         // Optional value statistics, one item per page. The column range has statistics only if all pages have.
+         if (columnRange.fStatistics) {
+            auto statisticsFrame = pos;
+            pos += SerializeListFramePreamble(pageRange.fPageInfos.size(), *where);
+            for (const auto &pi : pageRange.fPageInfos) {
+               pos += SerializeDouble(pi.fStatistics->fMin, *where);
+               pos += SerializeDouble(pi.fStatistics->fMax, *where);
+               pos += SerializeUInt64(pi.fStatistics->fNNulls, *where);
+            }
+            pos += SerializeFramePostscript(buffer ? statisticsFrame : nullptr, pos - statisticsFrame);
+         }
+
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
       pos += SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
@@ -1639,6 +1700,29 @@ ROOT::Experimental::Internal::RNTupleSerializer::DeserializePageList(const void
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         if (fnInnerFrameSizeLeft() > 0) {
+            std::uint64_t statisticsFrameSize;
+            auto statisticsFrame = bytes;
+            auto fnStatisticsFrameSizeLeft = [&]() { return statisticsFrameSize - (bytes - statisticsFrame); };
+
+            std::uint32_t nStatistics;
+            result = DeserializeFrameHeader(bytes, fnInnerFrameSizeLeft(), statisticsFrameSize, nStatistics);
+            if (!result)
+               return R__FORWARD_ERROR(result);
+            bytes += result.Unwrap();
+            if (nStatistics != nPages)
+               return R__FAIL("mismatch between number of pages and number of page statistics");
+            if (fnStatisticsFrameSizeLeft() < nStatistics * (2 * sizeof(double) + sizeof(std::uint64_t)))
+               return R__FAIL("page statistics frame too short");
+            for (auto &pi : pageRange.fPageInfos) {
+               RValueStatistics statistics;
+               bytes += DeserializeDouble(bytes, statistics.fMin);
+               bytes += DeserializeDouble(bytes, statistics.fMax);
+               bytes += DeserializeUInt64(bytes, statistics.fNNulls);
+               pi.fStatistics = statistics;
+            }
+         }
+
          clusterBuilders[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       } // loop over columns
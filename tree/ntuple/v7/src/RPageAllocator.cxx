@@ -18,6 +18,8 @@
 
 #include <TError.h>
 
+#include <algorithm>
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Internal::RPageAllocatorHeap::NewPage(
    ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
 {
@@ -32,3 +34,96 @@ void ROOT::Experimental::Internal::RPageAllocatorHeap::DeletePage(const Detail::
    if (!page.IsPageZero())
       delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t ROOT::Experimental::Internal::RPageAllocatorPool::GetSizeClass(std::size_t nbytes)
+{
+   static constexpr std::size_t kMinSize = 64;
+   if (nbytes <= kMinSize)
+      return kMinSize;
+   std::size_t powerOfTwo = kMinSize;
+   while (powerOfTwo * 2 < nbytes)
+      powerOfTwo *= 2;
+   const auto step = powerOfTwo / 4;
+   return ((nbytes + step - 1) / step) * step;
+}
+
+ROOT::Experimental::Internal::RPageAllocatorPool::RPageAllocatorPool(std::size_t maxCachedBytes)
+   : fMaxCachedBytes(maxCachedBytes), fMetrics("RPageAllocatorPool")
+{
+   fCounters = std::make_unique<RCounters>(RCounters{
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nPageAllocHit", "",
+                                                            "number of pages that recycled a released buffer"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("nPageAllocMiss", "",
+                                                            "number of pages that required a new buffer"),
+      *fMetrics.MakeCounter<Detail::RNTupleAtomicCounter *>("szPeak", "B",
+                                                            "peak memory of page buffers in use or kept for reuse")});
+}
+
+ROOT::Experimental::Internal::RPageAllocatorPool::~RPageAllocatorPool()
+{
+   Trim();
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Internal::RPageAllocatorPool::NewPage(ColumnId_t columnId, std::size_t elementSize,
+                                                          std::size_t nElements)
+{
+   R__ASSERT((elementSize > 0) && (nElements > 0));
+   const auto szClass = GetSizeClass(elementSize * nElements);
+
+   unsigned char *buffer = nullptr;
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      auto itr = fFreeLists.find(szClass);
+      if ((itr != fFreeLists.end()) && !itr->second.empty()) {
+         buffer = itr->second.back();
+         itr->second.pop_back();
+         fSzCached -= szClass;
+         fCounters->fNPageAllocHit.Inc();
+      } else {
+         fCounters->fNPageAllocMiss.Inc();
+      }
+      fSzInUse += szClass;
+      if (fSzInUse + fSzCached > fSzPeak) {
+         fSzPeak = fSzInUse + fSzCached;
+         fCounters->fSzPeak.SetValue(fSzPeak);
+      }
+   }
+
+   if (!buffer)
+      buffer = new unsigned char[szClass];
+   return Detail::RPage(columnId, buffer, elementSize, nElements);
+}
+
+void ROOT::Experimental::Internal::RPageAllocatorPool::DeletePage(const Detail::RPage &page)
+{
+   if (page.IsNull() || page.IsPageZero())
+      return;
+
+   auto buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
+   const auto szClass = GetSizeClass(page.GetElementSize() * page.GetMaxElements());
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      R__ASSERT(fSzInUse >= szClass);
+      fSzInUse -= szClass;
+      if (fSzCached + szClass <= fMaxCachedBytes) {
+         fFreeLists[szClass].emplace_back(buffer);
+         fSzCached += szClass;
+         return;
+      }
+   }
+   delete[] buffer;
+}
+
+void ROOT::Experimental::Internal::RPageAllocatorPool::Trim()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   for (auto &[_, freeList] : fFreeLists) {
+      for (auto buffer : freeList)
+         delete[] buffer;
+   }
+   fFreeLists.clear();
+   fSzCached = 0;
+}
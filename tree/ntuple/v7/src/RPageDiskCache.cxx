@@ -0,0 +1,227 @@
+/// \file RPageDiskCache.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RError.hxx>
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RNTupleSerialize.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageDiskCache.hxx>
+
+#include <TSystem.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace {
+constexpr std::uint64_t kChecksumSize = 8;
+} // anonymous namespace
+
+std::shared_ptr<ROOT::Experimental::Internal::RPageDiskCache>
+ROOT::Experimental::Internal::RPageDiskCache::Get(const std::string &directory, std::uint64_t maxSize,
+                                                  EEviction_t eviction)
+{
+   static std::mutex lock;
+   static std::map<std::string, std::weak_ptr<RPageDiskCache>> instances;
+
+   std::lock_guard<std::mutex> lockGuard(lock);
+   auto instance = instances[directory].lock();
+   if (!instance) {
+      instance = std::make_shared<RPageDiskCache>(directory, maxSize, eviction);
+      instances[directory] = instance;
+   }
+   return instance;
+}
+
+ROOT::Experimental::Internal::RPageDiskCache::RPageDiskCache(const std::string &directory, std::uint64_t maxSize,
+                                                             EEviction_t eviction)
+   : fDirectory(directory), fMaxSize(maxSize), fEviction(eviction)
+{
+   // Note that AccessPathName() returns true if the path is _not_ accessible
+   if (gSystem->AccessPathName(fDirectory.c_str()))
+      gSystem->mkdir(fDirectory.c_str(), kTRUE /* recursive */);
+   if (gSystem->AccessPathName(fDirectory.c_str(), kWritePermission))
+      throw RException(R__FAIL("cannot use disk cache directory " + fDirectory));
+   ScanDirectory();
+}
+
+std::string
+ROOT::Experimental::Internal::RPageDiskCache::GetFileName(std::uint64_t ntupleId, std::uint64_t offset, std::uint64_t size)
+{
+   unsigned char key[3 * sizeof(std::uint64_t)];
+   auto pos = key;
+   pos += RNTupleSerializer::SerializeUInt64(ntupleId, pos);
+   pos += RNTupleSerializer::SerializeUInt64(offset, pos);
+   pos += RNTupleSerializer::SerializeUInt64(size, pos);
+   std::uint64_t xxhash3;
+   unsigned char checksum[kChecksumSize];
+   RNTupleSerializer::SerializeXxHash3(key, pos - key, xxhash3, checksum);
+
+   char name[32];
+   snprintf(name, sizeof(name), "%016llx.page", static_cast<unsigned long long>(xxhash3));
+   return name;
+}
+
+void ROOT::Experimental::Internal::RPageDiskCache::ScanDirectory()
+{
+   auto dirp = gSystem->OpenDirectory(fDirectory.c_str());
+   if (!dirp)
+      return;
+
+   // Temporary files left behind by aborted writes do not end in ".page" and are ignored
+   std::vector<std::pair<Long_t, RFileInfo>> files;
+   const std::string suffix = ".page";
+   while (const char *entry = gSystem->GetDirEntry(dirp)) {
+      std::string name = entry;
+      if (name.size() <= suffix.size() || name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0)
+         continue;
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(GetPath(name).c_str(), stat) != 0)
+         continue;
+      files.emplace_back(stat.fMtime, RFileInfo{name, static_cast<std::uint64_t>(stat.fSize)});
+   }
+   gSystem->FreeDirectory(dirp);
+
+   std::stable_sort(files.begin(), files.end(),
+                    [](const auto &a, const auto &b) { return a.first < b.first; });
+
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   for (const auto &f : files)
+      TouchUnlocked(f.second.fName, f.second.fSize);
+   EvictUnlocked();
+}
+
+void ROOT::Experimental::Internal::RPageDiskCache::TouchUnlocked(const std::string &name, std::uint64_t size)
+{
+   auto itr = fIndex.find(name);
+   if (itr == fIndex.end()) {
+      fQueue.push_back(RFileInfo{name, size});
+      fIndex[name] = std::prev(fQueue.end());
+      fSize += size;
+      return;
+   }
+   if (fEviction == EEviction_t::kLRU)
+      fQueue.splice(fQueue.end(), fQueue, itr->second);
+}
+
+void ROOT::Experimental::Internal::RPageDiskCache::RemoveUnlocked(const std::string &name)
+{
+   auto itr = fIndex.find(name);
+   if (itr == fIndex.end())
+      return;
+   fSize -= itr->second->fSize;
+   fQueue.erase(itr->second);
+   fIndex.erase(itr);
+}
+
+void ROOT::Experimental::Internal::RPageDiskCache::EvictUnlocked()
+{
+   while ((fSize > fMaxSize) && !fQueue.empty()) {
+      const auto &victim = fQueue.front();
+      // The file may have already been removed by another process
+      gSystem->Unlink(GetPath(victim.fName).c_str());
+      fSize -= victim.fSize;
+      fIndex.erase(victim.fName);
+      fQueue.pop_front();
+   }
+}
+
+bool ROOT::Experimental::Internal::RPageDiskCache::Read(const std::string &name, void *buffer, std::uint64_t size)
+{
+   const auto path = GetPath(name);
+   FILE *f = fopen(path.c_str(), "rb");
+   if (!f) {
+      // Possibly evicted by another process
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      RemoveUnlocked(name);
+      return false;
+   }
+
+   unsigned char checksum[kChecksumSize];
+   bool isValid = (fread(buffer, 1, size, f) == size) && (fread(checksum, 1, kChecksumSize, f) == kChecksumSize) &&
+                  (fgetc(f) == EOF);
+   fclose(f);
+   if (isValid) {
+      std::uint64_t xxhash3Stored;
+      std::uint64_t xxhash3Real;
+      unsigned char scratch[kChecksumSize];
+      RNTupleSerializer::DeserializeUInt64(checksum, xxhash3Stored);
+      RNTupleSerializer::SerializeXxHash3(static_cast<const unsigned char *>(buffer), size, xxhash3Real, scratch);
+      isValid = (xxhash3Stored == xxhash3Real);
+   }
+
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   if (!isValid) {
+      R__LOG_WARNING(NTupleLog()) << "removing corrupt page from disk cache: " << path;
+      gSystem->Unlink(path.c_str());
+      RemoveUnlocked(name);
+      return false;
+   }
+
+   if (fEviction == EEviction_t::kLRU) {
+      const auto now = static_cast<Long_t>(time(nullptr));
+      gSystem->Utime(path.c_str(), now, now);
+   }
+   // The file may have been written by another process after the directory scan
+   TouchUnlocked(name, size + kChecksumSize);
+   EvictUnlocked();
+   return true;
+}
+
+bool ROOT::Experimental::Internal::RPageDiskCache::Write(const std::string &name, const void *buffer,
+                                                         std::uint64_t size)
+{
+   if (size + kChecksumSize > fMaxSize)
+      return false;
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      if (fIndex.count(name) > 0)
+         return false;
+   }
+
+   const auto path = GetPath(name);
+   const auto tmpPath = path + ".tmp." + std::to_string(gSystem->GetPid()) + "." + std::to_string(fNTmpFiles++);
+   FILE *f = fopen(tmpPath.c_str(), "wb");
+   if (!f)
+      return false;
+
+   std::uint64_t xxhash3;
+   unsigned char checksum[kChecksumSize];
+   RNTupleSerializer::SerializeXxHash3(static_cast<const unsigned char *>(buffer), size, xxhash3, checksum);
+   bool isWritten = (fwrite(buffer, 1, size, f) == size) && (fwrite(checksum, 1, kChecksumSize, f) == kChecksumSize);
+   isWritten = (fclose(f) == 0) && isWritten;
+   if (!isWritten || (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0)) {
+      gSystem->Unlink(tmpPath.c_str());
+      return false;
+   }
+
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   TouchUnlocked(name, size + kChecksumSize);
+   EvictUnlocked();
+   return true;
+}
+
+std::uint64_t ROOT::Experimental::Internal::RPageDiskCache::GetSize()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fSize;
+}
+
+std::uint64_t ROOT::Experimental::Internal::RPageDiskCache::GetNFiles()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fIndex.size();
+}
@@ -15,12 +15,14 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 
 #include <algorithm>
+#include <exception>
 #include <memory>
 
 void ROOT::Experimental::Detail::RPageSinkBuf::RColumnBuf::DropBufferedPages()
@@ -47,6 +49,7 @@ ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink
                 *fMetrics.MakeCounter<RNTupleTickCounter<RNTuplePlainCounter> *>(
                    "timeCpuCriticalSection", "ns", "CPU time spent in critical section")});
    fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
+   fOpenCluster = std::make_unique<RPendingCluster>();
 }
 
 ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
@@ -55,6 +58,35 @@ ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
    // This cannot be moved to the base class destructor, given non-static members have been destroyed by the time the
    // base class destructor is invoked.
    WaitForAllTasks();
+
+   std::lock_guard<std::mutex> g(fPendingLock);
+   // An error of the last commits may not have reached the filling thread
+   if (fCommitError && !fCommitErrorReported) {
+      try {
+         std::rethrow_exception(fCommitError);
+      } catch (const RException &err) {
+         R__LOG_ERROR(NTupleLog()) << "failure committing ntuple: " << err.GetError().GetReport();
+      } catch (const std::exception &err) {
+         R__LOG_ERROR(NTupleLog()) << "failure committing ntuple: " << err.what();
+      } catch (...) {
+         R__LOG_ERROR(NTupleLog()) << "failure committing ntuple";
+      }
+   }
+
+   // After a failed commit, the pending clusters are never written.  Their pages are released through the inner sink
+   // because the columns that buffered them may already be destructed.
+   if (fOpenCluster)
+      fPendingClusters.emplace_back(std::move(fOpenCluster));
+   for (auto &cluster : fPendingClusters) {
+      for (auto &bufColumn : cluster->fBufferedColumns) {
+         auto drained = bufColumn.DrainBufferedPages();
+         for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
+            if (!bufPage.fPage.IsNull())
+               fInnerSink->ReleasePage(bufPage.fPage);
+         }
+      }
+   }
+   fPendingClusters.clear();
 }
 
 ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
@@ -71,6 +103,7 @@ void ROOT::Experimental::Detail::RPageSinkBuf::ConnectFields(const std::vector<R
       ++fNFields;
       f.SetOnDiskId(fNFields);
       f.ConnectPageSink(*this, firstEntry); // issues in turn one or several calls to `AddColumn()`
+      SetColumnCompression(f, fNColumns);
    };
    for (auto *f : fields) {
       connectField(*f);
@@ -78,7 +111,7 @@ void ROOT::Experimental::Detail::RPageSinkBuf::ConnectFields(const std::vector<R
          connectField(descendant);
       }
    }
-   fBufferedColumns.resize(fNColumns);
+   fOpenCluster->fBufferedColumns.resize(fNColumns);
 }
 
 void ROOT::Experimental::Detail::RPageSinkBuf::Init(RNTupleModel &model)
@@ -92,6 +125,8 @@ void ROOT::Experimental::Detail::RPageSinkBuf::Init(RNTupleModel &model)
 void ROOT::Experimental::Detail::RPageSinkBuf::UpdateSchema(const RNTupleModelChangeset &changeset,
                                                             NTupleSize_t firstEntry)
 {
+   // The inner sink can only be extended after all previous clusters have been written
+   CommitPendingClusters();
    ConnectFields(changeset.fAddedFields, firstEntry);
 
    // The buffered page sink maintains a copy of the RNTupleModel for the inner sink; replicate the changes there
@@ -131,17 +166,19 @@ void ROOT::Experimental::Detail::RPageSinkBuf::CommitPage(ColumnHandle_t columnH
 
    // Safety: References are guaranteed to be valid until the
    // element is destroyed. In other words, all buffered page elements are
-   // valid until the return value of DrainBufferedPages() goes out of scope in
-   // CommitCluster().
-   auto &zipItem = fBufferedColumns.at(colId).BufferPage(columnHandle);
+   // valid until the pending cluster is written to the inner sink in CommitSealedClusters().
+   auto &bufColumn = fOpenCluster->fBufferedColumns.at(colId);
+   auto &zipItem = bufColumn.BufferPage(columnHandle);
    zipItem.AllocateSealedPageBuf(page.GetNBytes());
    R__ASSERT(zipItem.fBuf);
-   auto &sealedPage = fBufferedColumns.at(colId).RegisterSealedPage();
+   auto &sealedPage = bufColumn.RegisterSealedPage();
+   auto statistics = ComputeStatistics(columnHandle, page);
+   const auto compression = GetColumnCompression(columnHandle, page);
 
    if (!fTaskScheduler) {
       // Seal the page right now, avoiding the allocation and copy, but making sure that the page buffer is not aliased.
-      sealedPage =
-         SealPage(page, element, GetWriteOptions().GetCompression(), zipItem.fBuf.get(), /*allowAlias=*/false);
+      sealedPage = SealPage(page, element, compression, zipItem.fBuf.get(), /*allowAlias=*/false);
+      sealedPage.fStatistics = statistics;
       zipItem.fSealedPage = &sealedPage;
       return;
    }
@@ -155,9 +192,15 @@ void ROOT::Experimental::Detail::RPageSinkBuf::CommitPage(ColumnHandle_t columnH
    fCounters->fParallelZip.SetValue(1);
    // Thread safety: Each thread works on a distinct zipItem which owns its
    // compression buffer.
-   fTaskScheduler->AddTask([this, &zipItem, &sealedPage, &element] {
-      sealedPage = SealPage(zipItem.fPage, element, GetWriteOptions().GetCompression(), zipItem.fBuf.get());
+   auto cluster = fOpenCluster.get();
+   cluster->fNUnsealedPages++;
+   fTaskScheduler->AddTask([this, cluster, &zipItem, &sealedPage, &element, statistics, compression] {
+      sealedPage = SealPage(zipItem.fPage, element, compression, zipItem.fBuf.get());
+      sealedPage.fStatistics = statistics;
       zipItem.fSealedPage = &sealedPage;
+      // The cluster must not be accessed anymore after the counter is decremented
+      if (--cluster->fNUnsealedPages == 0)
+         CommitSealedClusters();
    });
 }
 
@@ -172,34 +215,85 @@ void ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageV(std::span<RPage
    throw RException(R__FAIL("should never commit sealed pages to RPageSinkBuf"));
 }
 
-std::uint64_t ROOT::Experimental::Detail::RPageSinkBuf::CommitCluster(ROOT::Experimental::NTupleSize_t nNewEntries)
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedClusters()
 {
-   WaitForAllTasks();
+   std::lock_guard<std::mutex> g(fPendingLock);
+   while (!fCommitError && !fPendingClusters.empty() && fPendingClusters.front()->fNUnsealedPages == 0) {
+      auto &cluster = *fPendingClusters.front();
+      std::vector<RSealedPageGroup> toCommit;
+      toCommit.reserve(cluster.fBufferedColumns.size());
+      for (auto &bufColumn : cluster.fBufferedColumns) {
+         R__ASSERT(bufColumn.HasSealedPagesOnly());
+         const auto &sealedPages = bufColumn.GetSealedPages();
+         toCommit.emplace_back(bufColumn.GetHandle().fPhysicalId, sealedPages.cbegin(), sealedPages.cend());
+      }
+
+      try {
+         RPageSink::RSinkGuard sinkGuard(fInnerSink->GetSinkGuard());
+         RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
+         fInnerSink->CommitSealedPageV(toCommit);
 
-   std::vector<RSealedPageGroup> toCommit;
-   toCommit.reserve(fBufferedColumns.size());
-   for (auto &bufColumn : fBufferedColumns) {
-      R__ASSERT(bufColumn.HasSealedPagesOnly());
-      const auto &sealedPages = bufColumn.GetSealedPages();
-      toCommit.emplace_back(bufColumn.GetHandle().fPhysicalId, sealedPages.cbegin(), sealedPages.cend());
+         fNBytesCommitted += fInnerSink->CommitCluster(cluster.fNEntries);
+      } catch (...) {
+         // This may run in a concurrent task; the error is rethrown by the next commit of the filling thread
+         fCommitError = std::current_exception();
+         return;
+      }
+
+      // Releases the buffered pages
+      fPendingClusters.pop_front();
    }
+}
 
-   std::uint64_t nbytes;
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitPendingClusters()
+{
+   WaitForAllTasks();
+   CommitSealedClusters();
+
+   std::lock_guard<std::mutex> g(fPendingLock);
+   ThrowOnCommitError();
+   R__ASSERT(fPendingClusters.empty());
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::ThrowOnCommitError()
+{
+   if (!fCommitError)
+      return;
+   fCommitErrorReported = true;
+   std::rethrow_exception(fCommitError);
+}
+
+std::uint64_t ROOT::Experimental::Detail::RPageSinkBuf::CommitCluster(ROOT::Experimental::NTupleSize_t nNewEntries)
+{
+   auto cluster = fOpenCluster.get();
+   cluster->fNEntries = nNewEntries;
+   std::size_t nPendingClusters;
    {
-      RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
-      RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
-      fInnerSink->CommitSealedPageV(toCommit);
+      std::lock_guard<std::mutex> g(fPendingLock);
+      fPendingClusters.emplace_back(std::move(fOpenCluster));
+      nPendingClusters = fPendingClusters.size();
+   }
+   fOpenCluster = std::make_unique<RPendingCluster>();
+   fOpenCluster->fBufferedColumns.resize(fNColumns);
+   ResetStatistics();
 
-      nbytes = fInnerSink->CommitCluster(nNewEntries);
+   // Without concurrent sealing tasks, the cluster is written right away.  Otherwise, it is written by the task
+   // that seals its last page, unless the number of clusters in flight exceeds the limit.
+   if (--cluster->fNUnsealedPages == 0)
+      CommitSealedClusters();
+   if (nPendingClusters > GetWriteOptions().GetMaxInFlightClusters()) {
+      CommitPendingClusters();
+   } else {
+      std::lock_guard<std::mutex> g(fPendingLock);
+      ThrowOnCommitError();
    }
 
-   for (auto &bufColumn : fBufferedColumns)
-      bufColumn.DropBufferedPages();
-   return nbytes;
+   return fNBytesCommitted.exchange(0);
 }
 
 void ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterGroup()
 {
+   CommitPendingClusters();
    RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
    RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
    fInnerSink->CommitClusterGroup();
@@ -207,6 +301,7 @@ void ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterGroup()
 
 void ROOT::Experimental::Detail::RPageSinkBuf::CommitDataset()
 {
+   CommitPendingClusters();
    RPageSink::RSinkGuard g(fInnerSink->GetSinkGuard());
    RNTuplePlainTimer timer(fCounters->fTimeWallCriticalSection, fCounters->fTimeCpuCriticalSection);
    fInnerSink->CommitDataset();
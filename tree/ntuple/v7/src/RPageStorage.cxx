@@ -23,6 +23,8 @@
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string_view>
 #ifdef R__ENABLE_DAOS
@@ -91,7 +93,9 @@ bool ROOT::Experimental::Detail::RPageSource::REntryRange::IntersectsWith(const
 }
 
 ROOT::Experimental::Detail::RPageSource::RPageSource(std::string_view name, const RNTupleReadOptions &options)
-   : RPageStorage(name), fOptions(options)
+   : RPageStorage(name),
+     fOptions(options),
+     fPageAllocator(std::make_shared<Internal::RPageAllocatorPool>(options.GetMaxPooledPageMemory()))
 {
 }
 
@@ -133,6 +137,27 @@ void ROOT::Experimental::Detail::RPageSource::DropColumn(ColumnHandle_t columnHa
    fActivePhysicalColumns.Erase(columnHandle.fPhysicalId);
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RPageSource>
+ROOT::Experimental::Detail::RPageSource::CloneAttached() const
+{
+   auto clone = Clone();
+   if (CanAttachFromDescriptor()) {
+      auto desc = GetSharedDescriptorGuard()->Clone();
+      clone->GetExclDescriptorGuard().MoveIn(std::move(*desc));
+   } else {
+      clone->Attach();
+   }
+   return clone;
+}
+
+void ROOT::Experimental::Detail::RPageSource::LoadClustersIncrementally(std::span<RCluster::RKey> clusterKeys,
+                                                                        const ROnClusterLoaded_t &onLoaded)
+{
+   auto clusters = LoadClusters(clusterKeys);
+   for (std::size_t i = 0; i < clusters.size(); ++i)
+      onLoaded(i, std::move(clusters[i]));
+}
+
 void ROOT::Experimental::Detail::RPageSource::SetEntryRange(const REntryRange &range)
 {
    if ((range.fFirstEntry + range.fNEntries) > GetNEntries()) {
@@ -176,8 +201,7 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
    }
 
    const auto bytesPacked = element.GetPackedSize(sealedPage.fNElements);
-   using Allocator_t = Internal::RPageAllocatorHeap;
-   auto page = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
+   auto page = fPageAllocator->NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
    if (sealedPage.fSize != bytesPacked) {
       fDecompressor->Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, page.GetBuffer());
    } else {
@@ -188,9 +212,9 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
    }
 
    if (!element.IsMappable()) {
-      auto tmp = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
+      auto tmp = fPageAllocator->NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
       element.Unpack(tmp.GetBuffer(), page.GetBuffer(), sealedPage.fNElements);
-      Allocator_t::DeletePage(page);
+      fPageAllocator->DeletePage(page);
       page = tmp;
    }
 
@@ -310,6 +334,7 @@ void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::st
          }
       )
    });
+   fMetrics.ObserveMetrics(fPageAllocator->GetMetrics());
 }
 
 
@@ -375,7 +400,9 @@ ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page, const RColumn
 
    R__ASSERT(isAdoptedBuffer);
 
-   return RSealedPage{pageBuf, static_cast<std::uint32_t>(zippedBytes), page.GetNElements()};
+   RSealedPage sealedPage{pageBuf, static_cast<std::uint32_t>(zippedBytes), page.GetNElements()};
+   sealedPage.fCompressionSettings = compressionSetting;
+   return sealedPage;
 }
 
 ROOT::Experimental::Detail::RPageStorage::RSealedPage
@@ -386,6 +413,106 @@ ROOT::Experimental::Detail::RPageSink::SealPage(
    return SealPage(page, element, compressionSetting, fCompressor->GetZipBuffer());
 }
 
+void ROOT::Experimental::Detail::RPageSink::SetColumnCompression(const RFieldBase &field, std::size_t nColumns)
+{
+   auto compression = field.GetCompression();
+   if (!compression)
+      compression = fOptions->GetUseAutoCompression() ? kAutoCompression : fOptions->GetCompression();
+   if (nColumns > fColumnCompression.size())
+      fColumnCompression.resize(nColumns, *compression);
+}
+
+int ROOT::Experimental::Detail::RPageSink::GetColumnCompression(ColumnHandle_t columnHandle, const RPage &page)
+{
+   if (columnHandle.fPhysicalId >= fColumnCompression.size())
+      return fOptions->GetCompression();
+   auto &compression = fColumnCompression[columnHandle.fPhysicalId];
+   if (compression == kAutoCompression)
+      compression = SelectCompression(page, *columnHandle.fColumn->GetElement());
+   return compression;
+}
+
+int ROOT::Experimental::Detail::RPageSink::SelectCompression(const RPage &page, const RColumnElementBase &element) const
+{
+   // A more expensive candidate needs to shrink the page by at least this fraction compared to the cheaper selection
+   static constexpr double kMinSavings = 0.05;
+
+   struct RTrial {
+      int fCompression = 0;
+      std::size_t fSize = 0;
+      double fNsPerByte = 0.;
+   };
+   if (page.GetNBytes() == 0)
+      return 0;
+   std::vector<RTrial> trials{RTrial{0, element.GetPackedSize(page.GetNElements()), 0.}};
+
+   // The sealed page never exceeds the size of the unpacked page
+   auto buf = std::make_unique<unsigned char[]>(page.GetNBytes());
+   for (auto compression : fOptions->GetAutoCompressionCandidates()) {
+      const auto start = std::chrono::steady_clock::now();
+      const auto sealedPage = SealPage(page, element, compression, buf.get(), /*allowAlias=*/false);
+      const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+      const double nsPerByte = elapsed.count() / page.GetNBytes();
+      if (nsPerByte <= fOptions->GetAutoCompressionCpuBudget())
+         trials.emplace_back(RTrial{compression, sealedPage.fSize, nsPerByte});
+   }
+
+   std::stable_sort(trials.begin() + 1, trials.end(),
+                    [](const RTrial &a, const RTrial &b) { return a.fNsPerByte < b.fNsPerByte; });
+   auto selected = trials[0];
+   for (const auto &t : trials) {
+      if (t.fSize < (1. - kMinSavings) * selected.fSize)
+         selected = t;
+   }
+   return selected.fCompression;
+}
+
+std::optional<ROOT::Experimental::RValueStatistics>
+ROOT::Experimental::Detail::RPageSink::ComputeStatistics(ColumnHandle_t columnHandle, const RPage &page)
+{
+   if (!fOptions->GetEnableValueStatistics())
+      return std::nullopt;
+
+   RValueStatistics statistics;
+   switch (columnHandle.fColumn->GetModel().GetType()) {
+   case EColumnType::kIndex64:
+   case EColumnType::kIndex32:
+   case EColumnType::kSplitIndex64:
+   case EColumnType::kSplitIndex32: {
+      // Offset columns: the statistics describe the collection sizes, i.e. the differences of consecutive offsets
+      if (fLastOffsets.size() <= columnHandle.fPhysicalId)
+         fLastOffsets.resize(columnHandle.fPhysicalId + 1, 0);
+      auto &lastOffset = fLastOffsets[columnHandle.fPhysicalId];
+      const auto offsets = reinterpret_cast<const ClusterSize_t *>(page.GetBuffer());
+      for (std::size_t i = 0; i < page.GetNElements(); ++i) {
+         const auto size = static_cast<double>(offsets[i] - lastOffset);
+         statistics.fMin = std::min(statistics.fMin, size);
+         statistics.fMax = std::max(statistics.fMax, size);
+         statistics.fNNulls += (offsets[i] == lastOffset);
+         lastOffset = offsets[i];
+      }
+      return statistics;
+   }
+   default: {
+      const auto element = columnHandle.fColumn->GetElement();
+      if (!element->IsLossy()) {
+         if (element->ComputeStatistics(page.GetBuffer(), page.GetNElements(), statistics))
+            return statistics;
+         return std::nullopt;
+      }
+      // The readers compare against the stored values, which may lie outside the range of the values in memory
+      const auto nElements = page.GetNElements();
+      auto packed = std::make_unique<unsigned char[]>(element->GetPackedSize(nElements));
+      auto unpacked = std::make_unique<unsigned char[]>(element->GetSize() * nElements);
+      element->Pack(packed.get(), page.GetBuffer(), nElements);
+      element->Unpack(unpacked.get(), packed.get(), nElements);
+      if (element->ComputeStatistics(unpacked.get(), nElements, statistics))
+         return statistics;
+      return std::nullopt;
+   }
+   }
+}
+
 //------------------------------------------------------------------------------
 
 ROOT::Experimental::Detail::RPagePersistentSink::RPagePersistentSink(std::string_view name,
@@ -416,6 +543,7 @@ void ROOT::Experimental::Detail::RPagePersistentSink::UpdateSchema(const RNTuple
       fDescriptorBuilder.AddFieldLink(f.GetParent()->GetOnDiskId(), fieldId);
       f.SetOnDiskId(fieldId);
       f.ConnectPageSink(*this, firstEntry); // issues in turn one or several calls to `AddColumn()`
+      SetColumnCompression(f, descriptor.GetNPhysicalColumns());
    };
    auto addProjectedField = [&](RFieldBase &f) {
       auto fieldId = descriptor.GetNFields();
@@ -494,9 +622,12 @@ void ROOT::Experimental::Detail::RPagePersistentSink::Init(RNTupleModel &model)
 void ROOT::Experimental::Detail::RPagePersistentSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
    fOpenColumnRanges.at(columnHandle.fPhysicalId).fNElements += page.GetNElements();
+   // In automatic compression mode, this selects the column's compression before the page is sealed
+   fOpenColumnRanges.at(columnHandle.fPhysicalId).fCompressionSettings = GetColumnCompression(columnHandle, page);
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
+   pageInfo.fStatistics = ComputeStatistics(columnHandle, page);
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
    fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos.emplace_back(pageInfo);
 }
@@ -506,9 +637,12 @@ void ROOT::Experimental::Detail::RPagePersistentSink::CommitSealedPage(
    const ROOT::Experimental::Detail::RPageStorage::RSealedPage &sealedPage)
 {
    fOpenColumnRanges.at(physicalColumnId).fNElements += sealedPage.fNElements;
+   if (sealedPage.fCompressionSettings)
+      fOpenColumnRanges.at(physicalColumnId).fCompressionSettings = *sealedPage.fCompressionSettings;
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fStatistics = sealedPage.fStatistics;
    pageInfo.fLocator = CommitSealedPageImpl(physicalColumnId, sealedPage);
    fOpenPageRanges.at(physicalColumnId).fPageInfos.emplace_back(pageInfo);
 }
@@ -533,9 +667,12 @@ void ROOT::Experimental::Detail::RPagePersistentSink::CommitSealedPageV(
    for (auto &range : ranges) {
       for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
          fOpenColumnRanges.at(range.fPhysicalColumnId).fNElements += sealedPageIt->fNElements;
+         if (sealedPageIt->fCompressionSettings)
+            fOpenColumnRanges.at(range.fPhysicalColumnId).fCompressionSettings = *sealedPageIt->fCompressionSettings;
 
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
+         pageInfo.fStatistics = sealedPageIt->fStatistics;
          pageInfo.fLocator = locators[i++];
          fOpenPageRanges.at(range.fPhysicalColumnId).fPageInfos.emplace_back(pageInfo);
       }
@@ -562,6 +699,7 @@ ROOT::Experimental::Detail::RPagePersistentSink::CommitCluster(ROOT::Experimenta
    }
    fDescriptorBuilder.AddCluster(clusterBuilder.MoveDescriptor().Unwrap());
    fPrevClusterNEntries += nNewEntries;
+   ResetStatistics();
    return nbytes;
 }
 
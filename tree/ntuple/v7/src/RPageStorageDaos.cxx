@@ -283,7 +283,8 @@ std::uint32_t ROOT::Experimental::Detail::RDaosNTupleAnchor::GetSize()
 
 ROOT::Experimental::Detail::RPageSinkDaos::RPageSinkDaos(std::string_view ntupleName, std::string_view uri,
                                                          const RNTupleWriteOptions &options)
-   : RPagePersistentSink(ntupleName, options), fPageAllocator(std::make_unique<Internal::RPageAllocatorHeap>()),
+   : RPagePersistentSink(ntupleName, options),
+     fPageAllocator(std::make_unique<Internal::RPageAllocatorPool>(options.GetMaxPooledPageMemory())),
      fURI(uri)
 {
    static std::once_flag once;
@@ -293,6 +294,7 @@ ROOT::Experimental::Detail::RPageSinkDaos::RPageSinkDaos(std::string_view ntuple
    });
    fCompressor = std::make_unique<Internal::RNTupleCompressor>();
    EnableDefaultMetrics("RPageSinkDaos");
+   fMetrics.ObserveMetrics(fPageAllocator->GetMetrics());
 }
 
 ROOT::Experimental::Detail::RPageSinkDaos::~RPageSinkDaos() = default;
@@ -332,7 +334,7 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitPageImpl(ColumnHandle_t columnH
    RPageStorage::RSealedPage sealedPage;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallZip, fCounters->fTimeCpuZip);
-      sealedPage = SealPage(page, *element, GetWriteOptions().GetCompression());
+      sealedPage = SealPage(page, *element, GetColumnCompression(columnHandle, page));
    }
 
    fCounters->fSzZip.Add(page.GetNBytes());
@@ -517,10 +519,11 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
    : RPageSource(ntupleName, options),
      fPagePool(std::make_shared<Internal::RPagePool>()),
      fURI(uri),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(std::make_unique<RClusterPool>(*this, options))
 {
    fDecompressor = std::make_unique<Internal::RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceDaos");
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 
    auto args = ParseDaosURI(uri);
    auto pool = std::make_shared<Internal::RDaosPool>(args.fPoolLabel);
@@ -667,9 +670,9 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
    fPagePool->RegisterPage(
-      newPage,
-      Internal::RPageDeleter([](const RPage &page, void *) { Internal::RPageAllocatorHeap::DeletePage(page); },
-                             nullptr));
+      newPage, Internal::RPageDeleter(
+                  [pageAllocator = fPageAllocator](const RPage &page, void *) { pageAllocator->DeletePage(page); },
+                  nullptr));
    fCounters->fNPagePopulated.Inc();
    return newPage;
 }
@@ -850,7 +853,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -868,9 +871,9 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
 
             newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
             fPagePool->PreloadPage(
-               newPage,
-               Internal::RPageDeleter([](const RPage &page, void *) { Internal::RPageAllocatorHeap::DeletePage(page); },
-                            nullptr));
+               newPage, Internal::RPageDeleter([pageAllocator = fPageAllocator](
+                                                  const RPage &page, void *) { pageAllocator->DeletePage(page); },
+                                               nullptr));
          };
 
          fTaskScheduler->AddTask(taskFunc);
@@ -23,18 +23,22 @@
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPage.hxx>
 #include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageDiskCache.hxx>
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RSharedPageCache.hxx>
 
 #include <RVersion.h>
 #include <TError.h>
 #include <TFile.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -45,10 +49,14 @@
 #include <mutex>
 #include <thread>
 #include <queue>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 
 ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntupleName,
                                                          const RNTupleWriteOptions &options)
-   : RPagePersistentSink(ntupleName, options), fPageAllocator(std::make_unique<Internal::RPageAllocatorHeap>())
+   : RPagePersistentSink(ntupleName, options),
+     fPageAllocator(std::make_unique<Internal::RPageAllocatorPool>(options.GetMaxPooledPageMemory()))
 {
    static std::once_flag once;
    std::call_once(once, []() {
@@ -57,6 +65,16 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
    });
    fCompressor = std::make_unique<Internal::RNTupleCompressor>();
    EnableDefaultMetrics("RPageSinkFile");
+   fAsyncWriteCounters = std::make_unique<RAsyncWriteCounters>(RAsyncWriteCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nWriteQueueStall", "",
+                                                    "number of times committing pages waited for a full write queue"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("timeWallWriteQueueStall", "ns",
+                                                    "wall clock time spent waiting for a full write queue"),
+      *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter> *>(
+         "timeCpuWriteQueueStall", "ns", "CPU time spent waiting for a full write queue"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("szWriteQueued", "B",
+                                                    "volume handed over to the background I/O thread")});
+   fMetrics.ObserveMetrics(fPageAllocator->GetMetrics());
 }
 
 
@@ -66,6 +84,8 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
 {
    fWriter = std::unique_ptr<Internal::RNTupleFileWriter>(Internal::RNTupleFileWriter::Recreate(
       ntupleName, path, options.GetCompression(), options.GetContainerFormat()));
+   if (options.GetMaxAsyncWriteBytes() > 0)
+      fThreadIo = std::thread(&RPageSinkFile::ExecWrite, this);
 }
 
 
@@ -79,6 +99,78 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
 
 ROOT::Experimental::Detail::RPageSinkFile::~RPageSinkFile()
 {
+   if (fThreadIo.joinable()) {
+      {
+         std::lock_guard<std::mutex> g(fLockWriteQueue);
+         fIsShutdown = true;
+      }
+      fCvHasWriteWork.notify_one();
+      fThreadIo.join();
+   }
+}
+
+void ROOT::Experimental::Detail::RPageSinkFile::ExecWrite()
+{
+   while (true) {
+      std::unique_lock<std::mutex> lock(fLockWriteQueue);
+      fCvHasWriteWork.wait(lock, [&] { return fIsShutdown || !fWriteQueue.empty(); });
+      // On shutdown, the pending requests are still written
+      if (fWriteQueue.empty())
+         return;
+      auto request = std::move(fWriteQueue.front());
+      fWriteQueue.pop_front();
+      const bool hasError = static_cast<bool>(fWriteError);
+      lock.unlock();
+
+      if (!hasError) {
+         try {
+            RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+            std::lock_guard<std::mutex> g(fLockWriter);
+            fWriter->WriteIntoReservedBlob(request.fBuffer.get(), request.fSize, request.fOffset);
+         } catch (...) {
+            lock.lock();
+            fWriteError = std::current_exception();
+            lock.unlock();
+         }
+      }
+
+      lock.lock();
+      fNBytesQueued -= request.fSize;
+      lock.unlock();
+      fCvWriteDone.notify_all();
+   }
+}
+
+void ROOT::Experimental::Detail::RPageSinkFile::EnqueueWrite(RWriteRequest &&request)
+{
+   const auto maxBytes = GetWriteOptions().GetMaxAsyncWriteBytes();
+   std::unique_lock<std::mutex> lock(fLockWriteQueue);
+   // A request larger than the queue limit is accepted once the queue is empty
+   auto fnHasRoom = [&] { return fWriteError || fNBytesQueued == 0 || fNBytesQueued + request.fSize <= maxBytes; };
+   if (!fnHasRoom()) {
+      fAsyncWriteCounters->fNWriteQueueStall.Inc();
+      RNTupleAtomicTimer timer(fAsyncWriteCounters->fTimeWallWriteQueueStall,
+                               fAsyncWriteCounters->fTimeCpuWriteQueueStall);
+      fCvWriteDone.wait(lock, fnHasRoom);
+   }
+   if (fWriteError)
+      std::rethrow_exception(fWriteError);
+
+   fAsyncWriteCounters->fSzWriteQueued.Add(request.fSize);
+   fNBytesQueued += request.fSize;
+   fWriteQueue.emplace_back(std::move(request));
+   lock.unlock();
+   fCvHasWriteWork.notify_one();
+}
+
+void ROOT::Experimental::Detail::RPageSinkFile::DrainWriteQueue()
+{
+   if (!fThreadIo.joinable())
+      return;
+   std::unique_lock<std::mutex> lock(fLockWriteQueue);
+   fCvWriteDone.wait(lock, [&] { return fNBytesQueued == 0; });
+   if (fWriteError)
+      std::rethrow_exception(fWriteError);
 }
 
 void ROOT::Experimental::Detail::RPageSinkFile::InitImpl(unsigned char *serializedHeader, std::uint32_t length)
@@ -86,6 +178,7 @@ void ROOT::Experimental::Detail::RPageSinkFile::InitImpl(unsigned char *serializ
    auto zipBuffer = std::make_unique<unsigned char[]>(length);
    auto szZipHeader = fCompressor->Zip(serializedHeader, length, GetWriteOptions().GetCompression(),
                                        Internal::RNTupleCompressor::MakeMemCopyWriter(zipBuffer.get()));
+   std::lock_guard<std::mutex> g(fLockWriter);
    fWriter->WriteNTupleHeader(zipBuffer.get(), szZipHeader, length);
 }
 
@@ -95,7 +188,18 @@ ROOT::Experimental::Detail::RPageSinkFile::WriteSealedPage(
    const RPageStorage::RSealedPage &sealedPage, std::size_t bytesPacked)
 {
    std::uint64_t offsetData;
-   {
+   if (fThreadIo.joinable()) {
+      {
+         std::lock_guard<std::mutex> g(fLockWriter);
+         offsetData = fWriter->ReserveBlob(sealedPage.fSize, bytesPacked);
+      }
+      RWriteRequest request;
+      request.fBuffer = std::make_unique<unsigned char[]>(sealedPage.fSize);
+      memcpy(request.fBuffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+      request.fSize = sealedPage.fSize;
+      request.fOffset = offsetData;
+      EnqueueWrite(std::move(request));
+   } else {
       RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
       offsetData = fWriter->WriteBlob(sealedPage.fBuffer, sealedPage.fSize, bytesPacked);
    }
@@ -117,7 +221,7 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnH
    RPageStorage::RSealedPage sealedPage;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallZip, fCounters->fTimeCpuZip);
-      sealedPage = SealPage(page, *element, GetWriteOptions().GetCompression());
+      sealedPage = SealPage(page, *element, GetColumnCompression(columnHandle, page));
    }
 
    fCounters->fSzZip.Add(page.GetNBytes());
@@ -129,7 +233,7 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t p
                                                                 const RPageStorage::RSealedPage &sealedPage)
 {
    const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel().GetType());
+      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel());
    const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
 
    return WriteSealedPage(sealedPage, bytesPacked);
@@ -146,7 +250,7 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageVImpl(std::span<RPage
       }
 
       const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-         fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(range.fPhysicalColumnId).GetModel().GetType());
+         fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(range.fPhysicalColumnId).GetModel());
       for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
          size += sealedPageIt->fSize;
          bytesPacked += (bitsOnStorage * sealedPageIt->fNElements + 7) / 8;
@@ -158,20 +262,43 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageVImpl(std::span<RPage
       return RPagePersistentSink::CommitSealedPageVImpl(ranges);
    }
 
-   RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
-   // Reserve a blob that is large enough to hold all pages.
-   std::uint64_t offset = fWriter->ReserveBlob(size, bytesPacked);
-
-   // Now write the individual pages and record their locators.
    std::vector<ROOT::Experimental::RNTupleLocator> locators;
-   for (auto &range : ranges) {
-      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
-         fWriter->WriteIntoReservedBlob(sealedPageIt->fBuffer, sealedPageIt->fSize, offset);
-         RNTupleLocator locator;
-         locator.fPosition = offset;
-         locator.fBytesOnStorage = sealedPageIt->fSize;
-         locators.push_back(locator);
-         offset += sealedPageIt->fSize;
+   if (fThreadIo.joinable()) {
+      // Copy all pages into a single buffer, which is written in one go by the I/O thread
+      RWriteRequest request;
+      request.fBuffer = std::make_unique<unsigned char[]>(size);
+      request.fSize = size;
+      {
+         std::lock_guard<std::mutex> g(fLockWriter);
+         request.fOffset = fWriter->ReserveBlob(size, bytesPacked);
+      }
+      std::size_t pos = 0;
+      for (auto &range : ranges) {
+         for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+            memcpy(request.fBuffer.get() + pos, sealedPageIt->fBuffer, sealedPageIt->fSize);
+            RNTupleLocator locator;
+            locator.fPosition = request.fOffset + pos;
+            locator.fBytesOnStorage = sealedPageIt->fSize;
+            locators.push_back(locator);
+            pos += sealedPageIt->fSize;
+         }
+      }
+      EnqueueWrite(std::move(request));
+   } else {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+      // Reserve a blob that is large enough to hold all pages.
+      std::uint64_t offset = fWriter->ReserveBlob(size, bytesPacked);
+
+      // Now write the individual pages and record their locators.
+      for (auto &range : ranges) {
+         for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+            fWriter->WriteIntoReservedBlob(sealedPageIt->fBuffer, sealedPageIt->fSize, offset);
+            RNTupleLocator locator;
+            locator.fPosition = offset;
+            locator.fBytesOnStorage = sealedPageIt->fSize;
+            locators.push_back(locator);
+            offset += sealedPageIt->fSize;
+         }
       }
    }
 
@@ -199,12 +326,14 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitClusterGroupImpl(unsigned char
 
    RNTupleLocator result;
    result.fBytesOnStorage = szPageListZip;
+   std::lock_guard<std::mutex> g(fLockWriter);
    result.fPosition = fWriter->WriteBlob(bufPageListZip.get(), szPageListZip, length);
    return result;
 }
 
 void ROOT::Experimental::Detail::RPageSinkFile::CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length)
 {
+   DrainWriteQueue();
    auto bufFooterZip = std::make_unique<unsigned char[]>(length);
    auto szFooterZip = fCompressor->Zip(serializedFooter, length, GetWriteOptions().GetCompression(),
                                        Internal::RNTupleCompressor::MakeMemCopyWriter(bufFooterZip.get()));
@@ -227,16 +356,49 @@ void ROOT::Experimental::Detail::RPageSinkFile::ReleasePage(RPage &page)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+
+ROOT::Experimental::Detail::RPageSourceFile::RMappedFile::RMappedFile(const ROOT::Internal::RRawFile &file)
+   : fFile(file.Clone())
+{
+   fSize = fFile->GetSize();
+   std::uint64_t mapdOffset = 0;
+   fBase = static_cast<unsigned char *>(fFile->Map(fSize, 0, mapdOffset));
+   R__ASSERT(mapdOffset == 0);
+}
+
+ROOT::Experimental::Detail::RPageSourceFile::RMappedFile::~RMappedFile()
+{
+   try {
+      fFile->Unmap(fBase, fSize);
+   } catch (const std::exception &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure unmapping file: " << err.what();
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view ntupleName,
                                                              const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options),
      fPagePool(std::make_shared<Internal::RPagePool>()),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(std::make_unique<RClusterPool>(*this, options))
 {
    fDecompressor = std::make_unique<Internal::RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
+   fNPageMapped = fMetrics.MakeCounter<RNTupleAtomicCounter *>("nPageMapped", "",
+                                                               "number of pages served from the memory mapped file");
+   fNPageShared = fMetrics.MakeCounter<RNTupleAtomicCounter *>("nPageShared", "",
+                                                               "number of pages taken from the shared page cache");
+   fNDiskCacheHit =
+      fMetrics.MakeCounter<RNTupleAtomicCounter *>("nDiskCacheHit", "", "number of pages read from the disk cache");
+   fNDiskCacheMiss = fMetrics.MakeCounter<RNTupleAtomicCounter *>("nDiskCacheMiss", "",
+                                                                  "number of pages not found in the disk cache");
+   fSzDiskCacheRead =
+      fMetrics.MakeCounter<RNTupleAtomicCounter *>("szDiskCacheRead", "B", "volume read from the disk cache");
+   fSzDiskCacheWrite =
+      fMetrics.MakeCounter<RNTupleAtomicCounter *>("szDiskCacheWrite", "B", "volume written to the disk cache");
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 }
 
 
@@ -269,12 +431,34 @@ void ROOT::Experimental::Detail::RPageSourceFile::InitDescriptor(const RNTuple &
    fDecompressor->Unzip(zipBuffer.get(), anchor.GetNBytesHeader(), anchor.GetLenHeader(), buffer.get());
    Internal::RNTupleSerializer::DeserializeHeader(buffer.get(), anchor.GetLenHeader(), fDescriptorBuilder);
 
+   // The envelope checksums identify the ntuple in the disk cache
+   std::uint64_t headerXxHash3 = 0;
+   std::uint64_t footerXxHash3 = 0;
+   Internal::RNTupleSerializer::DeserializeUInt64(buffer.get() + anchor.GetLenHeader() - 8, headerXxHash3);
+
    fDescriptorBuilder.AddToOnDiskFooterSize(anchor.GetNBytesFooter());
    buffer = std::make_unique<unsigned char[]>(anchor.GetLenFooter());
    zipBuffer = std::make_unique<unsigned char[]>(anchor.GetNBytesFooter());
    fReader.ReadBuffer(zipBuffer.get(), anchor.GetNBytesFooter(), anchor.GetSeekFooter());
    fDecompressor->Unzip(zipBuffer.get(), anchor.GetNBytesFooter(), anchor.GetLenFooter(), buffer.get());
    Internal::RNTupleSerializer::DeserializeFooter(buffer.get(), anchor.GetLenFooter(), fDescriptorBuilder);
+   Internal::RNTupleSerializer::DeserializeUInt64(buffer.get() + anchor.GetLenFooter() - 8, footerXxHash3);
+
+   if (!fOptions.GetDiskCacheDir().empty()) {
+      unsigned char envelopeChecksums[16];
+      Internal::RNTupleSerializer::SerializeUInt64(headerXxHash3, envelopeChecksums);
+      Internal::RNTupleSerializer::SerializeUInt64(footerXxHash3, envelopeChecksums + 8);
+      unsigned char scratch[8];
+      Internal::RNTupleSerializer::SerializeXxHash3(envelopeChecksums, sizeof(envelopeChecksums), fDiskCacheNTupleId,
+                                                    scratch);
+      fDiskCache = Internal::RPageDiskCache::Get(fOptions.GetDiskCacheDir(), fOptions.GetDiskCacheMaxSize(),
+                                                 fOptions.GetDiskCacheEviction());
+   }
+
+   if (fOptions.GetUseSharedPageCache()) {
+      fSharedPageCacheId = fFile->GetUrl() + "#" + std::to_string(anchor.GetSeekHeader()) + ":" +
+                           std::to_string(anchor.GetSeekFooter());
+   }
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RPageSourceFile>
@@ -318,6 +502,9 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
       Internal::RNTupleSerializer::DeserializePageList(buffer.get(), cgDesc.GetPageListLength(), cgDesc.GetId(), desc);
    }
 
+   if (fOptions.GetUseMemoryMap() && !fMappedFile && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap))
+      fMappedFile = std::make_shared<RMappedFile>(*fFile);
+
    return desc;
 }
 
@@ -371,13 +558,32 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       return pageZero;
    }
 
+   Internal::RSharedPageCache::RKey sharedPageKey;
+   std::shared_ptr<Internal::RSharedPageCache::REntry> sharedPage;
+   if (!fSharedPageCacheId.empty())
+      sharedPageKey = MakeSharedPageKey(columnId, clusterId, pageInfo.fPageNo, *element);
+
    if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
-      directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
-      fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
+      if (!fSharedPageCacheId.empty() && (sharedPage = Internal::RSharedPageCache::Instance().Find(sharedPageKey))) {
+         RegisterSharedPage(sharedPage, false /* isPreload */);
+         return sharedPage->GetPage();
+      }
+
+      const auto position = pageInfo.fLocator.GetPosition<std::uint64_t>();
+      if (fMappedFile && fMappedFile->Contains(position, bytesOnStorage) &&
+          (bytesOnStorage == element->GetPackedSize(pageInfo.fNElements))) {
+         sealedPageBuffer = fMappedFile->GetAddress(position);
+      } else {
+         directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
+         if (!ReadFromDiskCache(directReadBuffer.get(), bytesOnStorage, position)) {
+            fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, position);
+            fCounters->fNRead.Inc();
+            fCounters->fSzReadPayload.Add(bytesOnStorage);
+            WriteToDiskCache(directReadBuffer.get(), bytesOnStorage, position);
+         }
+         sealedPageBuffer = directReadBuffer.get();
+      }
       fCounters->fNPageLoaded.Inc();
-      fCounters->fNRead.Inc();
-      fCounters->fSzReadPayload.Add(bytesOnStorage);
-      sealedPageBuffer = directReadBuffer.get();
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
          fCurrentCluster = fClusterPool->GetCluster(clusterId, fActivePhysicalColumns.ToColumnSet());
@@ -387,14 +593,30 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       if (!cachedPage.IsNull())
          return cachedPage;
 
+      if (!fSharedPageCacheId.empty() && (sharedPage = Internal::RSharedPageCache::Instance().Find(sharedPageKey))) {
+         RegisterSharedPage(sharedPage, false /* isPreload */);
+         return sharedPage->GetPage();
+      }
+
       ROnDiskPage::Key key(columnId, pageInfo.fPageNo);
       auto onDiskPage = fCurrentCluster->GetOnDiskPage(key);
-      R__ASSERT(onDiskPage && (bytesOnStorage == onDiskPage->GetSize()));
-      sealedPageBuffer = onDiskPage->GetAddress();
+      if (onDiskPage) {
+         R__ASSERT(bytesOnStorage == onDiskPage->GetSize());
+         sealedPageBuffer = onDiskPage->GetAddress();
+      } else {
+         // The page was in the shared page cache when the cluster was loaded but got evicted in the meantime
+         R__ASSERT(!fSharedPageCacheId.empty());
+         directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
+         fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
+         fCounters->fNRead.Inc();
+         fCounters->fSzReadPayload.Add(bytesOnStorage);
+         fCounters->fNPageLoaded.Inc();
+         sealedPageBuffer = directReadBuffer.get();
+      }
    }
 
-   RPage newPage;
-   {
+   RPage newPage = MapSealedPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId);
+   if (newPage.IsNull()) {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
       newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
@@ -402,14 +624,119 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
 
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
-   fPagePool->RegisterPage(
-      newPage,
-      Internal::RPageDeleter([](const RPage &page, void *) { Internal::RPageAllocatorHeap::DeletePage(page); },
-                             nullptr));
    fCounters->fNPagePopulated.Inc();
+   if (!fSharedPageCacheId.empty()) {
+      // If another page source inserted the same page in the meantime, we continue with that one
+      sharedPage = Internal::RSharedPageCache::Instance().Insert(sharedPageKey, newPage, MakePageDeleter(newPage));
+      fPagePool->RegisterPage(sharedPage->GetPage(),
+                              Internal::RPageDeleter([sharedPage](const RPage &, void *) {}, nullptr));
+      return sharedPage->GetPage();
+   }
+   fPagePool->RegisterPage(newPage, MakePageDeleter(newPage));
    return newPage;
 }
 
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::MapSealedPage(const RSealedPage &sealedPage,
+                                                           const RColumnElementBase &element,
+                                                           DescriptorId_t physicalColumnId)
+{
+   if (!fMappedFile || !fMappedFile->Contains(sealedPage.fBuffer) || !element.IsMappable())
+      return RPage();
+   if (sealedPage.fSize != element.GetPackedSize(sealedPage.fNElements))
+      return RPage();
+   // Pages are not necessarily aligned in the file; misaligned pages are copied by UnsealPage()
+   if ((reinterpret_cast<std::uintptr_t>(sealedPage.fBuffer) % element.GetSize()) != 0)
+      return RPage();
+
+   // The mapping is read-only; page sources never write into populated pages
+   RPage page(physicalColumnId, const_cast<void *>(sealedPage.fBuffer), element.GetSize(), sealedPage.fNElements);
+   page.GrowUnchecked(sealedPage.fNElements);
+   fNPageMapped->Inc();
+   return page;
+}
+
+ROOT::Experimental::Internal::RPageDeleter
+ROOT::Experimental::Detail::RPageSourceFile::MakePageDeleter(const RPage &page) const
+{
+   if (fMappedFile && fMappedFile->Contains(page.GetBuffer()))
+      return Internal::RPageDeleter([mappedFile = fMappedFile](const RPage &, void *) {}, nullptr);
+   return Internal::RPageDeleter(
+      [pageAllocator = fPageAllocator](const RPage &page, void *) { pageAllocator->DeletePage(page); }, nullptr);
+}
+
+ROOT::Experimental::Internal::RSharedPageCache::RKey
+ROOT::Experimental::Detail::RPageSourceFile::MakeSharedPageKey(DescriptorId_t physicalColumnId,
+                                                               DescriptorId_t clusterId, NTupleSize_t pageNo,
+                                                               const RColumnElementBase &element) const
+{
+   Internal::RSharedPageCache::RKey key;
+   key.fNTupleId = fSharedPageCacheId;
+   key.fPhysicalColumnId = physicalColumnId;
+   key.fClusterId = clusterId;
+   key.fPageNo = pageNo;
+   key.fElementType = std::type_index(typeid(element));
+   return key;
+}
+
+bool ROOT::Experimental::Detail::RPageSourceFile::IsSharedInBackground(DescriptorId_t physicalColumnId,
+                                                                      const RColumnElementBase &element)
+{
+   if (fSharedPageCacheId.empty())
+      return false;
+   std::lock_guard<std::mutex> g(fElementTypesLock);
+   auto itr = fElementTypes.find(physicalColumnId);
+   return (itr != fElementTypes.end()) && (itr->second == std::type_index(typeid(element)));
+}
+
+void ROOT::Experimental::Detail::RPageSourceFile::RegisterSharedPage(
+   const std::shared_ptr<Internal::RSharedPageCache::REntry> &entry, bool isPreload)
+{
+   // The deleter only holds on to the cache entry; the page memory is freed by the entry once it is unused
+   Internal::RPageDeleter deleter([entry](const RPage &, void *) {}, nullptr);
+   if (isPreload)
+      fPagePool->PreloadPage(entry->GetPage(), deleter);
+   else
+      fPagePool->RegisterPage(entry->GetPage(), deleter);
+   fNPageShared->Inc();
+}
+
+bool ROOT::Experimental::Detail::RPageSourceFile::ReadFromDiskCache(void *buffer, std::uint64_t size,
+                                                                    std::uint64_t offset)
+{
+   if (!fDiskCache)
+      return false;
+   if (!fDiskCache->Read(Internal::RPageDiskCache::GetFileName(fDiskCacheNTupleId, offset, size), buffer, size)) {
+      fNDiskCacheMiss->Inc();
+      return false;
+   }
+   fNDiskCacheHit->Inc();
+   fSzDiskCacheRead->Add(size);
+   return true;
+}
+
+void ROOT::Experimental::Detail::RPageSourceFile::WriteToDiskCache(const void *buffer, std::uint64_t size,
+                                                                   std::uint64_t offset)
+{
+   if (!fDiskCache)
+      return;
+   if (fDiskCache->Write(Internal::RPageDiskCache::GetFileName(fDiskCacheNTupleId, offset, size), buffer, size))
+      fSzDiskCacheWrite->Add(size);
+}
+
+
+ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
+ROOT::Experimental::Detail::RPageSourceFile::AddColumn(DescriptorId_t fieldId, const RColumn &column)
+{
+   auto columnHandle = RPageSource::AddColumn(fieldId, column);
+   const std::type_index elementType(typeid(*column.GetElement()));
+   std::lock_guard<std::mutex> g(fElementTypesLock);
+   auto [itr, isNew] = fElementTypes.try_emplace(columnHandle.fPhysicalId, elementType);
+   // Columns connected with different in-memory types do not use background unzipped pages from the shared cache
+   if (!isNew && (itr->second != elementType))
+      itr->second = std::type_index(typeid(void));
+   return columnHandle;
+}
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::PopulatePage(
    ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
@@ -473,13 +800,17 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    auto clone = new RPageSourceFile(fNTupleName, fOptions);
    clone->fFile = fFile->Clone();
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
+   clone->fMappedFile = fMappedFile;
+   clone->fSharedPageCacheId = fSharedPageCacheId;
+   clone->fDiskCache = fDiskCache;
+   clone->fDiskCacheNTupleId = fDiskCacheNTupleId;
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RCluster>
 ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
-   const RCluster::RKey &clusterKey,
-   std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests)
+   const RCluster::RKey &clusterKey, std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests,
+   std::vector<RDiskCacheItem> &diskCacheItems)
 {
    struct ROnDiskPageLocator {
       ROOT::Experimental::DescriptorId_t fColumnId = 0;
@@ -489,18 +820,78 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
       std::size_t fBufPos = 0;
    };
 
+   // With a memory mapped file, uncompressed pages are not read but registered with their address in the mapping.
+   // Whether a page is uncompressed follows from the bits on storage of its column.
+   std::unordered_map<DescriptorId_t, std::size_t> bitsOnStorage;
+   if (fMappedFile) {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      for (auto physicalColumnId : clusterKey.fPhysicalColumnSet) {
+         bitsOnStorage[physicalColumnId] =
+            RColumnElementBase::GetBitsOnStorage(descriptorGuard->GetColumnDescriptor(physicalColumnId).GetModel());
+      }
+   }
+
+   // Pages that are in the shared page cache are not read again. The element types that are part of the page key
+   // are the ones used by UnzipClusterImpl().
+   std::unordered_map<DescriptorId_t, std::unique_ptr<RColumnElementBase>> sharedPageElements;
+   if (!fSharedPageCacheId.empty()) {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      for (auto physicalColumnId : clusterKey.fPhysicalColumnSet) {
+         auto element = RColumnElementBase::Generate(descriptorGuard->GetColumnDescriptor(physicalColumnId).GetModel());
+         if (IsSharedInBackground(physicalColumnId, *element))
+            sharedPageElements[physicalColumnId] = std::move(element);
+      }
+   }
+
    std::vector<ROnDiskPageLocator> onDiskPages;
+   // Candidates to be copied from the disk cache instead of being read from the file
+   std::vector<ROnDiskPageLocator> diskCachePages;
+   std::size_t szDiskCachePages = 0;
    auto activeSize = 0;
    auto pageZeroMap = std::make_unique<ROnDiskPageMap>();
+   auto mappedPageMap = std::make_unique<ROnDiskPageMap>();
    PrepareLoadCluster(clusterKey, *pageZeroMap,
                       [&](DescriptorId_t physicalColumnId, NTupleSize_t pageNo,
                           const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) {
+                         auto itrSharedElement = sharedPageElements.find(physicalColumnId);
+                         if (itrSharedElement != sharedPageElements.end() &&
+                             Internal::RSharedPageCache::Instance().Contains(MakeSharedPageKey(
+                                physicalColumnId, clusterKey.fClusterId, pageNo, *itrSharedElement->second)))
+                            return;
                          const auto &pageLocator = pageInfo.fLocator;
+                         const auto position = pageLocator.GetPosition<std::uint64_t>();
+                         if (fMappedFile && fMappedFile->Contains(position, pageLocator.fBytesOnStorage) &&
+                             (pageLocator.fBytesOnStorage ==
+                              (pageInfo.fNElements * bitsOnStorage[physicalColumnId] + 7) / 8)) {
+                            mappedPageMap->Register(
+                               ROnDiskPage::Key{physicalColumnId, pageNo},
+                               ROnDiskPage(const_cast<unsigned char *>(fMappedFile->GetAddress(position)),
+                                           pageLocator.fBytesOnStorage));
+                            return;
+                         }
+                         if (fDiskCache) {
+                            diskCachePages.push_back(
+                               {physicalColumnId, pageNo, position, pageLocator.fBytesOnStorage, szDiskCachePages});
+                            szDiskCachePages += pageLocator.fBytesOnStorage;
+                            return;
+                         }
                          activeSize += pageLocator.fBytesOnStorage;
-                         onDiskPages.push_back({physicalColumnId, pageNo, pageLocator.GetPosition<std::uint64_t>(),
-                                                pageLocator.fBytesOnStorage, 0});
+                         onDiskPages.push_back({physicalColumnId, pageNo, position, pageLocator.fBytesOnStorage, 0});
                       });
 
+   // Pages that are not in the disk cache are read from the file like all the other pages
+   auto diskCacheBuffer = new unsigned char[szDiskCachePages];
+   auto diskCachePageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char[]>(diskCacheBuffer));
+   for (const auto &s : diskCachePages) {
+      if (ReadFromDiskCache(diskCacheBuffer + s.fBufPos, s.fSize, s.fOffset)) {
+         diskCachePageMap->Register(ROnDiskPage::Key{s.fColumnId, s.fPageNo},
+                                    ROnDiskPage(diskCacheBuffer + s.fBufPos, s.fSize));
+         continue;
+      }
+      activeSize += s.fSize;
+      onDiskPages.push_back({s.fColumnId, s.fPageNo, s.fOffset, s.fSize, 0});
+   }
+
    // Linearize the page requests by file offset
    std::sort(onDiskPages.begin(), onDiskPages.end(),
       [](const ROnDiskPageLocator &a, const ROnDiskPageLocator &b) {return a.fOffset < b.fOffset;});
@@ -563,7 +954,8 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
       req.fOffset = s.fOffset;
       req.fSize = s.fSize;
    }
-   readRequests.emplace_back(req);
+   if (req.fSize > 0)
+      readRequests.emplace_back(req);
    fCounters->fSzReadPayload.Add(szPayload);
    fCounters->fSzReadOverhead.Add(szOverhead);
 
@@ -573,6 +965,8 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    for (const auto &s : onDiskPages) {
       ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
       pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
+      if (fDiskCache)
+         diskCacheItems.push_back({s.fOffset, s.fSize, buffer + s.fBufPos});
    }
    fCounters->fNPageLoaded.Add(onDiskPages.size());
    for (auto i = currentReadRequestIdx; i < readRequests.size(); ++i) {
@@ -582,6 +976,8 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    auto cluster = std::make_unique<RCluster>(clusterKey.fClusterId);
    cluster->Adopt(std::move(pageMap));
    cluster->Adopt(std::move(pageZeroMap));
+   cluster->Adopt(std::move(mappedPageMap));
+   cluster->Adopt(std::move(diskCachePageMap));
    for (auto colId : clusterKey.fPhysicalColumnSet)
       cluster->SetColumnAvailable(colId);
    return cluster;
@@ -589,16 +985,51 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
 
 std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
 ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RKey> clusterKeys)
+{
+   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters(clusterKeys.size());
+   LoadClustersIncrementally(clusterKeys, [&clusters](std::size_t idx, std::unique_ptr<RCluster> cluster) {
+      clusters[idx] = std::move(cluster);
+   });
+   return clusters;
+}
+
+void ROOT::Experimental::Detail::RPageSourceFile::LoadClustersIncrementally(std::span<RCluster::RKey> clusterKeys,
+                                                                           const ROnClusterLoaded_t &onLoaded)
 {
    fCounters->fNClusterLoaded.Add(clusterKeys.size());
 
    std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters;
    std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   // Maps read requests to the index of their cluster in `clusters`
+   std::vector<std::size_t> clusterIdxOfRequest;
+   // Per cluster, the number of read requests that have not yet completed
+   std::vector<std::size_t> nPendingRequests;
+   // Per cluster, the pages read from the file that are added to the disk cache before handing over the cluster
+   std::vector<std::vector<RDiskCacheItem>> diskCacheItems;
 
    for (auto key: clusterKeys) {
-      clusters.emplace_back(PrepareSingleCluster(key, readRequests));
+      const auto nReqsBefore = readRequests.size();
+      diskCacheItems.emplace_back();
+      clusters.emplace_back(PrepareSingleCluster(key, readRequests, diskCacheItems.back()));
+      nPendingRequests.emplace_back(readRequests.size() - nReqsBefore);
+      clusterIdxOfRequest.resize(readRequests.size(), clusters.size() - 1);
+   }
+   for (std::size_t i = 0; i < clusters.size(); ++i) {
+      if (nPendingRequests[i] == 0)
+         onLoaded(i, std::move(clusters[i]));
    }
 
+   // Hand over the cluster once the last of its read requests completes. Depending on the raw file, requests of a
+   // vector read can complete out of order and before the vector read returns.
+   auto fnCompleteRequest = [&](std::size_t reqIdx) {
+      const auto clusterIdx = clusterIdxOfRequest[reqIdx];
+      if (--nPendingRequests[clusterIdx] == 0) {
+         for (const auto &item : diskCacheItems[clusterIdx])
+            WriteToDiskCache(item.fBuffer, item.fSize, item.fOffset);
+         onLoaded(clusterIdx, std::move(clusters[clusterIdx]));
+      }
+   };
+
    auto nReqs = readRequests.size();
    auto readvLimits = fFile->GetReadVLimits();
 
@@ -624,11 +1055,14 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
 
       if (nBatch <= 1) {
          nBatch = 1;
-         RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-         fFile->ReadAt(readRequests[iReq].fBuffer, readRequests[iReq].fSize, readRequests[iReq].fOffset);
+         {
+            RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+            fFile->ReadAt(readRequests[iReq].fBuffer, readRequests[iReq].fSize, readRequests[iReq].fOffset);
+         }
+         fnCompleteRequest(iReq);
       } else {
          RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-         fFile->ReadV(&readRequests[iReq], nBatch);
+         fFile->ReadV(&readRequests[iReq], nBatch, [&](unsigned int i) { fnCompleteRequest(iReq + i); });
       }
       fCounters->fNReadV.Inc();
       fCounters->fNRead.Add(nBatch);
@@ -636,8 +1070,6 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
       iReq += nBatch;
       nReqs -= nBatch;
    }
-
-   return clusters;
 }
 
 
@@ -656,7 +1088,8 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
+      const bool isSharedColumn = IsSharedInBackground(columnId, *allElements.back());
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -664,19 +1097,41 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
       for (const auto &pi : pageRange.fPageInfos) {
          ROnDiskPage::Key key(columnId, pageNo);
          auto onDiskPage = cluster->GetOnDiskPage(key);
-         R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
+         const bool isShared = isSharedColumn && (pi.fLocator.fType != RNTupleLocator::kTypePageZero);
+         const auto sharedPageKey =
+            isShared ? MakeSharedPageKey(columnId, clusterId, pageNo, *allElements.back())
+                     : Internal::RSharedPageCache::RKey();
+         if (!onDiskPage) {
+            // Skipped by PrepareSingleCluster() because it is in the shared page cache. If it got evicted in the
+            // meantime, it is read on demand by PopulatePageFromCluster().
+            R__ASSERT(isShared);
+            if (auto sharedPage = Internal::RSharedPageCache::Instance().Find(sharedPageKey))
+               RegisterSharedPage(sharedPage, true /* isPreload */);
+            firstInPage += pi.fNElements;
+            pageNo++;
+            continue;
+         }
+         R__ASSERT(onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage);
 
          auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
-                          nElements = pi.fNElements,
+                          nElements = pi.fNElements, isShared, sharedPageKey,
                           indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
-            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
-            fCounters->fSzUnzip.Add(element->GetSize() * nElements);
+            const RSealedPage sealedPage{onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements};
+            auto newPage = MapSealedPage(sealedPage, *element, columnId);
+            if (newPage.IsNull()) {
+               newPage = UnsealPage(sealedPage, *element, columnId);
+               fCounters->fSzUnzip.Add(element->GetSize() * nElements);
+            }
 
             newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-            fPagePool->PreloadPage(
-               newPage,
-               Internal::RPageDeleter([](const RPage &page, void *) { Internal::RPageAllocatorHeap::DeletePage(page); },
-                                      nullptr));
+            if (isShared) {
+               auto sharedPage =
+                  Internal::RSharedPageCache::Instance().Insert(sharedPageKey, newPage, MakePageDeleter(newPage));
+               fPagePool->PreloadPage(sharedPage->GetPage(),
+                                      Internal::RPageDeleter([sharedPage](const RPage &, void *) {}, nullptr));
+            } else {
+               fPagePool->PreloadPage(newPage, MakePageDeleter(newPage));
+            }
          };
 
          fTaskScheduler->AddTask(taskFunc);
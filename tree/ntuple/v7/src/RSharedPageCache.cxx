@@ -0,0 +1,125 @@
+/// \file RSharedPageCache.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RSharedPageCache.hxx>
+
+ROOT::Experimental::Internal::RSharedPageCache &ROOT::Experimental::Internal::RSharedPageCache::Instance()
+{
+   static RSharedPageCache instance;
+   return instance;
+}
+
+void ROOT::Experimental::Internal::RSharedPageCache::EvictUnlocked()
+{
+   while ((fMemoryUsage > fMemoryBudget) && !fLruList.empty()) {
+      auto itr = fSlots.find(fLruList.back());
+      fMemoryUsage -= itr->second.fEntry->GetPage().GetNBytes();
+      fSlots.erase(itr);
+      fLruList.pop_back();
+   }
+}
+
+std::size_t ROOT::Experimental::Internal::RSharedPageCache::GetMemoryBudget()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fMemoryBudget;
+}
+
+void ROOT::Experimental::Internal::RSharedPageCache::SetMemoryBudget(std::size_t budget)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   fMemoryBudget = budget;
+   EvictUnlocked();
+}
+
+std::size_t ROOT::Experimental::Internal::RSharedPageCache::GetMemoryUsage()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fMemoryUsage;
+}
+
+std::size_t ROOT::Experimental::Internal::RSharedPageCache::GetNPages()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fSlots.size();
+}
+
+std::uint64_t ROOT::Experimental::Internal::RSharedPageCache::GetNHit()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fNHit;
+}
+
+std::uint64_t ROOT::Experimental::Internal::RSharedPageCache::GetNMiss()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fNMiss;
+}
+
+std::shared_ptr<ROOT::Experimental::Internal::RSharedPageCache::REntry>
+ROOT::Experimental::Internal::RSharedPageCache::Find(const RKey &key)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   auto itr = fSlots.find(key);
+   if (itr == fSlots.end()) {
+      fNMiss++;
+      return nullptr;
+   }
+   fNHit++;
+   fLruList.splice(fLruList.begin(), fLruList, itr->second.fLruPosition);
+   return itr->second.fEntry;
+}
+
+bool ROOT::Experimental::Internal::RSharedPageCache::Contains(const RKey &key)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fSlots.count(key) > 0;
+}
+
+std::shared_ptr<ROOT::Experimental::Internal::RSharedPageCache::REntry>
+ROOT::Experimental::Internal::RSharedPageCache::Insert(const RKey &key, const Detail::RPage &page,
+                                                       const RPageDeleter &deleter)
+{
+   // Constructed outside the lock: if the page is a duplicate, the entry's destructor calls the deleter
+   auto entry = std::make_shared<REntry>(page, deleter);
+
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   auto itr = fSlots.find(key);
+   if (itr != fSlots.end()) {
+      fLruList.splice(fLruList.begin(), fLruList, itr->second.fLruPosition);
+      return itr->second.fEntry;
+   }
+
+   if (page.GetNBytes() > fMemoryBudget)
+      return entry;
+
+   fLruList.emplace_front(key);
+   fSlots.emplace(key, RSlot{entry, fLruList.begin()});
+   fMemoryUsage += page.GetNBytes();
+   EvictUnlocked();
+   return entry;
+}
+
+void ROOT::Experimental::Internal::RSharedPageCache::Clear()
+{
+   // Release the pages outside the lock; entries still in use by page sources remain valid
+   decltype(fSlots) slots;
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      std::swap(slots, fSlots);
+      fLruList.clear();
+      fMemoryUsage = 0;
+      fNHit = 0;
+      fNMiss = 0;
+   }
+}
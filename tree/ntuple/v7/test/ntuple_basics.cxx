@@ -305,6 +305,160 @@ TEST(RNTuple, PageSize)
    EXPECT_EQ(20, col0_pages.fPageInfos.size());
 }
 
+TEST(RNTuple, ValueStatistics)
+{
+   FileRaii fileGuard("test_ntuple_value_statistics.root");
+   auto model = RNTupleModel::Create();
+   auto fldPt = model->MakeField<float>("pt");
+   auto fldJets = model->MakeField<std::vector<float>>("jets");
+
+   {
+      RNTupleWriteOptions opt;
+      opt.SetEnableValueStatistics(true);
+      opt.SetApproxUnzippedPageSize(20);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 30; i++) {
+         *fldPt = i;
+         // No jets in the first cluster, two jets per entry afterwards
+         fldJets->resize((i < 10) ? 0 : 2);
+         ntuple->Fill();
+         if ((i % 10) == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   {
+      const auto &desc = ntuple->GetDescriptor();
+      EXPECT_EQ(3U, desc.GetNClusters());
+      const auto ptColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("pt"), 0);
+      const auto jetsColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("jets"), 0);
+
+      const auto &clusterDesc = desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 15));
+      ASSERT_TRUE(clusterDesc.GetColumnRange(ptColumnId).fStatistics.has_value());
+      EXPECT_EQ(10., clusterDesc.GetColumnRange(ptColumnId).fStatistics->fMin);
+      EXPECT_EQ(19., clusterDesc.GetColumnRange(ptColumnId).fStatistics->fMax);
+      const auto &pageInfos = clusterDesc.GetPageRange(ptColumnId).fPageInfos;
+      EXPECT_GT(pageInfos.size(), 1U);
+      for (const auto &pi : pageInfos) {
+         ASSERT_TRUE(pi.fStatistics.has_value());
+         EXPECT_LE(10., pi.fStatistics->fMin);
+         EXPECT_GE(19., pi.fStatistics->fMax);
+      }
+
+      // For collections, the statistics refer to the collection sizes
+      const auto &firstClusterDesc = desc.GetClusterDescriptor(desc.FindClusterId(jetsColumnId, 0));
+      ASSERT_TRUE(firstClusterDesc.GetColumnRange(jetsColumnId).fStatistics.has_value());
+      EXPECT_EQ(0., firstClusterDesc.GetColumnRange(jetsColumnId).fStatistics->fMax);
+      EXPECT_EQ(10U, firstClusterDesc.GetColumnRange(jetsColumnId).fStatistics->fNNulls);
+      const auto &lastClusterDesc = desc.GetClusterDescriptor(desc.FindClusterId(jetsColumnId, 29));
+      EXPECT_EQ(2., lastClusterDesc.GetColumnRange(jetsColumnId).fStatistics->fMin);
+      EXPECT_EQ(0U, lastClusterDesc.GetColumnRange(jetsColumnId).fStatistics->fNNulls);
+   }
+
+   auto ranges = ntuple->SelectEntryRanges("pt", 12, 13);
+   ASSERT_FALSE(ranges.empty());
+   std::vector<NTupleSize_t> candidates;
+   for (auto &r : ranges) {
+      for (auto i : r)
+         candidates.push_back(i);
+   }
+   EXPECT_LE(10U, candidates.front());
+   EXPECT_GT(20U, candidates.back());
+   EXPECT_NE(candidates.end(), std::find(candidates.begin(), candidates.end(), 12U));
+   EXPECT_NE(candidates.end(), std::find(candidates.begin(), candidates.end(), 13U));
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : candidates)
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+
+   EXPECT_TRUE(ntuple->SelectEntryRanges("pt", 100, 200).empty());
+   ranges = ntuple->SelectEntryRanges("jets", 1, std::numeric_limits<double>::infinity());
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(10U, *ranges[0].begin());
+   EXPECT_THROW(ntuple->SelectEntryRanges("nonexistent", 0, 1), RException);
+}
+
+TEST(RNTuple, ValueStatisticsLossy)
+{
+   FileRaii fileGuard("test_ntuple_value_statistics_lossy.root");
+   auto fldTrunc = std::make_unique<RField<float>>("trunc");
+   // Sign, exponent, and one bit of mantissa
+   fldTrunc->SetTruncated(10);
+   auto fldHalf = std::make_unique<RField<float>>("half");
+   fldHalf->SetHalfPrecision();
+   auto model = RNTupleModel::Create();
+   model->AddField(std::move(fldTrunc));
+   model->AddField(std::move(fldHalf));
+
+   {
+      RNTupleWriteOptions opt;
+      opt.SetEnableValueStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), opt);
+      auto trunc = ntuple->GetModel().GetDefaultEntry().GetPtr<float>("trunc");
+      auto half = ntuple->GetModel().GetDefaultEntry().GetPtr<float>("half");
+      for (int i = 0; i < 30; i++) {
+         *trunc = 1.75f + i;
+         *half = 0.1f + i;
+         ntuple->Fill();
+         if ((i % 10) == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   auto viewTrunc = ntuple->GetView<float>("trunc");
+   auto viewHalf = ntuple->GetView<float>("half");
+   // The stored values are below the smallest written values of the clusters
+   EXPECT_FLOAT_EQ(1.5f, viewTrunc(0));
+   EXPECT_FLOAT_EQ(0.0999755859375f, viewHalf(0));
+
+   // Selecting exactly the stored value of an entry must yield that entry
+   auto fnIsSelected = [&ntuple](const std::string &fieldName, float value, NTupleSize_t entry) {
+      for (auto &range : ntuple->SelectEntryRanges(fieldName, value, value)) {
+         for (auto i : range) {
+            if (i == entry)
+               return true;
+         }
+      }
+      return false;
+   };
+   for (NTupleSize_t i = 0; i < 30; ++i) {
+      EXPECT_TRUE(fnIsSelected("trunc", viewTrunc(i), i)) << "entry " << i;
+      EXPECT_TRUE(fnIsSelected("half", viewHalf(i), i)) << "entry " << i;
+   }
+}
+
+TEST(RNTuple, ValueStatisticsDisabled)
+{
+   FileRaii fileGuard("test_ntuple_value_statistics_disabled.root");
+   auto model = RNTupleModel::Create();
+   auto fldPt = model->MakeField<float>("pt");
+
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 30; i++) {
+         *fldPt = i;
+         ntuple->Fill();
+         if ((i % 10) == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto ptColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("pt"), 0);
+   EXPECT_FALSE(desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 0)).GetColumnRange(ptColumnId).fStatistics);
+
+   // Without statistics, every entry is a candidate
+   auto ranges = ntuple->SelectEntryRanges("pt", 100, 200);
+   ASSERT_EQ(1U, ranges.size());
+   std::vector<NTupleSize_t> candidates;
+   for (auto i : ranges[0])
+      candidates.push_back(i);
+   EXPECT_EQ(30U, candidates.size());
+   EXPECT_EQ(0U, candidates.front());
+}
+
 TEST(RNTupleModel, EnforceValidFieldNames)
 {
    auto model = RNTupleModel::Create();
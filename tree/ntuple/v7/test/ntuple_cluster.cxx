@@ -14,8 +14,11 @@
 #include <ROOT/RPageStorageFile.hxx>
 #include <string_view>
 
+#include <condition_variable>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -55,6 +58,20 @@ public:
    /// Records the cluster IDs requests by LoadClusters() calls
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RCluster::ColumnSet_t> fReqsColumns;
+   /// Lets the test control when the I/O thread gets data: while fNAllowedLoads is zero, LoadClusters() blocks.
+   /// A negative value does not limit the number of LoadClusters() calls.
+   std::mutex fLoadMutex;
+   std::condition_variable fLoadCv;
+   int fNAllowedLoads = -1;
+
+   void AllowLoads(int nLoads)
+   {
+      {
+         std::lock_guard<std::mutex> lock(fLoadMutex);
+         fNAllowedLoads = nLoads;
+      }
+      fLoadCv.notify_all();
+   }
 
    RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
       ROOT::Experimental::Internal::RNTupleDescriptorBuilder descBuilder;
@@ -82,6 +99,12 @@ public:
    void LoadSealedPage(ROOT::Experimental::DescriptorId_t, ROOT::Experimental::RClusterIndex, RSealedPage &) final {}
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final
    {
+      {
+         std::unique_lock<std::mutex> lock(fLoadMutex);
+         fLoadCv.wait(lock, [this] { return fNAllowedLoads != 0; });
+         if (fNAllowedLoads > 0)
+            --fNAllowedLoads;
+      }
       std::vector<std::unique_ptr<RCluster>> result;
       for (auto key : clusterKeys) {
          fReqsClusterIds.emplace_back(key.fClusterId);
@@ -322,6 +345,43 @@ TEST(ClusterPool, GetClusterIncrementally)
    EXPECT_EQ(RCluster::ColumnSet_t({1}), p1.fReqsColumns[2]);
 }
 
+TEST(ClusterPool, AdaptiveBunchSize)
+{
+   ROOT::Experimental::RNTupleReadOptions options;
+   EXPECT_THROW(options.SetMaxClusterBunchSize(0), ROOT::Experimental::RException);
+   options.SetMaxClusterBunchSize(4);
+
+   RPageSourceMock p1;
+   RClusterPool c1(p1, options);
+   EXPECT_FALSE(c1.IsAdaptive());
+
+   options.SetUseAdaptiveClusterBunchSize(true);
+   RPageSourceMock p2;
+   // Only the bunch of cluster 0 arrives; the preloading of cluster 1 stays in flight until we allow it to load
+   p2.AllowLoads(1);
+   RClusterPool c2(p2, options);
+   EXPECT_TRUE(c2.IsAdaptive());
+   EXPECT_EQ(1U, c2.GetClusterBunchSize());
+   c2.GetCluster(0, {0});
+   EXPECT_EQ(1U, c2.GetClusterBunchSize());
+   // Cluster 1 has been scheduled for preloading with cluster 0 but it is still in flight.  The bunch size is adapted
+   // before GetCluster() waits for the cluster, so the I/O can be released as soon as the stall has been registered.
+   std::thread releaseIo([&c2, &p2] {
+      while (c2.GetClusterBunchSize() == 1)
+         std::this_thread::yield();
+      p2.AllowLoads(-1);
+   });
+   c2.GetCluster(1, {0});
+   releaseIo.join();
+   EXPECT_EQ(2U, c2.GetClusterBunchSize());
+   // Adding columns to the current cluster does not count as a cluster switch
+   c2.GetCluster(1, {0, 1});
+   EXPECT_EQ(2U, c2.GetClusterBunchSize());
+   // Non-linear access shrinks the window
+   c2.GetCluster(4, {0});
+   EXPECT_EQ(1U, c2.GetClusterBunchSize());
+   c2.WaitForInFlightClusters();
+}
 
 TEST(PageStorageFile, LoadClusters)
 {
@@ -379,4 +439,16 @@ TEST(PageStorageFile, LoadClusters)
    EXPECT_EQ(1U, clusters[0]->GetNOnDiskPages());
    EXPECT_EQ(1U, clusters[1]->GetId());
    EXPECT_EQ(1U, clusters[1]->GetNOnDiskPages());
+
+   // Every cluster is handed over exactly once, possibly out of order
+   std::vector<std::unique_ptr<RCluster>> loaded(clusterKeys.size());
+   source.LoadClustersIncrementally(clusterKeys, [&](std::size_t idx, std::unique_ptr<RCluster> c) {
+      ASSERT_LT(idx, loaded.size());
+      EXPECT_EQ(nullptr, loaded[idx]);
+      loaded[idx] = std::move(c);
+   });
+   EXPECT_EQ(0U, loaded[0]->GetId());
+   EXPECT_EQ(1U, loaded[0]->GetNOnDiskPages());
+   EXPECT_EQ(1U, loaded[1]->GetId());
+   EXPECT_NE(nullptr, loaded[1]->GetOnDiskPage(key));
 }
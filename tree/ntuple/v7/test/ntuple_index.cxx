@@ -0,0 +1,138 @@
+#include "ntuple_test.hxx"
+
+namespace {
+/// Writes 100 entries in 10 clusters; the events of a run are stored in descending order
+void CreateEventNTuple(std::string_view ntupleName, const std::string &path)
+{
+   auto model = RNTupleModel::Create();
+   auto run = model->MakeField<std::int32_t>("run");
+   auto event = model->MakeField<std::uint64_t>("event");
+   auto pt = model->MakeField<float>("pt");
+   auto writer = RNTupleWriter::Recreate(std::move(model), ntupleName, path);
+   for (int i = 0; i < 100; ++i) {
+      *run = i / 10;
+      *event = 9 - (i % 10);
+      *pt = i;
+      writer->Fill();
+      if (i % 10 == 9)
+         writer->CommitCluster();
+   }
+}
+} // anonymous namespace
+
+TEST(RNTupleIndex, Basics)
+{
+   FileRaii fileGuard("test_ntuple_index_basics.root");
+   CreateEventNTuple("ntpl", fileGuard.GetPath());
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   auto index = RNTupleIndex::Create(*reader, "run", "event");
+   EXPECT_EQ(100U, index->GetSize());
+   EXPECT_EQ("run", index->GetMajorFieldName());
+   EXPECT_EQ("event", index->GetMinorFieldName());
+
+   auto viewPt = reader->GetView<float>("pt");
+   for (int run = 0; run < 10; ++run) {
+      for (int event = 0; event < 10; ++event) {
+         auto entry = index->GetEntryNumber(run, event);
+         ASSERT_NE(ROOT::Experimental::kInvalidNTupleIndex, entry);
+         EXPECT_FLOAT_EQ(run * 10 + 9 - event, viewPt(entry));
+      }
+   }
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryNumber(10, 0));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryNumber(0, 10));
+
+   // Index on the major field only; the keys are not unique
+   auto runIndex = RNTupleIndex::Create(*reader, "run");
+   EXPECT_FALSE(runIndex->HasMinorField());
+   EXPECT_EQ(30U, runIndex->GetEntryNumber(3, 42));
+   auto entries = runIndex->GetEntryNumbers(3);
+   ASSERT_EQ(10U, entries.size());
+   for (unsigned i = 0; i < entries.size(); ++i)
+      EXPECT_EQ(30U + i, entries[i]);
+   EXPECT_TRUE(runIndex->GetEntryNumbers(10).empty());
+
+   try {
+      RNTupleIndex::Create(*reader, "pt");
+      FAIL() << "indexing a floating point field should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("non-integral type"));
+   }
+   try {
+      RNTupleIndex::Create(*reader, "run", "lumi");
+      FAIL() << "indexing a non-existing field should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("no field named 'lumi'"));
+   }
+}
+
+TEST(RNTupleIndex, Persistence)
+{
+   FileRaii fileGuard("test_ntuple_index_persistence.root");
+   CreateEventNTuple("ntpl", fileGuard.GetPath());
+
+   {
+      auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+      auto index = RNTupleIndex::Create(*reader, "run", "event");
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      index->Write("ntpl_index", *file);
+   }
+
+   auto index = RNTupleIndex::Open("ntpl_index", fileGuard.GetPath());
+   EXPECT_EQ(100U, index->GetSize());
+   EXPECT_EQ("run", index->GetMajorFieldName());
+   EXPECT_EQ("event", index->GetMinorFieldName());
+   EXPECT_EQ(0U, index->GetEntryNumber(0, 9));
+   EXPECT_EQ(99U, index->GetEntryNumber(9, 0));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryNumber(9, 10));
+
+   // The indexed ntuple is unaffected
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(100U, reader->GetNEntries());
+
+   try {
+      RNTupleIndex::Open("ntpl", fileGuard.GetPath());
+      FAIL() << "opening a regular ntuple as an index should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("is not an RNTupleIndex"));
+   }
+}
+
+TEST(RNTupleIndex, Friends)
+{
+   FileRaii fileGuard1("test_ntuple_index_friends1.root");
+   FileRaii fileGuard2("test_ntuple_index_friends2.root");
+   CreateEventNTuple("ntpl1", fileGuard1.GetPath());
+   CreateEventNTuple("ntpl2", fileGuard2.GetPath());
+
+   std::vector<RNTupleReader::ROpenSpec> friends{{"ntpl1", fileGuard1.GetPath()}, {"ntpl2", fileGuard2.GetPath()}};
+   auto reader = RNTupleReader::OpenFriends(friends);
+   auto index = RNTupleIndex::Create(*reader, "ntpl2.run", "ntpl2.event");
+   auto viewPt = reader->GetView<float>("ntpl1.pt");
+   EXPECT_FLOAT_EQ(29.0, viewPt(index->GetEntryNumber(2, 0)));
+
+   // Match entries of a differently ordered ntuple by key
+   FileRaii fileGuard3("test_ntuple_index_friends3.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto run = model->MakeField<std::int32_t>("run");
+      auto event = model->MakeField<std::uint64_t>("event");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl3", fileGuard3.GetPath());
+      for (int i = 99; i >= 0; --i) {
+         *run = i / 10;
+         *event = i % 10;
+         writer->Fill();
+      }
+   }
+   auto reader3 = RNTupleReader::Open("ntpl3", fileGuard3.GetPath());
+   auto viewRun3 = reader3->GetView<std::int32_t>("run");
+   auto viewEvent3 = reader3->GetView<std::uint64_t>("event");
+   auto viewRun = reader->GetView<std::int32_t>("ntpl1.run");
+   auto viewEvent = reader->GetView<std::uint64_t>("ntpl1.event");
+   for (auto i : reader3->GetEntryRange()) {
+      auto entry = index->GetEntryNumber(viewRun3(i), viewEvent3(i));
+      ASSERT_NE(ROOT::Experimental::kInvalidNTupleIndex, entry);
+      EXPECT_EQ(viewRun3(i), viewRun(entry));
+      EXPECT_EQ(viewEvent3(i), viewEvent(entry));
+   }
+}
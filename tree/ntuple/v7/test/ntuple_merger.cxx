@@ -473,3 +473,191 @@ TEST(RNTupleMerger, MergeInconsistentTypes)
       EXPECT_THROW(merger.Merge(sourcePtrs, *destination), ROOT::Experimental::RException);
    }
 }
+
+TEST(RNTupleMerger, MergeRecompress)
+{
+   // The first input is written uncompressed, the second input with the same compression as the output
+   FileRaii fileGuard1("test_ntuple_merge_recompress_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_recompress_in_2.root");
+   for (const auto &[path, compression] : {std::make_pair(fileGuard1.GetPath(), 0), {fileGuard2.GetPath(), 505}}) {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<int>("pt", 0);
+      RNTupleWriteOptions options;
+      options.SetCompression(compression);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+      for (int i = 0; i < 100000; ++i) {
+         *fieldPt = i % 100;
+         ntuple->Fill();
+      }
+   }
+
+   FileRaii fileGuard3("test_ntuple_merge_recompress_out.root");
+   {
+      std::vector<std::unique_ptr<RPageSource>> sources;
+      sources.push_back(RPageSource::Create("ntuple", fileGuard1.GetPath(), RNTupleReadOptions()));
+      sources.push_back(RPageSource::Create("ntuple", fileGuard2.GetPath(), RNTupleReadOptions()));
+      std::vector<RPageSource *> sourcePtrs;
+      for (const auto &s : sources) {
+         sourcePtrs.push_back(s.get());
+      }
+
+      RNTupleWriteOptions writeOpts;
+      writeOpts.SetCompression(505);
+      writeOpts.SetUseBufferedWrite(false);
+      auto destination = RPageSink::Create("ntuple", fileGuard3.GetPath(), writeOpts);
+
+      RNTupleMerger merger;
+      EXPECT_NO_THROW(merger.Merge(sourcePtrs, *destination));
+   }
+
+   // Returns the pages sizes on storage of the cluster containing the given entry
+   auto fnGetPageSizes = [](RNTupleReader &reader, NTupleSize_t entry) {
+      const auto &desc = reader.GetDescriptor();
+      const auto columnId = desc.FindPhysicalColumnId(desc.FindFieldId("pt"), 0);
+      const auto &pageRange = desc.GetClusterDescriptor(desc.FindClusterId(columnId, entry)).GetPageRange(columnId);
+      std::vector<std::uint32_t> sizes;
+      for (const auto &pi : pageRange.fPageInfos)
+         sizes.emplace_back(pi.fLocator.fBytesOnStorage);
+      return sizes;
+   };
+
+   auto ntuple1 = RNTupleReader::Open("ntuple", fileGuard1.GetPath());
+   auto ntuple2 = RNTupleReader::Open("ntuple", fileGuard2.GetPath());
+   auto ntuple3 = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   ASSERT_EQ(200000U, ntuple3->GetNEntries());
+
+   // The pages of the first input are recompressed
+   auto sizes1 = fnGetPageSizes(*ntuple1, 0);
+   auto sizes3 = fnGetPageSizes(*ntuple3, 0);
+   ASSERT_EQ(sizes1.size(), sizes3.size());
+   for (std::size_t i = 0; i < sizes1.size(); ++i) {
+      EXPECT_LT(sizes3[i], sizes1[i]);
+   }
+   // The pages of the second input are copied verbatim
+   EXPECT_EQ(fnGetPageSizes(*ntuple2, 0), fnGetPageSizes(*ntuple3, 100000));
+
+   auto viewPt = ntuple3->GetView<int>("pt");
+   for (auto i : ntuple3->GetEntryRange()) {
+      ASSERT_EQ(static_cast<int>(i % 100), viewPt(i));
+   }
+}
+
+TEST(RNTupleMerger, MergeThroughTFileMerger)
+{
+   FileRaii fileGuard1("test_ntuple_merge_hadd_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_hadd_in_2.root");
+   for (const auto &path : {fileGuard1.GetPath(), fileGuard2.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt", 0.);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path);
+      for (int i = 0; i < 10; ++i) {
+         *fieldPt = i;
+         ntuple->Fill();
+      }
+   }
+
+   FileRaii fileGuard3("test_ntuple_merge_hadd_out.root");
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuard3.GetPath().c_str(), "RECREATE", 505);
+      fileMerger.AddFile(fileGuard1.GetPath().c_str(), kFALSE);
+      fileMerger.AddFile(fileGuard2.GetPath().c_str(), kFALSE);
+      EXPECT_TRUE(fileMerger.Merge());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   ASSERT_EQ(20U, ntuple->GetNEntries());
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i % 10), viewPt(i));
+   }
+}
+
+TEST(RNTupleMerger, MergeUnion)
+{
+   // The sources have overlapping sets of fields
+   FileRaii fileGuard1("test_ntuple_merge_union_in_1.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldFoo = model->MakeField<int>("foo", 0);
+      auto fieldBaz = model->MakeField<double>("baz", 0.);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard1.GetPath());
+      for (int i = 0; i < 10; ++i) {
+         *fieldFoo = i;
+         *fieldBaz = i * 0.5;
+         ntuple->Fill();
+      }
+   }
+   FileRaii fileGuard2("test_ntuple_merge_union_in_2.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldFoo = model->MakeField<int>("foo", 0);
+      auto fieldBar = model->MakeField<float>("bar", 0.);
+      auto fieldVec = model->MakeField<std::vector<int>>("vec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath());
+      for (int i = 10; i < 20; ++i) {
+         *fieldFoo = i;
+         *fieldBar = i;
+         *fieldVec = {i, i};
+         ntuple->Fill();
+      }
+   }
+   FileRaii fileGuard3("test_ntuple_merge_union_in_3.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldBar = model->MakeField<float>("bar", 0.);
+      auto fieldFoo = model->MakeField<int>("foo", 0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard3.GetPath());
+      for (int i = 20; i < 30; ++i) {
+         *fieldFoo = i;
+         *fieldBar = i;
+         ntuple->Fill();
+      }
+   }
+
+   auto fnMerge = [&](const std::string &outPath, ENTupleMergingMode mergingMode) {
+      std::vector<std::unique_ptr<RPageSource>> sources;
+      sources.push_back(RPageSource::Create("ntuple", fileGuard1.GetPath(), RNTupleReadOptions()));
+      sources.push_back(RPageSource::Create("ntuple", fileGuard2.GetPath(), RNTupleReadOptions()));
+      sources.push_back(RPageSource::Create("ntuple", fileGuard3.GetPath(), RNTupleReadOptions()));
+      std::vector<RPageSource *> sourcePtrs;
+      for (const auto &s : sources) {
+         sourcePtrs.push_back(s.get());
+      }
+
+      RNTupleWriteOptions writeOpts;
+      writeOpts.SetUseBufferedWrite(false);
+      auto destination = RPageSink::Create("ntuple", outPath, writeOpts);
+
+      RNTupleMergeOptions options;
+      options.fMergingMode = mergingMode;
+      RNTupleMerger merger;
+      merger.Merge(sourcePtrs, *destination, options);
+   };
+
+   FileRaii fileGuardStrict("test_ntuple_merge_union_strict.root");
+   EXPECT_THROW(fnMerge(fileGuardStrict.GetPath(), ENTupleMergingMode::kStrict), ROOT::Experimental::RException);
+
+   FileRaii fileGuardOut("test_ntuple_merge_union_out.root");
+   EXPECT_NO_THROW(fnMerge(fileGuardOut.GetPath(), ENTupleMergingMode::kUnion));
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuardOut.GetPath());
+   ASSERT_EQ(30U, ntuple->GetNEntries());
+   auto viewFoo = ntuple->GetView<int>("foo");
+   auto viewBaz = ntuple->GetView<double>("baz");
+   auto viewBar = ntuple->GetView<float>("bar");
+   auto viewVec = ntuple->GetView<std::vector<int>>("vec");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<int>(i), viewFoo(i));
+      // Missing in the second and third source
+      EXPECT_DOUBLE_EQ((i < 10) ? i * 0.5 : 0., viewBaz(i));
+      // Missing in the first source
+      EXPECT_FLOAT_EQ((i < 10) ? 0. : static_cast<float>(i), viewBar(i));
+      // Missing in the first and third source
+      if (i >= 10 && i < 20) {
+         EXPECT_EQ(std::vector<int>({static_cast<int>(i), static_cast<int>(i)}), viewVec(i));
+      } else {
+         EXPECT_TRUE(viewVec(i).empty());
+      }
+   }
+}
@@ -49,7 +49,12 @@ using PackingIntTypes =
                     Helper<std::int32_t, std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>,
                     Helper<std::uint32_t, std::uint32_t, ROOT::Experimental::EColumnType::kSplitUInt32>,
                     Helper<std::int16_t, std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>,
-                    Helper<std::uint16_t, std::uint16_t, ROOT::Experimental::EColumnType::kSplitUInt16>>;
+                    Helper<std::uint16_t, std::uint16_t, ROOT::Experimental::EColumnType::kSplitUInt16>,
+                    Helper<std::int64_t, std::int64_t, ROOT::Experimental::EColumnType::kDeltaSplitInt64>,
+                    Helper<std::uint64_t, std::uint64_t, ROOT::Experimental::EColumnType::kDeltaSplitUInt64>,
+                    Helper<std::int32_t, std::int32_t, ROOT::Experimental::EColumnType::kDeltaSplitInt32>,
+                    Helper<std::uint32_t, std::uint32_t, ROOT::Experimental::EColumnType::kDeltaSplitUInt32>,
+                    Helper<std::int64_t, std::int32_t, ROOT::Experimental::EColumnType::kDeltaSplitInt32>>;
 TYPED_TEST_SUITE(PackingInt, PackingIntTypes);
 
 using PackingIndexTypes = ::testing::Types<
@@ -115,6 +120,153 @@ TEST(Packing, HalfPrecisionFloat)
    EXPECT_FLOAT_EQ(0.399902343, out4[3]);
 }
 
+TEST(Packing, TruncatedFloat)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Trunc> element;
+   EXPECT_THROW(element.SetBitsOnStorage(9), RException);
+   EXPECT_THROW(element.SetBitsOnStorage(33), RException);
+   element.SetBitsOnStorage(13);
+   EXPECT_EQ(13u, element.GetBitsOnStorage());
+   EXPECT_EQ(2u, element.GetPackedSize(1));
+   EXPECT_EQ(13u, element.GetPackedSize(8));
+   EXPECT_THROW(element.SetValueRange(0., 1.), RException);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   // More elements than fit in a single conversion chunk
+   std::vector<float> mem(1000);
+   for (std::size_t i = 0; i < mem.size(); ++i)
+      mem[i] = (i % 2 ? -1.f : 1.f) * std::sqrt(static_cast<float>(i)) * 1000.f;
+   std::vector<unsigned char> packed(element.GetPackedSize(mem.size()));
+   std::vector<float> cmp(mem.size());
+   element.Pack(packed.data(), mem.data(), mem.size());
+   element.Unpack(cmp.data(), packed.data(), mem.size());
+
+   for (std::size_t i = 0; i < mem.size(); ++i) {
+      std::uint32_t bits;
+      memcpy(&bits, &mem[i], sizeof(bits));
+      // Sign, exponent, and the first 4 bits of the mantissa are preserved
+      bits &= 0xfff80000;
+      float expected;
+      memcpy(&expected, &bits, sizeof(expected));
+      EXPECT_EQ(expected, cmp[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32Trunc> elementDouble;
+   elementDouble.SetBitsOnStorage(32);
+   double in[] = {0.1, -42.0};
+   unsigned char packedDouble[8];
+   double out[2];
+   elementDouble.Pack(packedDouble, in, 2);
+   elementDouble.Unpack(out, packedDouble, 2);
+   EXPECT_EQ(static_cast<float>(in[0]), out[0]);
+   EXPECT_EQ(-42.0, out[1]);
+}
+
+TEST(Packing, QuantizedFloat)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32Quant> element;
+   EXPECT_THROW(element.SetBitsOnStorage(0), RException);
+   EXPECT_THROW(element.SetValueRange(1., -1.), RException);
+   EXPECT_THROW(element.SetValueRange(0., INFINITY), RException);
+   element.SetBitsOnStorage(7);
+
+   double in[] = {-1.0, 1.0};
+   unsigned char packed[2];
+   // The value range is required
+   EXPECT_THROW(element.Pack(packed, in, 2), RException);
+
+   element.SetValueRange(-1., 1.);
+   element.Pack(packed, in, 2);
+   // -1.0 --> 0, 1.0 --> 127 (0b1111111)
+   EXPECT_EQ(0x80, packed[0]);
+   EXPECT_EQ(0x3f, packed[1]);
+
+   const double maxError = 0.5 * 2. / 127.;
+   std::vector<double> mem(600);
+   for (std::size_t i = 0; i < mem.size(); ++i)
+      mem[i] = std::sin(static_cast<double>(i));
+   std::vector<unsigned char> packedMem(element.GetPackedSize(mem.size()));
+   std::vector<double> cmp(mem.size());
+   element.Pack(packedMem.data(), mem.data(), mem.size());
+   element.Unpack(cmp.data(), packedMem.data(), mem.size());
+   for (std::size_t i = 0; i < mem.size(); ++i) {
+      EXPECT_NEAR(mem[i], cmp[i], maxError);
+   }
+
+   double outOfRange[] = {0.0, 1.5};
+   EXPECT_THROW(element.Pack(packed, outOfRange, 2), RException);
+   double nan[] = {std::numeric_limits<double>::quiet_NaN()};
+   EXPECT_THROW(element.Pack(packed, nan, 1), RException);
+}
+
+namespace {
+/// Returns all the SIMD levels of the unpacking kernels that can be used on this machine
+std::vector<ROOT::Experimental::Internal::ESimdLevel> GetSupportedSimdLevels()
+{
+   using ROOT::Experimental::Internal::ESimdLevel;
+   std::vector<ESimdLevel> levels{ESimdLevel::kScalar};
+   const auto detected = ROOT::Experimental::Internal::GetDetectedSimdLevel();
+   if (detected == ESimdLevel::kAVX2)
+      levels.emplace_back(ESimdLevel::kSSE41);
+   if (detected != ESimdLevel::kScalar)
+      levels.emplace_back(detected);
+   return levels;
+}
+} // anonymous namespace
+
+TEST(Packing, SimdKernels)
+{
+   using ROOT::Experimental::Internal::ESimdLevel;
+   const auto defaultLevel = ROOT::Experimental::Internal::GetSimdLevel();
+   EXPECT_EQ(ROOT::Experimental::Internal::GetDetectedSimdLevel(), defaultLevel);
+   if (defaultLevel != ESimdLevel::kNEON)
+      EXPECT_THROW(ROOT::Experimental::Internal::SetSimdLevel(ESimdLevel::kNEON), RException);
+
+   // Cover the vectorized main loops and the scalar remainders
+   std::vector<std::size_t> counts{0, 1, 15, 16, 17, 31, 32, 33, 64, 1000, 4097};
+   std::vector<unsigned char> source(8 * 4097);
+   for (std::size_t i = 0; i < source.size(); ++i)
+      source[i] = static_cast<unsigned char>((i * 7919) >> 3);
+
+   for (auto level : GetSupportedSimdLevels()) {
+      ROOT::Experimental::Internal::SetSimdLevel(level);
+      EXPECT_EQ(level, ROOT::Experimental::Internal::GetSimdLevel());
+      for (auto count : counts) {
+         for (std::size_t N : {2, 3, 4, 8}) {
+            std::vector<unsigned char> unsplit(N * count);
+            ROOT::Experimental::Internal::UnsplitBytes(unsplit.data(), source.data(), count, N);
+            for (std::size_t i = 0; i < count; ++i) {
+               for (std::size_t b = 0; b < N; ++b) {
+                  EXPECT_EQ(source[b * count + i], unsplit[i * N + b])
+                     << ROOT::Experimental::Internal::GetSimdLevelName(level) << " N=" << N << " count=" << count;
+               }
+            }
+         }
+
+         std::unique_ptr<bool[]> bools(new bool[count + 1]);
+         ROOT::Experimental::Internal::UnpackBitsToBool(bools.get(), source.data(), count);
+         for (std::size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(static_cast<bool>((source[i / 8] >> (i % 8)) & 1), bools[i])
+               << ROOT::Experimental::Internal::GetSimdLevelName(level) << " count=" << count;
+         }
+      }
+
+      // Split columns through the column elements
+      ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element;
+      std::vector<std::int32_t> mem(100);
+      for (std::size_t i = 0; i < mem.size(); ++i)
+         mem[i] = (i % 2) ? -static_cast<std::int32_t>(i * i) : static_cast<std::int32_t>(i);
+      std::vector<std::int32_t> packed(mem.size());
+      std::vector<std::int32_t> cmp(mem.size());
+      element.Pack(packed.data(), mem.data(), mem.size());
+      element.Unpack(cmp.data(), packed.data(), mem.size());
+      EXPECT_EQ(mem, cmp);
+   }
+
+   ROOT::Experimental::Internal::SetSimdLevel(defaultLevel);
+}
+
 TEST(Packing, RColumnSwitch)
 {
    ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::RColumnSwitch,
@@ -132,6 +284,39 @@ TEST(Packing, RColumnSwitch)
    EXPECT_EQ(0x55, s2.GetTag());
 }
 
+TEST(Packing, DeltaSplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kDeltaSplitInt32> element;
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   // Differences: 1000, 1, -2, 1 --> zigzag encoded: 2000 (0x07d0), 2, 3, 2
+   std::int32_t mem[] = {1000, 1001, 999, 1000};
+   unsigned char packed[16];
+   element.Pack(packed, mem, 4);
+   unsigned char expPacked[] = {0xd0, 0x02, 0x03, 0x02, 0x07, 0x00, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+   EXPECT_EQ(memcmp(packed, expPacked, sizeof(expPacked)), 0);
+
+   std::int32_t cmp[4];
+   element.Unpack(cmp, packed, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(mem[i], cmp[i]);
+   }
+
+   // Narrowing to 32bit on disk for a 64bit in-memory type
+   ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kDeltaSplitUInt32>
+      elementNarrow;
+   std::uint64_t memNarrow[] = {10, 5, 0xffffffff};
+   unsigned char packedNarrow[12];
+   elementNarrow.Pack(packedNarrow, memNarrow, 3);
+   std::uint64_t cmpNarrow[3];
+   elementNarrow.Unpack(cmpNarrow, packedNarrow, 3);
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(memNarrow[i], cmpNarrow[i]);
+   }
+}
+
 TYPED_TEST(PackingReal, SplitReal)
 {
    using Pod_t = typename TestFixture::Helper_t::Pod_t;
@@ -0,0 +1,80 @@
+/// \file ntuple_packing_benchmark.cxx
+/// \ingroup NTuple ROOT7
+/// \brief Micro-benchmark of the unpacking of split and bit columns, comparing the scalar and the vectorized kernels
+///
+/// Usage: ntuple_packing_benchmark [number of elements] [number of repetitions]
+
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RColumnModel.hxx>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using ROOT::Experimental::EColumnType;
+using ROOT::Experimental::Internal::ESimdLevel;
+
+namespace {
+
+/// Returns the throughput of unpacking `nElements` elements in MB/s of in-memory data
+template <typename CppT, EColumnType ColumnT>
+double BenchmarkUnpack(ESimdLevel level, std::size_t nElements, int nRepetitions)
+{
+   ROOT::Experimental::Internal::SetSimdLevel(level);
+   ROOT::Experimental::Detail::RColumnElement<CppT, ColumnT> element;
+
+   const auto packedSize = (nElements * element.GetBitsOnStorage() + 7) / 8;
+   std::vector<unsigned char> packed(packedSize);
+   for (std::size_t i = 0; i < packedSize; ++i)
+      packed[i] = static_cast<unsigned char>((i * 2654435761u) >> 13);
+   std::unique_ptr<CppT[]> unpacked(new CppT[nElements]);
+
+   // Warm-up
+   element.Unpack(unpacked.get(), packed.data(), nElements);
+
+   const auto start = std::chrono::steady_clock::now();
+   for (int i = 0; i < nRepetitions; ++i)
+      element.Unpack(unpacked.get(), packed.data(), nElements);
+   const auto stop = std::chrono::steady_clock::now();
+
+   const double seconds = std::chrono::duration<double>(stop - start).count();
+   const double megaBytes = static_cast<double>(nElements) * sizeof(CppT) * nRepetitions / 1e6;
+   return megaBytes / seconds;
+}
+
+template <typename CppT, EColumnType ColumnT>
+void Report(const char *name, std::size_t nElements, int nRepetitions)
+{
+   const auto scalar = BenchmarkUnpack<CppT, ColumnT>(ESimdLevel::kScalar, nElements, nRepetitions);
+   const auto detected = ROOT::Experimental::Internal::GetDetectedSimdLevel();
+   const auto vectorized = BenchmarkUnpack<CppT, ColumnT>(detected, nElements, nRepetitions);
+   std::printf("%-24s scalar: %10.1f MB/s   %-6s: %10.1f MB/s   speedup: %5.2fx\n", name, scalar,
+               ROOT::Experimental::Internal::GetSimdLevelName(detected).c_str(), vectorized, vectorized / scalar);
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+   const std::size_t nElements = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 64 * 1024;
+   const int nRepetitions = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+   std::printf("Unpacking %zu elements, %d repetitions, detected SIMD level: %s\n\n", nElements, nRepetitions,
+               ROOT::Experimental::Internal::GetSimdLevelName(ROOT::Experimental::Internal::GetDetectedSimdLevel())
+                  .c_str());
+
+   Report<float, EColumnType::kSplitReal32>("SplitReal32 -> float", nElements, nRepetitions);
+   Report<double, EColumnType::kSplitReal64>("SplitReal64 -> double", nElements, nRepetitions);
+   Report<std::uint16_t, EColumnType::kSplitUInt16>("SplitUInt16 -> uint16", nElements, nRepetitions);
+   Report<std::int32_t, EColumnType::kSplitInt32>("SplitInt32 -> int32", nElements, nRepetitions);
+   Report<std::int64_t, EColumnType::kSplitInt64>("SplitInt64 -> int64", nElements, nRepetitions);
+   Report<bool, EColumnType::kBit>("Bit -> bool", nElements, nRepetitions);
+
+   ROOT::Experimental::Internal::SetSimdLevel(ROOT::Experimental::Internal::GetDetectedSimdLevel());
+   return 0;
+}
@@ -12,6 +12,58 @@ TEST(Pages, Allocation)
    allocator.DeletePage(page);
 }
 
+TEST(Pages, AllocatorPool)
+{
+   EXPECT_EQ(64U, RPageAllocatorPool::GetSizeClass(1));
+   EXPECT_EQ(64U, RPageAllocatorPool::GetSizeClass(64));
+   EXPECT_EQ(80U, RPageAllocatorPool::GetSizeClass(65));
+   EXPECT_EQ(64U * 1024, RPageAllocatorPool::GetSizeClass(64 * 1024));
+   EXPECT_EQ(80U * 1024, RPageAllocatorPool::GetSizeClass(64 * 1024 + 1));
+   EXPECT_EQ(96U * 1024, RPageAllocatorPool::GetSizeClass(96 * 1024));
+
+   RPageAllocatorPool allocator(1024);
+   allocator.GetMetrics().Enable();
+   auto ctrHit = allocator.GetMetrics().GetCounter("RPageAllocatorPool.nPageAllocHit");
+   auto ctrMiss = allocator.GetMetrics().GetCounter("RPageAllocatorPool.nPageAllocMiss");
+   auto ctrPeak = allocator.GetMetrics().GetCounter("RPageAllocatorPool.szPeak");
+   ASSERT_NE(nullptr, ctrHit);
+   ASSERT_NE(nullptr, ctrMiss);
+   ASSERT_NE(nullptr, ctrPeak);
+
+   auto page1 = allocator.NewPage(42, 4, 16);
+   EXPECT_FALSE(page1.IsNull());
+   EXPECT_EQ(16U, page1.GetMaxElements());
+   EXPECT_EQ(4U, page1.GetElementSize());
+   auto buffer1 = page1.GetBuffer();
+   allocator.DeletePage(page1);
+
+   // Same size class: the buffer is recycled
+   auto page2 = allocator.NewPage(43, 8, 8);
+   EXPECT_EQ(buffer1, page2.GetBuffer());
+   EXPECT_EQ(43, page2.GetColumnId());
+   EXPECT_EQ(1, ctrHit->GetValueAsInt());
+   EXPECT_EQ(1, ctrMiss->GetValueAsInt());
+
+   // Different size class
+   auto page3 = allocator.NewPage(42, 1, 1000);
+   EXPECT_NE(buffer1, page3.GetBuffer());
+   EXPECT_EQ(2, ctrMiss->GetValueAsInt());
+   EXPECT_EQ(64 + 1024, ctrPeak->GetValueAsInt());
+
+   // Beyond the limit of 1024 cached bytes, released buffers are freed
+   allocator.DeletePage(page3);
+   allocator.DeletePage(page2);
+   auto page4 = allocator.NewPage(42, 1, 1000);
+   EXPECT_EQ(2, ctrHit->GetValueAsInt());
+   auto page5 = allocator.NewPage(42, 64, 1);
+   EXPECT_EQ(3, ctrMiss->GetValueAsInt());
+   allocator.DeletePage(page4);
+   allocator.DeletePage(page5);
+
+   // Page zero is never released to the pool
+   allocator.DeletePage(RPage::MakePageZero(42, 4));
+}
+
 TEST(Pages, Pool)
 {
    RPagePool pool;
@@ -0,0 +1,128 @@
+#include "ntuple_test.hxx"
+
+namespace {
+/// Writes 10 clusters with 10 entries each; the field "pt" contains the entry number
+void CreateTestNTuple(const std::string &path)
+{
+   auto model = RNTupleModel::Create();
+   auto pt = model->MakeField<float>("pt");
+   model->MakeField<std::vector<float>>("v");
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path);
+   for (int i = 0; i < 100; ++i) {
+      *pt = i;
+      writer->Fill();
+      if (i % 10 == 9)
+         writer->CommitCluster();
+   }
+}
+} // anonymous namespace
+
+TEST(RNTupleParallelReader, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_reader_basics.root");
+   CreateTestNTuple(fileGuard.GetPath());
+
+   auto reader = RNTupleParallelReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(100U, reader->GetNEntries());
+   EXPECT_EQ(10U, reader->GetNRanges());
+
+   auto c1 = reader->CreateReadContext();
+   auto c2 = reader->CreateReadContext();
+   EXPECT_TRUE(c1->GetEntryRange().begin() == c1->GetEntryRange().end());
+
+   auto pt1 = c1->GetModel().GetDefaultEntry().GetPtr<float>("pt");
+   auto entry2 = c2->CreateEntry();
+   auto pt2 = entry2->GetPtr<float>("pt");
+   auto view2 = c2->GetView<float>("pt");
+
+   EXPECT_TRUE(c1->NextRange());
+   EXPECT_TRUE(c2->NextRange());
+   EXPECT_EQ(0U, *c1->GetEntryRange().begin());
+   EXPECT_EQ(10U, *c2->GetEntryRange().begin());
+
+   for (auto i : c1->GetEntryRange()) {
+      c1->LoadEntry(i);
+      EXPECT_FLOAT_EQ(i, *pt1);
+   }
+   for (auto i : c2->GetEntryRange()) {
+      c2->LoadEntry(i, *entry2);
+      EXPECT_FLOAT_EQ(i, *pt2);
+      EXPECT_FLOAT_EQ(i, view2(i));
+   }
+   EXPECT_THROW(c1->LoadEntry(0, *entry2), ROOT::Experimental::RException);
+   EXPECT_THROW(c1->GetView<float>("nonexistent"), ROOT::Experimental::RException);
+
+   while (c1->NextRange()) {
+   }
+   EXPECT_FALSE(c2->NextRange());
+
+   reader->Rewind();
+   EXPECT_TRUE(c2->NextRange());
+   EXPECT_EQ(0U, *c2->GetEntryRange().begin());
+}
+
+TEST(RNTupleParallelReader, ClusterBunch)
+{
+   FileRaii fileGuard("test_ntuple_parallel_reader_bunch.root");
+   CreateTestNTuple(fileGuard.GetPath());
+
+   RNTupleReadOptions options;
+   options.SetClusterBunchSize(3);
+   auto model = RNTupleModel::Create();
+   auto pt = model->MakeField<float>("pt");
+   auto reader = RNTupleParallelReader::Open(std::move(model), "ntpl", fileGuard.GetPath(), options);
+   // 3 + 3 + 3 + 1 clusters
+   EXPECT_EQ(4U, reader->GetNRanges());
+
+   auto context = reader->CreateReadContext();
+   // The model is cloned for every context
+   auto ptContext = context->GetModel().GetDefaultEntry().GetPtr<float>("pt");
+   EXPECT_NE(pt.get(), ptContext.get());
+
+   std::vector<NTupleSize_t> firstEntries;
+   std::vector<NTupleSize_t> lastEntries;
+   while (context->NextRange()) {
+      auto range = context->GetEntryRange();
+      firstEntries.push_back(*range.begin());
+      lastEntries.push_back(*range.end());
+   }
+   EXPECT_EQ((std::vector<NTupleSize_t>{0, 30, 60, 90}), firstEntries);
+   EXPECT_EQ((std::vector<NTupleSize_t>{30, 60, 90, 100}), lastEntries);
+}
+
+TEST(RNTupleParallelReader, MultiThread)
+{
+   FileRaii fileGuard("test_ntuple_parallel_reader_mt.root");
+   CreateTestNTuple(fileGuard.GetPath());
+
+   auto reader = RNTupleParallelReader::Open("ntpl", fileGuard.GetPath());
+
+   constexpr int kNThreads = 4;
+   std::vector<std::thread> threads;
+   std::vector<float> sums(kNThreads, 0.0);
+   std::vector<NTupleSize_t> nEntries(kNThreads, 0);
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         auto context = reader->CreateReadContext();
+         auto pt = context->GetModel().GetDefaultEntry().GetPtr<float>("pt");
+         while (context->NextRange()) {
+            for (auto i : context->GetEntryRange()) {
+               context->LoadEntry(i);
+               sums[t] += *pt;
+               nEntries[t]++;
+            }
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   float sum = 0;
+   NTupleSize_t n = 0;
+   for (int t = 0; t < kNThreads; ++t) {
+      sum += sums[t];
+      n += nEntries[t];
+   }
+   EXPECT_EQ(100U, n);
+   EXPECT_FLOAT_EQ(4950.0, sum);
+}
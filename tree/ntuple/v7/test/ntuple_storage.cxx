@@ -1,5 +1,6 @@
 #include "ntuple_test.hxx"
 #include <TRandom3.h>
+#include <TSystem.h>
 
 #include <ROOT/RPageNullSink.hxx>
 using ROOT::Experimental::Internal::RPageNullSink;
@@ -13,6 +14,8 @@ public:
       size_t fNCommitSealedPage = 0;
       size_t fNCommitSealedPageV = 0;
    } fCounters{};
+   /// If set, CommitCluster() fails
+   bool fThrowOnCommitCluster = false;
 
 protected:
    RPageAllocatorHeap fPageAllocator{};
@@ -33,7 +36,12 @@ protected:
    {
       fCounters.fNCommitSealedPageV++;
    }
-   std::uint64_t CommitCluster(NTupleSize_t) final { return 0; }
+   std::uint64_t CommitCluster(NTupleSize_t) final
+   {
+      if (fThrowOnCommitCluster)
+         throw ROOT::Experimental::RException(R__FAIL("cannot commit cluster"));
+      return 0;
+   }
    void CommitClusterGroup() final {}
    void CommitDataset() final {}
 
@@ -457,6 +465,8 @@ TEST(RPageSinkBuf, CommitSealedPageV)
 #ifdef R__USE_IMT
    ROOT::EnableImplicitMT();
 #endif
+   // Commit the cluster synchronously so that the counters can be checked right after `CommitCluster()`
+   options.SetMaxInFlightClusters(0);
    {
       std::unique_ptr<RPageSink> sink(new RPageSinkMock(options));
       auto &counters = static_cast<RPageSinkMock *>(sink.get())->fCounters;
@@ -477,6 +487,127 @@ TEST(RPageSinkBuf, CommitSealedPageV)
    }
 }
 
+TEST(RPageSinkBuf, InFlightClusters)
+{
+   FileRaii fileGuard("test_ntuple_sinkbuf_inflight.root");
+
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif
+   {
+      auto model = RNTupleModel::Create();
+      auto ptrPx = model->MakeField<float>("px");
+      auto ptrStr = model->MakeField<std::string>("str");
+      RNTupleWriteOptions options;
+      options.SetMaxInFlightClusters(2);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (unsigned i = 0; i < 10; ++i) {
+         *ptrPx = i;
+         *ptrStr = std::to_string(i);
+         writer->Fill();
+         writer->CommitCluster();
+      }
+
+      // Late model extension drains the clusters that are still being sealed
+      auto modelUpdater = writer->CreateModelUpdater();
+      modelUpdater->BeginUpdate();
+      auto ptrPy = modelUpdater->MakeField<float>("py");
+      modelUpdater->CommitUpdate();
+      for (unsigned i = 10; i < 20; ++i) {
+         *ptrPx = i;
+         *ptrPy = 2 * i;
+         *ptrStr = std::to_string(i);
+         writer->Fill();
+         writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(20U, reader->GetNEntries());
+   EXPECT_EQ(20U, reader->GetDescriptor().GetNClusters());
+   auto viewPx = reader->GetView<float>("px");
+   auto viewPy = reader->GetView<float>("py");
+   auto viewStr = reader->GetView<std::string>("str");
+   for (unsigned i = 0; i < 20; ++i) {
+      EXPECT_FLOAT_EQ(i, viewPx(i));
+      EXPECT_FLOAT_EQ((i < 10) ? 0 : 2 * i, viewPy(i));
+      EXPECT_EQ(std::to_string(i), viewStr(i));
+   }
+}
+
+TEST(RPageSinkBuf, CommitError)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif
+   ROOT::TestSupport::CheckDiagsRAII diags;
+   diags.requiredDiag(kError, "[ROOT.NTuple]", "failure committing ntuple: cannot commit cluster", false);
+
+   RNTupleWriteOptions options;
+   options.SetApproxUnzippedPageSize(16);
+   std::unique_ptr<RPageSink> sink(new RPageSinkMock(options));
+   static_cast<RPageSinkMock *>(sink.get())->fThrowOnCommitCluster = true;
+
+   auto model = RNTupleModel::Create();
+   auto ptrPx = model->MakeField<float>("px");
+   auto ptrStr = model->MakeField<std::string>("str");
+   auto writer = ROOT::Experimental::Internal::CreateRNTupleWriter(std::move(model),
+                                                                   std::make_unique<RPageSinkBuf>(std::move(sink)));
+   for (unsigned i = 0; i < 10; ++i) {
+      *ptrPx = i;
+      *ptrStr = std::to_string(i);
+      writer->Fill();
+   }
+   // The cluster may be written by a concurrent task; the error must reach the filling thread nevertheless
+   EXPECT_THROW(writer->CommitCluster(true /* commitClusterGroup */), ROOT::Experimental::RException);
+
+   // The buffered pages of the failed clusters are released by the destructor, which logs the repeated failure
+   *ptrPx = 10;
+   writer->Fill();
+   writer.reset();
+}
+
+TEST(RPageSinkFile, AsyncWrite)
+{
+   for (auto containerFormat : {ENTupleContainerFormat::kTFile, ENTupleContainerFormat::kBare}) {
+      for (auto useBufferedWrite : {true, false}) {
+         FileRaii fileGuard("test_ntuple_sinkfile_asyncwrite.root");
+         {
+            auto model = RNTupleModel::Create();
+            auto ptrPx = model->MakeField<float>("px");
+            auto ptrVec = model->MakeField<std::vector<std::uint32_t>>("vec");
+            RNTupleWriteOptions options;
+            options.SetContainerFormat(containerFormat);
+            options.SetUseBufferedWrite(useBufferedWrite);
+            options.SetApproxUnzippedPageSize(64);
+            // Small enough to make the filling thread wait for the I/O thread
+            options.SetMaxAsyncWriteBytes(128);
+            auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+            writer->EnableMetrics();
+            for (unsigned i = 0; i < 1000; ++i) {
+               *ptrPx = i;
+               *ptrVec = {i, 2 * i};
+               writer->Fill();
+               if (i % 100 == 99)
+                  writer->CommitCluster();
+            }
+            auto prefix = std::string("RNTupleWriter.") + (useBufferedWrite ? "RPageSinkBuf." : "");
+            EXPECT_GT(writer->GetMetrics().GetCounter(prefix + "RPageSinkFile.szWriteQueued")->GetValueAsInt(), 0);
+         }
+
+         auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+         EXPECT_EQ(1000U, reader->GetNEntries());
+         EXPECT_EQ(10U, reader->GetDescriptor().GetNClusters());
+         auto viewPx = reader->GetView<float>("px");
+         auto viewVec = reader->GetView<std::vector<std::uint32_t>>("vec");
+         for (unsigned i = 0; i < 1000; ++i) {
+            EXPECT_FLOAT_EQ(i, viewPx(i));
+            EXPECT_EQ((std::vector<std::uint32_t>{i, 2 * i}), viewVec(i));
+         }
+      }
+   }
+}
+
 TEST(RPageSink, Empty)
 {
    FileRaii fileGuard("test_ntuple_empty.ntuple");
@@ -527,6 +658,362 @@ TEST(RPageSink, MultipleClusterGroups)
    EXPECT_EQ(12.0, *rdPt);
 }
 
+TEST(RPageSink, FieldCompression)
+{
+   FileRaii fileGuard("test_ntuple_field_compression.root");
+
+   for (auto useBufferedWrite : {true, false}) {
+      {
+         auto model = RNTupleModel::Create();
+         auto wrPt = model->MakeField<float>("pt");
+         auto wrE = model->MakeField<float>("E");
+         auto wrJets = model->MakeField<std::vector<float>>("jets");
+         model->SetFieldCompression("pt", 0);
+         model->SetFieldCompression("jets", 404);
+         EXPECT_THROW(model->SetFieldCompression("invalid", 0), RException);
+         RNTupleWriteOptions options;
+         options.SetCompression(505);
+         options.SetUseBufferedWrite(useBufferedWrite);
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+         for (int i = 0; i < 100; ++i) {
+            *wrPt = i;
+            *wrE = 2 * i;
+            *wrJets = {static_cast<float>(i), static_cast<float>(i + 1)};
+            ntuple->Fill();
+         }
+      }
+
+      auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+      const auto &desc = ntuple->GetDescriptor();
+      const auto &clusterDesc = desc.GetClusterDescriptor(desc.FindClusterId(0, 0));
+      auto compressionOf = [&](const std::string &fieldName) {
+         const auto columnId = desc.FindPhysicalColumnId(desc.FindFieldId(fieldName), 0);
+         return clusterDesc.GetColumnRange(columnId).fCompressionSettings;
+      };
+      EXPECT_EQ(0, compressionOf("pt"));
+      EXPECT_EQ(505, compressionOf("E"));
+      EXPECT_EQ(404, compressionOf("jets"));
+      // Inherited from the parent field
+      EXPECT_EQ(404, compressionOf("jets._0"));
+
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewJets = ntuple->GetView<std::vector<float>>("jets");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(i, viewPt(i));
+         EXPECT_EQ(2U, viewJets(i).size());
+         EXPECT_FLOAT_EQ(i + 1, viewJets(i)[1]);
+      }
+   }
+}
+
+TEST(RPageSink, AutoCompression)
+{
+   FileRaii fileGuard("test_ntuple_auto_compression.root");
+
+   TRandom3 rnd(42);
+   std::vector<std::uint32_t> randomValues(10000);
+   for (auto &v : randomValues)
+      v = rnd.Integer(std::numeric_limits<std::uint32_t>::max());
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrRandom = model->MakeField<std::uint32_t>("random");
+      auto wrConstant = model->MakeField<std::uint32_t>("constant");
+      auto wrFixed = model->MakeField<std::uint32_t>("fixed");
+      model->SetFieldCompression("fixed", 101);
+      RNTupleWriteOptions options;
+      options.SetUseAutoCompression(true);
+      options.SetAutoCompressionCandidates({404, 505});
+      // Generous budget, so that the selection does not depend on the speed of the machine
+      options.SetAutoCompressionCpuBudget(1e6);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (auto v : randomValues) {
+         *wrRandom = v;
+         *wrConstant = 42;
+         *wrFixed = 42;
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto &clusterDesc = desc.GetClusterDescriptor(desc.FindClusterId(0, 0));
+   auto compressionOf = [&](const std::string &fieldName) {
+      const auto columnId = desc.FindPhysicalColumnId(desc.FindFieldId(fieldName), 0);
+      return clusterDesc.GetColumnRange(columnId).fCompressionSettings;
+   };
+   // Random bits are incompressible
+   EXPECT_EQ(0, compressionOf("random"));
+   EXPECT_NE(0, compressionOf("constant"));
+   // Explicit field settings take precedence
+   EXPECT_EQ(101, compressionOf("fixed"));
+
+   auto viewRandom = ntuple->GetView<std::uint32_t>("random");
+   auto viewConstant = ntuple->GetView<std::uint32_t>("constant");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(randomValues[i], viewRandom(i));
+      EXPECT_EQ(42U, viewConstant(i));
+   }
+}
+
+TEST(RPageSourceFile, MemoryMap)
+{
+   FileRaii fileGuard("test_ntuple_memory_map.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrByte = model->MakeField<std::uint8_t>("byte");
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *wrByte = i;
+         *wrPt = i;
+         *wrTag = std::to_string(i);
+         ntuple->Fill();
+         if (i == 49)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseMemoryMap(true);
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewByte = ntuple->GetView<std::uint8_t>("byte");
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewTag = ntuple->GetView<std::string>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(i, viewByte(i));
+         EXPECT_FLOAT_EQ(i, viewPt(i));
+         EXPECT_EQ(std::to_string(i), viewTag(i));
+      }
+      auto *ctrNPageMapped = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped");
+      ASSERT_NE(nullptr, ctrNPageMapped);
+      // The byte column has no alignment constraints
+      EXPECT_GE(ctrNPageMapped->GetValueAsInt(), 2);
+   }
+
+   // Compressed pages are unzipped as usual
+   FileRaii fileGuardZip("test_ntuple_memory_map_zip.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrByte = model->MakeField<std::uint8_t>("byte", 42);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuardZip.GetPath());
+      for (int i = 0; i < 100; ++i)
+         ntuple->Fill();
+   }
+   RNTupleReadOptions options;
+   options.SetUseMemoryMap(true);
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuardZip.GetPath(), options);
+   ntuple->EnableMetrics();
+   auto viewByte = ntuple->GetView<std::uint8_t>("byte");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_EQ(42, viewByte(i));
+   EXPECT_EQ(0, ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped")->GetValueAsInt());
+}
+
+TEST(RPageSourceFile, SharedPageCache)
+{
+   using ROOT::Experimental::Internal::RSharedPageCache;
+
+   FileRaii fileGuard("test_ntuple_shared_page_cache.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::string>("tag");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         *wrTag = std::to_string(i);
+         ntuple->Fill();
+         if (i % 25 == 24)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto &cache = RSharedPageCache::Instance();
+   auto fnRead = [&fileGuard](const RNTupleReadOptions &options) {
+      auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewTag = ntuple->GetView<std::string>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(i, viewPt(i));
+         EXPECT_EQ(std::to_string(i), viewTag(i));
+      }
+      return std::make_pair(
+         ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageShared")->GetValueAsInt(),
+         ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szReadPayload")->GetValueAsInt());
+   };
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      cache.Clear();
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      options.SetUseSharedPageCache(true);
+
+      auto [nPageShared, szReadPayload] = fnRead(options);
+      EXPECT_EQ(0, nPageShared);
+      EXPECT_GT(szReadPayload, 0);
+      EXPECT_GT(cache.GetNPages(), 0U);
+
+      // The second reader neither reads nor unzips the pages again
+      std::tie(nPageShared, szReadPayload) = fnRead(options);
+      EXPECT_GT(nPageShared, 0);
+      EXPECT_EQ(0, szReadPayload);
+      EXPECT_GT(cache.GetNHit(), 0U);
+
+      // Without the option, the cache is ignored
+      options.SetUseSharedPageCache(false);
+      std::tie(nPageShared, szReadPayload) = fnRead(options);
+      EXPECT_EQ(0, nPageShared);
+      EXPECT_GT(szReadPayload, 0);
+   }
+
+#ifdef R__USE_IMT
+   // Pages unzipped in the background are found when populating pages on demand, and vice versa
+   ROOT::EnableImplicitMT();
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      cache.Clear();
+      RNTupleReadOptions options;
+      options.SetUseSharedPageCache(true);
+      options.SetClusterCache(clusterCache);
+      fnRead(options);
+      options.SetClusterCache((clusterCache == RNTupleReadOptions::EClusterCache::kOn)
+                                 ? RNTupleReadOptions::EClusterCache::kOff
+                                 : RNTupleReadOptions::EClusterCache::kOn);
+      auto [nPageShared, szReadPayload] = fnRead(options);
+      EXPECT_GT(nPageShared, 0);
+      EXPECT_EQ(0, szReadPayload);
+   }
+#endif
+
+   // Pages that are evicted between loading a cluster and populating its pages are read on demand
+   cache.Clear();
+   RNTupleReadOptions options;
+   options.SetUseSharedPageCache(true);
+   fnRead(options);
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+   auto viewPt = ntuple->GetView<float>("pt");
+   EXPECT_FLOAT_EQ(0.0, viewPt(0));
+   cache.SetMemoryBudget(0);
+   EXPECT_EQ(0U, cache.GetNPages());
+   EXPECT_EQ(0U, cache.GetMemoryUsage());
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+   EXPECT_EQ(0U, cache.GetNPages());
+
+   cache.SetMemoryBudget(RSharedPageCache::kDefaultMemoryBudget);
+   cache.Clear();
+}
+
+TEST(RPageSourceFile, DiskCache)
+{
+   FileRaii fileGuard("test_ntuple_disk_cache.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 25 == 24)
+            ntuple->CommitCluster();
+      }
+   }
+
+   const std::string cacheDir = "test_ntuple_disk_cache.d";
+   auto fnListCache = [&cacheDir]() {
+      std::vector<std::string> paths;
+      auto dirp = gSystem->OpenDirectory(cacheDir.c_str());
+      if (!dirp)
+         return paths;
+      while (const char *entry = gSystem->GetDirEntry(dirp)) {
+         std::string name = entry;
+         if (name != "." && name != "..")
+            paths.emplace_back(cacheDir + "/" + name);
+      }
+      gSystem->FreeDirectory(dirp);
+      return paths;
+   };
+   auto fnClearCache = [&]() {
+      for (const auto &p : fnListCache())
+         gSystem->Unlink(p.c_str());
+      gSystem->Unlink(cacheDir.c_str());
+   };
+   auto fnRead = [&fileGuard](const RNTupleReadOptions &options) {
+      auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewPt = ntuple->GetView<float>("pt");
+      for (auto i : ntuple->GetEntryRange())
+         EXPECT_FLOAT_EQ(i, viewPt(i));
+      const auto &metrics = ntuple->GetMetrics();
+      return std::array<std::int64_t, 4>{
+         metrics.GetCounter("RNTupleReader.RPageSourceFile.nDiskCacheHit")->GetValueAsInt(),
+         metrics.GetCounter("RNTupleReader.RPageSourceFile.nDiskCacheMiss")->GetValueAsInt(),
+         metrics.GetCounter("RNTupleReader.RPageSourceFile.szReadPayload")->GetValueAsInt(),
+         metrics.GetCounter("RNTupleReader.RPageSourceFile.szDiskCacheWrite")->GetValueAsInt()};
+   };
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      fnClearCache();
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      options.SetDiskCacheDir(cacheDir);
+
+      auto counters = fnRead(options);
+      EXPECT_EQ(0, counters[0]);
+      EXPECT_EQ(4, counters[1]);
+      EXPECT_GT(counters[2], 0);
+      EXPECT_GT(counters[3], 0);
+      EXPECT_EQ(4U, fnListCache().size());
+
+      // Warm cache: no reads from the file
+      counters = fnRead(options);
+      EXPECT_EQ(4, counters[0]);
+      EXPECT_EQ(0, counters[1]);
+      EXPECT_EQ(0, counters[2]);
+      EXPECT_EQ(0, counters[3]);
+
+      // A corrupt page is detected, dropped, and read again from the file
+      auto path = fnListCache()[0];
+      FILE *f = fopen(path.c_str(), "r+b");
+      ASSERT_NE(nullptr, f);
+      auto c = fgetc(f);
+      fseek(f, 0, SEEK_SET);
+      fputc(~c & 0xff, f);
+      fclose(f);
+      {
+         ROOT::TestSupport::CheckDiagsRAII diags;
+         diags.requiredDiag(kWarning, "[ROOT.NTuple]", "removing corrupt page from disk cache", false);
+         counters = fnRead(options);
+      }
+      EXPECT_EQ(3, counters[0]);
+      EXPECT_EQ(1, counters[1]);
+      EXPECT_GT(counters[2], 0);
+      counters = fnRead(options);
+      EXPECT_EQ(4, counters[0]);
+      EXPECT_EQ(0, counters[1]);
+   }
+
+   // The cache does not grow beyond its size limit
+   fnClearCache();
+   RNTupleReadOptions options;
+   options.SetDiskCacheDir(cacheDir);
+   options.SetDiskCacheMaxSize(1);
+   auto counters = fnRead(options);
+   EXPECT_EQ(4, counters[1]);
+   EXPECT_EQ(0, counters[3]);
+   EXPECT_TRUE(fnListCache().empty());
+
+   fnClearCache();
+}
+
 TEST(RPageNullSink, Basics)
 {
    auto model = RNTupleModel::Create();
@@ -1292,6 +1292,187 @@ TEST(RNTuple, HalfPrecisionFloat)
    EXPECT_FLOAT_EQ(0.0f, (*fVec)[3]);
 }
 
+TEST(RNTuple, TruncatedAndQuantizedFloat)
+{
+   FileRaii fileGuard("test_ntuple_truncated_quantized_float.root");
+
+   auto fldTrunc = std::make_unique<RField<float>>("trunc");
+   EXPECT_THROW(fldTrunc->SetTruncated(9), RException);
+   fldTrunc->SetTruncated(16);
+   EXPECT_EQ(EColumnType::kReal32Trunc, fldTrunc->GetColumnRepresentative()[0]);
+   auto fldQuant = std::make_unique<RField<double>>("quant");
+   EXPECT_THROW(fldQuant->SetQuantized(1., 0., 8), RException);
+   EXPECT_THROW(fldQuant->SetQuantized(0., 1., 33), RException);
+   fldQuant->SetQuantized(0., 10., 8);
+   EXPECT_EQ(EColumnType::kReal32Quant, fldQuant->GetColumnRepresentative()[0]);
+   auto fldVec = RFieldBase::Create("vec", "std::vector<double>").Unwrap();
+   dynamic_cast<RField<double> *>(fldVec->GetSubFields()[0])->SetTruncated(20);
+
+   auto model = RNTupleModel::Create();
+   model->AddField(std::move(fldTrunc));
+   model->AddField(std::move(fldQuant));
+   model->AddField(std::move(fldVec));
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto trunc = writer->GetModel().GetDefaultEntry().GetPtr<float>("trunc");
+      auto quant = writer->GetModel().GetDefaultEntry().GetPtr<double>("quant");
+      auto vec = writer->GetModel().GetDefaultEntry().GetPtr<std::vector<double>>("vec");
+      *trunc = 3.14159f;
+      *quant = 5.0;
+      *vec = {0.1, -1.0};
+      writer->Fill();
+      *trunc = -1.f;
+      *quant = 10.0;
+      vec->clear();
+      writer->Fill();
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   const auto &truncModel = (*desc.GetColumnIterable(desc.FindFieldId("trunc")).begin()).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Trunc, truncModel.GetType());
+   EXPECT_EQ(16u, truncModel.GetBitsOnStorage());
+   EXPECT_FALSE(truncModel.GetValueRange());
+   const auto &quantModel = (*desc.GetColumnIterable(desc.FindFieldId("quant")).begin()).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Quant, quantModel.GetType());
+   EXPECT_EQ(8u, quantModel.GetBitsOnStorage());
+   ASSERT_TRUE(quantModel.GetValueRange());
+   EXPECT_EQ(0., quantModel.GetValueRange()->first);
+   EXPECT_EQ(10., quantModel.GetValueRange()->second);
+
+   auto trunc = reader->GetModel().GetDefaultEntry().GetPtr<float>("trunc");
+   auto quant = reader->GetModel().GetDefaultEntry().GetPtr<double>("quant");
+   auto vec = reader->GetModel().GetDefaultEntry().GetPtr<std::vector<double>>("vec");
+   reader->LoadEntry(0);
+   EXPECT_FLOAT_EQ(3.140625f, *trunc);
+   EXPECT_NEAR(5.0, *quant, 0.5 * 10. / 255.);
+   ASSERT_EQ(2u, vec->size());
+   EXPECT_DOUBLE_EQ(0.0999755859375, (*vec)[0]);
+   EXPECT_DOUBLE_EQ(-1.0, (*vec)[1]);
+   reader->LoadEntry(1);
+   EXPECT_FLOAT_EQ(-1.f, *trunc);
+   EXPECT_DOUBLE_EQ(10.0, *quant);
+   EXPECT_TRUE(vec->empty());
+
+   // The lossy column types require the number of bits on storage
+   auto modelNoBits = RNTupleModel::Create();
+   auto fldNoBits = std::make_unique<RField<float>>("f");
+   fldNoBits->SetColumnRepresentative({EColumnType::kReal32Trunc});
+   modelNoBits->AddField(std::move(fldNoBits));
+   EXPECT_THROW(RNTupleWriter::Recreate(std::move(modelNoBits), "ntuple", fileGuard.GetPath()), RException);
+}
+
+TEST(RNTuple, DictionaryEncodedString)
+{
+   FileRaii fileGuard("test_ntuple_dictionary_encoded_string.root");
+
+   const std::vector<std::string> triggers{"HLT_Mu20", "HLT_Ele32", "", "HLT_IsoMu24"};
+   auto fldTrigger = std::make_unique<RField<std::string>>("trigger");
+   EXPECT_FALSE(fldTrigger->IsDictionaryEncoded());
+   fldTrigger->SetDictionaryEncoded();
+   EXPECT_TRUE(fldTrigger->IsDictionaryEncoded());
+   auto fldTags = RFieldBase::Create("tags", "std::vector<std::string>").Unwrap();
+   dynamic_cast<RField<std::string> *>(fldTags->GetSubFields()[0])->SetDictionaryEncoded();
+
+   auto model = RNTupleModel::Create();
+   model->AddField(std::move(fldTrigger));
+   model->AddField(std::move(fldTags));
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto trigger = writer->GetModel().GetDefaultEntry().GetPtr<std::string>("trigger");
+      auto tags = writer->GetModel().GetDefaultEntry().GetPtr<std::vector<std::string>>("tags");
+      for (unsigned i = 0; i < 100; ++i) {
+         *trigger = triggers[i % triggers.size()];
+         *tags = {triggers[(i + 1) % triggers.size()], triggers[i % 2]};
+         writer->Fill();
+         if (i == 49)
+            writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   std::vector<EColumnType> columnTypes;
+   for (const auto &c : desc.GetColumnIterable(desc.FindFieldId("trigger")))
+      columnTypes.emplace_back(c.GetModel().GetType());
+   EXPECT_EQ((std::vector<EColumnType>{EColumnType::kSplitUInt32, EColumnType::kSplitIndex64, EColumnType::kChar}),
+             columnTypes);
+   // Only the distinct strings of every cluster are stored
+   const auto charColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("trigger"), 2);
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      EXPECT_EQ(triggers.size(), clusterDesc.GetColumnRange(desc.FindPhysicalColumnId(desc.FindFieldId("trigger"), 1))
+                                    .fNElements);
+      EXPECT_EQ(28u, clusterDesc.GetColumnRange(charColumnId).fNElements);
+   }
+
+   auto viewTrigger = reader->GetView<std::string>("trigger");
+   auto viewTags = reader->GetView<std::vector<std::string>>("tags");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_EQ(triggers[i % triggers.size()], viewTrigger(i));
+      EXPECT_EQ((std::vector<std::string>{triggers[(i + 1) % triggers.size()], triggers[i % 2]}), viewTags(i));
+   }
+
+   // Equality filtering on the dictionary indexes
+   unsigned nMatches = 0;
+   RClusterIndex match;
+   for (auto i : reader->GetEntryRange()) {
+      auto dictionaryIndex = viewTrigger.GetDictionaryIndex(i);
+      if (dictionaryIndex.GetClusterId() != match.GetClusterId())
+         match = viewTrigger.FindInDictionary(dictionaryIndex.GetClusterId(), "HLT_Ele32");
+      if (dictionaryIndex == match) {
+         EXPECT_EQ("HLT_Ele32", viewTrigger(i));
+         nMatches++;
+      }
+   }
+   EXPECT_EQ(25u, nMatches);
+   const auto firstClusterId = desc.FindClusterId(0, 0);
+   EXPECT_EQ(RClusterIndex(), viewTrigger.FindInDictionary(firstClusterId, "HLT_Unknown"));
+
+   auto viewPlain = reader->GetView<std::string>("tags._0");
+   EXPECT_EQ(triggers[1], viewPlain(0));
+}
+
+TEST(RNTuple, DictionaryEncodedStringLateExtension)
+{
+   FileRaii fileGuard("test_ntuple_dictionary_encoded_string_late_extension.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto ptrPt = model->MakeField<float>("pt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      *ptrPt = 1.0;
+      writer->Fill();
+      writer->CommitCluster();
+      writer->Fill();
+
+      // The field is added in the middle of the second cluster
+      auto fldTrigger = std::make_unique<RField<std::string>>("trigger");
+      fldTrigger->SetDictionaryEncoded();
+      auto modelUpdater = writer->CreateModelUpdater();
+      modelUpdater->BeginUpdate();
+      modelUpdater->AddField(std::move(fldTrigger));
+      modelUpdater->CommitUpdate();
+      auto ptrTrigger = writer->GetModel().GetDefaultEntry().GetPtr<std::string>("trigger");
+      *ptrTrigger = "HLT_Mu20";
+      writer->Fill();
+      *ptrTrigger = "HLT_Ele32";
+      writer->Fill();
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(4U, reader->GetNEntries());
+   EXPECT_TRUE(static_cast<const RField<std::string> &>(reader->GetModel().GetField("trigger")).IsDictionaryEncoded());
+   auto viewTrigger = reader->GetView<std::string>("trigger");
+   EXPECT_TRUE(viewTrigger.GetField().IsDictionaryEncoded());
+   // Entries before the extension read as empty strings, in the first cluster without a dictionary as well as in
+   // the second cluster, whose dictionary starts with the strings of the later entries
+   EXPECT_EQ("", viewTrigger(0));
+   EXPECT_EQ("", viewTrigger(1));
+   EXPECT_EQ("HLT_Mu20", viewTrigger(2));
+   EXPECT_EQ("HLT_Ele32", viewTrigger(3));
+   const auto dictionaryIndex = viewTrigger.GetDictionaryIndex(1);
+   EXPECT_EQ(dictionaryIndex, viewTrigger.FindInDictionary(dictionaryIndex.GetClusterId(), ""));
+}
+
 TEST(RNTuple, Double32)
 {
    FileRaii fileGuard("test_ntuple_double32.root");
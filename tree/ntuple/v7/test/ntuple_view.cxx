@@ -131,6 +131,64 @@ TEST(RNTuple, BulkViewCollection)
    }
 }
 
+TEST(RNTuple, SpanView)
+{
+   FileRaii fileGuard("test_ntuple_span_view.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldVec = model->MakeField<std::vector<double>>("vec");
+   auto eltsPerPage = 1000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(eltsPerPage * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = i;
+         *fieldVec = std::vector<double>(i % 5, i);
+         ntuple->Fill();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+
+   // Within a page, the span points into the page
+   auto span = viewPt.GetSpan(10, 100);
+   ASSERT_EQ(100u, span.size());
+   NTupleSize_t nPageItems = 0;
+   EXPECT_EQ(viewPt.MapV(10, nPageItems), span.data());
+   for (std::size_t i = 0; i < span.size(); ++i)
+      EXPECT_FLOAT_EQ(10 + i, span[i]);
+
+   // Across pages, the values are copied
+   auto spanCopy = viewPt.GetSpan(eltsPerPage - 10, 3 * eltsPerPage);
+   ASSERT_EQ(3u * eltsPerPage, spanCopy.size());
+   for (std::size_t i = 0; i < spanCopy.size(); ++i)
+      EXPECT_FLOAT_EQ(eltsPerPage - 10 + i, spanCopy[i]);
+   auto spanCluster = viewPt.GetSpan(RClusterIndex(0, 5), 2);
+   EXPECT_FLOAT_EQ(5, spanCluster[0]);
+   EXPECT_FLOAT_EQ(6, spanCluster[1]);
+   EXPECT_TRUE(viewPt.GetSpan(0, 0).empty());
+
+   auto viewVec = ntuple->GetViewCollection("vec");
+   auto viewVecData = viewVec.GetView<double>("_0");
+   for (NTupleSize_t first : {0, 1, 3 * eltsPerPage}) {
+      const NTupleSize_t count = 2 * eltsPerPage;
+      auto offsets = viewVec.GetOffsetSpan(RClusterIndex(0, first), count);
+      ASSERT_EQ(count + 1, offsets.size());
+      const auto firstItem = offsets[0];
+      const auto nItems = offsets[count] - firstItem;
+      auto items = viewVecData.GetSpan(RClusterIndex(0, firstItem), nItems);
+      ASSERT_EQ(nItems, items.size());
+      for (NTupleSize_t i = 0; i < count; ++i) {
+         const auto entry = first + i;
+         ASSERT_EQ(entry % 5, offsets[i + 1] - offsets[i]);
+         for (std::uint64_t j = offsets[i]; j < offsets[i + 1]; ++j)
+            EXPECT_DOUBLE_EQ(entry, items[j - firstItem]);
+      }
+   }
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
@@ -30,6 +30,7 @@
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 class TLeaf;
@@ -91,6 +92,13 @@ float jet_eta[njets]
 ~~~
     These projections are meta-data only operations and don't involve duplicating the data.
 
+With implicit multi-threading enabled, the import can process the clusters of the input tree in parallel (see
+`SetUseParallelImport()`).  Every task reads a contiguous range of tree clusters through its own copy of the input tree
+and fills its own RNTupleFillContext of an RNTupleParallelWriter.  The RNTuple clusters are aligned with the tree
+clusters: no RNTuple cluster contains entries from more than one tree cluster.  The entries of every tree cluster stay
+in order but the tree clusters may be written in any order.  Parallel import requires that the importer is created
+from the input file name; otherwise the import falls back to sequential processing.
+
 Current limitations of the importer:
   - No support for trees containing TClonesArray collections
   - Due to RNTuple currently storing data fully split, "don't split" markers are ignored
@@ -178,9 +186,10 @@ private:
       RImportLeafCountCollection(RImportLeafCountCollection &&other) = default;
       RImportLeafCountCollection &operator=(const RImportLeafCountCollection &other) = delete;
       RImportLeafCountCollection &operator=(RImportLeafCountCollection &&other) = default;
-      std::unique_ptr<RNTupleModel> fCollectionModel;             ///< The model for the collection itself
-      std::shared_ptr<RCollectionNTupleWriter> fCollectionWriter; ///< Used to fill the collection elements per event
-      std::unique_ptr<REntry> fCollectionEntry; ///< Keeps the memory location of the collection members
+      std::unique_ptr<RNTupleModel> fCollectionModel; ///< The model for the collection itself
+      /// Used to fill the collection elements per event. Its default entry is bound to the memory locations of the
+      /// collection members. For parallel imports, it is the writer of the collection field of the fill context.
+      std::shared_ptr<RCollectionNTupleWriter> fCollectionWriter;
       /// The number of elements for the collection for a particular event. Used as a destination for SetBranchAddress()
       /// of the count leaf
       std::unique_ptr<Int_t> fCountVal;
@@ -214,6 +223,10 @@ private:
 
    std::unique_ptr<TFile> fSourceFile;
    TTree *fSourceTree;
+   /// Set if the importer is created from the input file name; required for parallel import, where every task opens
+   /// its own copy of the input tree
+   std::string fSourceFileName;
+   std::string fSourceTreeName;
 
    std::string fDestFileName;
    std::string fNTupleName;
@@ -229,6 +242,8 @@ private:
 
    /// No standard output, conversely if set to false, schema information and progress is printed.
    bool fIsQuiet = false;
+   /// Process the input tree clusters in parallel if implicit multi-threading is enabled
+   bool fUseParallelImport = false;
    std::unique_ptr<RProgressCallback> fProgressCallback;
 
    std::unique_ptr<RNTupleModel> fModel;
@@ -246,7 +261,14 @@ private:
    /// Sets up the connection from TTree branches to RNTuple fields, including initialization of the memory
    /// buffers used for reading and writing.
    RResult<void> PrepareSchema();
+   /// Binds the given entry and the default entries of the untyped collection writers to the import buffers
+   void ConnectEntry(REntry &entry);
    void ReportSchema();
+   /// Reads the given entry from the input tree, applies the transformations and fills the untyped collections.
+   /// The caller fills the resulting entry into the RNTuple.
+   void ConvertEntry(std::int64_t entry);
+   void ImportSequential(std::int64_t nEntries);
+   void ImportParallel(std::int64_t nEntries);
 
 public:
    RNTupleImporter(const RNTupleImporter &other) = delete;
@@ -274,11 +296,16 @@ public:
    /// Whether or not information and progress is printed to stdout.
    void SetIsQuiet(bool value) { fIsQuiet = value; }
 
+   /// Whether or not to process the input tree clusters in parallel.  Only effective with implicit multi-threading
+   /// enabled and if the importer was created from the input file name.  Note that the order of the tree clusters is
+   /// not preserved in the output.
+   void SetUseParallelImport(bool value) { fUseParallelImport = value; }
+
    /// Import works in two steps:
    /// 1. PrepareSchema() calls SetBranchAddress() on all the TTree branches and creates the corresponding RNTuple
    ///    fields and the model
    /// 2. An event loop reads every entry from the TTree, applies transformations where necessary, and writes the
-   ///    output entry to the RNTuple.
+   ///    output entry to the RNTuple.  For parallel imports, there is one such event loop per task.
    void Import();
 }; // class RNTupleImporter
 
@@ -18,10 +18,15 @@
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleImporter.hxx>
 #include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <string_view>
+#ifdef R__USE_IMT
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <TBranch.h>
 #include <TChain.h>
@@ -31,11 +36,15 @@
 #include <TLeafC.h>
 #include <TLeafElement.h>
 #include <TLeafObject.h>
+#include <TROOT.h> // for IsImplicitMTEnabled()
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <mutex>
 #include <utility>
 
 namespace {
@@ -44,6 +53,17 @@ class RDefaultProgressCallback : public ROOT::Experimental::RNTupleImporter::RPr
 private:
    static constexpr std::uint64_t gUpdateFrequencyBytes = 50 * 1000 * 1000; // report every 50MB
    std::uint64_t fNbytesNext = gUpdateFrequencyBytes;
+   std::chrono::steady_clock::time_point fStart = std::chrono::steady_clock::now();
+
+   /// Prints the throughput since the start of the import, based on the compressed output size
+   void PrintThroughput(std::uint64_t nbytesWritten, std::uint64_t neventsWritten)
+   {
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - fStart;
+      if (elapsed.count() <= 0)
+         return;
+      std::cout << " (" << static_cast<std::uint64_t>(neventsWritten / elapsed.count()) << " entries/s, "
+                << nbytesWritten / 1000. / 1000. / elapsed.count() << "MB/s)";
+   }
 
 public:
    ~RDefaultProgressCallback() override {}
@@ -52,13 +72,17 @@ public:
       // Report if more than 50MB (compressed) where written since the last status update
       if (nbytesWritten < fNbytesNext)
          return;
-      std::cout << "Wrote " << nbytesWritten / 1000 / 1000 << "MB, " << neventsWritten << " entries" << std::endl;
+      std::cout << "Wrote " << nbytesWritten / 1000 / 1000 << "MB, " << neventsWritten << " entries";
+      PrintThroughput(nbytesWritten, neventsWritten);
+      std::cout << std::endl;
       fNbytesNext += gUpdateFrequencyBytes;
    }
 
    void Finish(std::uint64_t nbytesWritten, std::uint64_t neventsWritten) final
    {
-      std::cout << "Done, wrote " << nbytesWritten / 1000 / 1000 << "MB, " << neventsWritten << " entries" << std::endl;
+      std::cout << "Done, wrote " << nbytesWritten / 1000 / 1000 << "MB, " << neventsWritten << " entries";
+      PrintThroughput(nbytesWritten, neventsWritten);
+      std::cout << std::endl;
    }
 };
 
@@ -87,6 +111,8 @@ ROOT::Experimental::RNTupleImporter::Create(std::string_view sourceFileName, std
 {
    auto importer = std::unique_ptr<RNTupleImporter>(new RNTupleImporter());
    importer->fNTupleName = treeName;
+   importer->fSourceFileName = sourceFileName;
+   importer->fSourceTreeName = treeName;
    importer->fSourceFile = std::unique_ptr<TFile>(TFile::Open(std::string(sourceFileName).c_str()));
    if (!importer->fSourceFile || importer->fSourceFile->IsZombie()) {
       throw RException(R__FAIL("cannot open source file " + std::string(sourceFileName)));
@@ -194,7 +220,8 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::PrepareSc
          // Count leaf branches do not end up as (physical) fields but they trigger the creation of an untyped
          // collection, together the collection mode.
          RImportLeafCountCollection c;
-         c.fCollectionModel = RNTupleModel::CreateBare();
+         // The default entry of the collection model is handed over to the collection writer
+         c.fCollectionModel = RNTupleModel::Create();
          c.fMaxLength = firstLeaf->GetMaximum();
          c.fCountVal = std::make_unique<Int_t>(); // count leafs are integers
          // Casting to void * makes it work for both Int_t and UInt_t
@@ -321,13 +348,6 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::PrepareSc
       // structured binding in C++17. Explicitly defining a variable works.
       auto &countLeafName = p.first;
       auto &c = p.second;
-      c.fCollectionModel->Freeze();
-      c.fCollectionEntry = c.fCollectionModel->CreateBareEntry();
-      for (auto idx : c.fImportFieldIndexes) {
-         const auto name = fImportFields[idx].fField->GetFieldName();
-         const auto buffer = fImportFields[idx].fFieldBuffer;
-         c.fCollectionEntry->BindRawPtr(name, buffer);
-      }
       c.fFieldName = "_collection" + std::to_string(iLeafCountCollection);
       c.fCollectionWriter = fModel->MakeCollection(c.fFieldName, std::move(c.fCollectionModel));
       // Add projected fields for all leaf count arrays
@@ -351,19 +371,55 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::PrepareSc
 
    fModel->Freeze();
    fEntry = fModel->CreateBareEntry();
+   ConnectEntry(*fEntry);
+
+   if (!fIsQuiet)
+      ReportSchema();
+
+   return RResult<void>::Success();
+}
+
+void ROOT::Experimental::RNTupleImporter::ConnectEntry(REntry &entry)
+{
    for (const auto &f : fImportFields) {
       if (f.fIsInUntypedCollection)
          continue;
-      fEntry->BindRawPtr(f.fField->GetFieldName(), f.fFieldBuffer);
+      entry.BindRawPtr(f.fField->GetFieldName(), f.fFieldBuffer);
    }
    for (const auto &[_, c] : fLeafCountCollections) {
-      fEntry->BindRawPtr<void>(c.fFieldName, c.fCollectionWriter->GetOffsetPtr());
+      auto collectionEntry = c.fCollectionWriter->GetDefaultEntry();
+      for (auto idx : c.fImportFieldIndexes) {
+         collectionEntry->BindRawPtr(fImportFields[idx].fField->GetFieldName(), fImportFields[idx].fFieldBuffer);
+      }
+      entry.BindRawPtr<void>(c.fFieldName, c.fCollectionWriter->GetOffsetPtr());
    }
+}
 
-   if (!fIsQuiet)
-      ReportSchema();
+void ROOT::Experimental::RNTupleImporter::ConvertEntry(std::int64_t entry)
+{
+   fSourceTree->GetEntry(entry);
 
-   return RResult<void>::Success();
+   // The collection items are copied one by one from the branch buffers into the memory locations of the collection
+   // members, which are reused for all entries
+   for (const auto &[_, c] : fLeafCountCollections) {
+      for (Int_t l = 0; l < *c.fCountVal; ++l) {
+         for (auto &t : c.fTransformations) {
+            auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
+            if (!result)
+               throw RException(R__FORWARD_ERROR(result));
+         }
+         c.fCollectionWriter->Fill();
+      }
+      for (auto &t : c.fTransformations)
+         t->ResetEntry();
+   }
+
+   for (auto &t : fImportTransformations) {
+      auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
+      if (!result)
+         throw RException(R__FORWARD_ERROR(result));
+      t->ResetEntry();
+   }
 }
 
 void ROOT::Experimental::RNTupleImporter::Import()
@@ -371,8 +427,27 @@ void ROOT::Experimental::RNTupleImporter::Import()
    if (fDestFile->FindKey(fNTupleName.c_str()) != nullptr)
       throw RException(R__FAIL("Key '" + fNTupleName + "' already exists in file " + fDestFileName));
 
-   PrepareSchema();
+   auto result = PrepareSchema();
+   if (!result)
+      throw RException(R__FORWARD_ERROR(result));
+
+   auto nEntries = fSourceTree->GetEntries();
 
+   if (fMaxEntries >= 0 && fMaxEntries < nEntries) {
+      nEntries = fMaxEntries;
+   }
+
+#ifdef R__USE_IMT
+   if (fUseParallelImport && ROOT::IsImplicitMTEnabled() && !fSourceFileName.empty()) {
+      ImportParallel(nEntries);
+      return;
+   }
+#endif
+   ImportSequential(nEntries);
+}
+
+void ROOT::Experimental::RNTupleImporter::ImportSequential(std::int64_t nEntries)
+{
    auto sink = std::make_unique<Detail::RPageSinkFile>(fNTupleName, *fDestFile, fWriteOptions);
    sink->GetMetrics().Enable();
    auto ctrZippedBytes = sink->GetMetrics().GetCounter("RPageSinkFile.szWritePayload");
@@ -383,40 +458,87 @@ void ROOT::Experimental::RNTupleImporter::Import()
 
    fProgressCallback = fIsQuiet ? nullptr : std::make_unique<RDefaultProgressCallback>();
 
-   auto nEntries = fSourceTree->GetEntries();
+   for (decltype(nEntries) i = 0; i < nEntries; ++i) {
+      ConvertEntry(i);
+      ntplWriter->Fill(*fEntry);
 
-   if (fMaxEntries >= 0 && fMaxEntries < nEntries) {
-      nEntries = fMaxEntries;
+      if (fProgressCallback)
+         fProgressCallback->Call(ctrZippedBytes->GetValueAsInt(), i);
    }
+   if (fProgressCallback)
+      fProgressCallback->Finish(ctrZippedBytes->GetValueAsInt(), nEntries);
+}
 
-   for (decltype(nEntries) i = 0; i < nEntries; ++i) {
-      fSourceTree->GetEntry(i);
-
-      for (const auto &[_, c] : fLeafCountCollections) {
-         for (Int_t l = 0; l < *c.fCountVal; ++l) {
-            for (auto &t : c.fTransformations) {
-               auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
-               if (!result)
-                  throw RException(R__FORWARD_ERROR(result));
-            }
-            c.fCollectionWriter->Fill(c.fCollectionEntry.get());
-         }
-         for (auto &t : c.fTransformations)
-            t->ResetEntry();
+void ROOT::Experimental::RNTupleImporter::ImportParallel(std::int64_t nEntries)
+{
+#ifdef R__USE_IMT
+   std::vector<std::pair<std::int64_t, std::int64_t>> clusterRanges;
+   auto clusterIter = fSourceTree->GetClusterIterator(0);
+   for (Long64_t start = clusterIter(); start < nEntries; start = clusterIter()) {
+      clusterRanges.emplace_back(start, std::min<std::int64_t>(clusterIter.GetNextEntry(), nEntries));
+   }
+
+   auto ntplWriter = RNTupleParallelWriter::Append(std::move(fModel), fNTupleName, *fDestFile, fWriteOptions);
+   ntplWriter->EnableMetrics();
+   auto ctrZippedBytes = ntplWriter->GetMetrics().GetCounter("RNTupleParallelWriter.RPageSinkFile.szWritePayload");
+   // The guard needs to be destructed before the writer goes out of scope
+   RImportGuard importGuard(*this);
+
+   fProgressCallback = fIsQuiet ? nullptr : std::make_unique<RDefaultProgressCallback>();
+   std::mutex progressLock;
+   std::uint64_t nEntriesWritten = 0;
+
+   // Every task processes a contiguous range of tree clusters, so that the set up cost of opening the input tree and
+   // connecting the branches is paid only once per task
+   const std::size_t nTasks = std::min<std::size_t>(clusterRanges.size(), ROOT::GetThreadPoolSize());
+   auto fnImportClusters = [&](unsigned int iTask) {
+      auto taskImporter = std::unique_ptr<RNTupleImporter>(new RNTupleImporter());
+      taskImporter->fSourceFile = std::unique_ptr<TFile>(TFile::Open(fSourceFileName.c_str()));
+      if (!taskImporter->fSourceFile || taskImporter->fSourceFile->IsZombie())
+         throw RException(R__FAIL("cannot open source file " + fSourceFileName));
+      taskImporter->fSourceTree = taskImporter->fSourceFile->Get<TTree>(fSourceTreeName.c_str());
+      if (!taskImporter->fSourceTree)
+         throw RException(R__FAIL("cannot read TTree " + fSourceTreeName + " from " + fSourceFileName));
+      taskImporter->fSourceTree->SetImplicitMT(false);
+      taskImporter->fConvertDotsInBranchNames = fConvertDotsInBranchNames;
+      taskImporter->fIsQuiet = true;
+      auto result = taskImporter->PrepareSchema();
+      if (!result)
+         throw RException(R__FORWARD_ERROR(result));
+
+      auto fillContext = ntplWriter->CreateFillContext();
+      // The untyped collections are filled through the collection writers of the context's model
+      for (auto &[_, c] : taskImporter->fLeafCountCollections) {
+         const auto &field = fillContext->GetModel().GetField(c.fFieldName);
+         c.fCollectionWriter = static_cast<const RCollectionField &>(field).GetCollectionWriter();
       }
+      auto entry = fillContext->CreateEntry();
+      taskImporter->ConnectEntry(*entry);
+
+      const auto firstRange = iTask * clusterRanges.size() / nTasks;
+      const auto lastRange = (iTask + 1) * clusterRanges.size() / nTasks;
+      for (auto r = firstRange; r < lastRange; ++r) {
+         const auto [start, end] = clusterRanges[r];
+         for (auto i = start; i < end; ++i) {
+            taskImporter->ConvertEntry(i);
+            fillContext->Fill(*entry);
+         }
+         // Align the RNTuple clusters with the tree clusters
+         fillContext->CommitCluster();
 
-      for (auto &t : fImportTransformations) {
-         auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
-         if (!result)
-            throw RException(R__FORWARD_ERROR(result));
-         t->ResetEntry();
+         std::lock_guard<std::mutex> guard(progressLock);
+         nEntriesWritten += end - start;
+         if (fProgressCallback)
+            fProgressCallback->Call(ctrZippedBytes->GetValueAsInt(), nEntriesWritten);
       }
+   };
 
-      ntplWriter->Fill(*fEntry);
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(fnImportClusters, ROOT::TSeqU(nTasks));
 
-      if (fProgressCallback)
-         fProgressCallback->Call(ctrZippedBytes->GetValueAsInt(), i);
-   }
    if (fProgressCallback)
       fProgressCallback->Finish(ctrZippedBytes->GetValueAsInt(), nEntries);
+#else
+   ImportSequential(nEntries);
+#endif
 }
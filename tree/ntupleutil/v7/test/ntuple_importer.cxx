@@ -1,6 +1,8 @@
 #include <ROOT/RNTupleImporter.hxx>
+#include <ROOT/RVec.hxx>
 
 #include <TFile.h>
+#include <TROOT.h>
 #include <TTree.h>
 #include <TChain.h>
 
@@ -656,3 +658,61 @@ TEST(RNTUpleImporter, MaxEntries)
    reader = RNTupleReader::Open("ntuple4", fileGuard.GetPath());
    EXPECT_EQ(5U, reader->GetNEntries());
 }
+
+#ifdef R__USE_IMT
+TEST(RNTupleImporter, Parallel)
+{
+   FileRaii fileGuard("test_ntuple_importer_parallel.root");
+   {
+      std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str(), "RECREATE"));
+      auto tree = std::make_unique<TTree>("tree", "");
+      // Start a new tree cluster every 10 entries
+      tree->SetAutoFlush(10);
+      Int_t a;
+      Int_t njets;
+      float jet_pt[3];
+      tree->Branch("a", &a);
+      tree->Branch("njets", &njets);
+      tree->Branch("jet_pt", jet_pt, "jet_pt[njets]");
+      for (int i = 0; i < 100; ++i) {
+         a = i;
+         njets = i % 4;
+         for (int j = 0; j < njets; ++j)
+            jet_pt[j] = i + j;
+         tree->Fill();
+      }
+      tree->Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   auto importer = RNTupleImporter::Create(fileGuard.GetPath(), "tree", fileGuard.GetPath());
+   importer->SetIsQuiet(true);
+   importer->SetNTupleName("ntuple");
+   importer->SetUseParallelImport(true);
+   importer->Import();
+   ROOT::DisableImplicitMT();
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(100U, reader->GetNEntries());
+   // Every RNTuple cluster corresponds to exactly one tree cluster
+   EXPECT_EQ(10U, reader->GetDescriptor().GetNClusters());
+
+   auto viewA = reader->GetView<std::int32_t>("a");
+   auto viewJetPt = reader->GetView<ROOT::RVec<float>>("jet_pt");
+   std::vector<bool> seen(100, false);
+   for (auto i : reader->GetEntryRange()) {
+      const auto a = viewA(i);
+      ASSERT_GE(a, 0);
+      ASSERT_LT(a, 100);
+      EXPECT_FALSE(seen[a]);
+      seen[a] = true;
+      // Entries within a tree cluster stay in order
+      if (a % 10 != 0)
+         EXPECT_EQ(a - 1, viewA(i - 1));
+      const auto &jetPt = viewJetPt(i);
+      ASSERT_EQ(static_cast<std::size_t>(a % 4), jetPt.size());
+      for (std::size_t j = 0; j < jetPt.size(); ++j)
+         EXPECT_FLOAT_EQ(static_cast<float>(a + j), jetPt[j]);
+   }
+}
+#endif
@@ -96,4 +96,7 @@
 #pragma link C++ class ROOT::Internal::TreeUtils::RNoCleanupNotifier;
 #pragma link C++ class TNotifyLink<ROOT::Internal::TreeUtils::RNoCleanupNotifierHelper>;
 
+#pragma link C++ class ROOT::Experimental::TTreeParallelWriter-;
+#pragma link C++ class ROOT::Experimental::TTreeFillContext-;
+
 #endif
@@ -0,0 +1,151 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeParallelWriter
+#define ROOT_TTreeParallelWriter
+
+#include "Rtypes.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+class TTree;
+
+namespace ROOT {
+namespace Experimental {
+
+class TTreeParallelWriter;
+
+/**
+ * \class ROOT::Experimental::TTreeFillContext
+ * \ingroup tree
+ *
+ * A TTreeFillContext fills entries of the tree of a TTreeParallelWriter from
+ * one thread. It owns a clone of the tree, on which the thread sets its own
+ * branch addresses. The baskets of the clone are compressed and written to
+ * the output file by the filling thread; every time a cluster is complete,
+ * its entries are appended to the tree of the TTreeParallelWriter.
+ *
+ * A TTreeFillContext must only be used by one thread at a time.
+ */
+class TTreeFillContext {
+   friend class TTreeParallelWriter;
+
+   TTreeParallelWriter &fWriter;
+   TTree *fTree = nullptr;    ///< The clone filled by this context, owned
+   Long64_t fClusterSize = 0; ///< The fAutoFlush setting of the tree of the writer
+
+   TTreeFillContext(TTreeParallelWriter &writer, TTree *tree);
+   bool IsClusterFull() const;
+   std::unique_lock<std::mutex> LockBasketWrites();
+
+public:
+   TTreeFillContext(const TTreeFillContext &) = delete;
+   TTreeFillContext &operator=(const TTreeFillContext &) = delete;
+
+   /** Destructor, commits the remaining entries as a last cluster. */
+   ~TTreeFillContext();
+
+   /** Returns the tree on which the branch addresses of this context are set. */
+   TTree *GetTree() const { return fTree; }
+
+   /** Fills one entry, as TTree::Fill, from the addresses set on GetTree().
+    *  Commits the cluster when it is complete according to the auto flush
+    *  setting of the tree of the TTreeParallelWriter.
+    *  Without implicit multi-threading, holds the lock of the writer.
+    *  Returns the number of bytes filled, or -1 in case of error.
+    */
+   Int_t Fill();
+
+   /** Writes the baskets of the entries filled so far and appends them, as
+    *  one cluster, to the tree of the TTreeParallelWriter.
+    *  Returns the number of entries committed, or -1 in case of error: the
+    *  tree of the writer is then left unchanged and the entries are dropped.
+    */
+   Long64_t FlushCluster();
+};
+
+/**
+ * \class ROOT::Experimental::TTreeParallelWriter
+ * \ingroup tree
+ *
+ * TTreeParallelWriter lets several threads fill the same TTree concurrently.
+ * Each thread uses its own TTreeFillContext; the expensive part of the
+ * filling, i.e. the serialization and the compression of the baskets, runs
+ * in parallel and the baskets are written directly into the file of the tree.
+ * Only the bookkeeping of a complete cluster is appended to the tree under a
+ * lock. Unlike TBufferMerger, no intermediate in-memory file is needed.
+ *
+ * ~~~ {.cpp}
+ * TFile file("out.root", "RECREATE");
+ * TTree tree("events", "events");
+ * float px = 0;
+ * tree.Branch("px", &px);
+ * {
+ *    ROOT::Experimental::TTreeParallelWriter writer(tree);
+ *    auto work = [&writer]() {
+ *       auto context = writer.CreateFillContext();
+ *       float localPx = 0;
+ *       context->GetTree()->SetBranchAddress("px", &localPx);
+ *       for (int i = 0; i < 1000; ++i) {
+ *          localPx = i;
+ *          context->Fill();
+ *       }
+ *    };
+ *    std::thread t1(work), t2(work);
+ *    t1.join();
+ *    t2.join();
+ * }
+ * file.Write();
+ * ~~~
+ *
+ * The clusters of the different contexts are appended in the order they are
+ * completed, so the order of the entries in the tree is not deterministic.
+ * The contexts must be destroyed before the writer, and the writer before the
+ * tree is written. In the meantime, the tree must not be filled directly.
+ * Trees with a TBranchRef and the switch to a new file when the tree reaches
+ * TTree::GetMaxTreeSize() are not supported.
+ *
+ * In builds without implicit multi-threading (R__USE_IMT not defined), TFile
+ * does not serialize the writing of baskets by itself. TTreeFillContext::Fill
+ * and TTreeFillContext::FlushCluster then hold the lock of the writer for the
+ * whole filling, including the serialization and the compression of the
+ * baskets: the contexts fill strictly one at a time and there is no speedup
+ * over filling the tree from a single thread.
+ */
+class TTreeParallelWriter {
+   friend class TTreeFillContext;
+
+   TTree &fTree;
+   std::mutex fMutex;            ///< Protects fTree and its directory
+   std::size_t fNContexts = 0;   ///< Number of alive fill contexts
+
+public:
+   /** Constructor
+    *  @param tree The tree to fill, attached to a file opened for writing.
+    *  Throws std::runtime_error if the tree cannot be filled in parallel.
+    */
+   explicit TTreeParallelWriter(TTree &tree);
+   TTreeParallelWriter(const TTreeParallelWriter &) = delete;
+   TTreeParallelWriter &operator=(const TTreeParallelWriter &) = delete;
+
+   /** Destructor */
+   ~TTreeParallelWriter();
+
+   /** Returns a new context to fill entries from the calling thread. */
+   std::unique_ptr<TTreeFillContext> CreateFillContext();
+
+   /** Returns the tree filled by this writer. */
+   TTree &GetTree() const { return fTree; }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
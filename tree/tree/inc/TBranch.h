@@ -72,6 +72,8 @@ class TBulkBranchRead {
 public:
    /// See TBranch::GetBulkEntries(Long64_t evt, TBuffer &user_buf);
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
+   /// See TBranch::GetBulkEntries(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    /// See TBranch::GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    /// See TBranch::GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
@@ -176,12 +178,15 @@ protected:
 
    TString  GetRealFileName() const;
 
+   bool         CanImportBaskets(const TBranch &from) const;
+   virtual void ImportBaskets(TBranch &from);
    virtual void SetAddressImpl(void *addr, bool /* implied */) { SetAddress(addr); }
 
 private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
-   Int_t    GetBulkEntries(Long64_t, TBuffer&);
+   Int_t    GetBulkEntries(Long64_t N, TBuffer& user_buf) {return GetBulkEntries(N, user_buf, nullptr);}
+   Int_t    GetBulkEntries(Long64_t, TBuffer&, TBuffer*);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
@@ -318,6 +323,7 @@ namespace Experimental {
 namespace Internal {
 
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetBulkEntries(evt, user_buf, count_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
 inline bool   TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
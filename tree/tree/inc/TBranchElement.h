@@ -118,6 +118,7 @@ protected:
    TStreamerInfo           *FindOnfileInfo(TClass *valueClass, const TObjArray &branches) const;
    TClass                  *GetParentClass(); // Class referenced by fParentName
    TStreamerInfo           *GetInfoImp() const;
+   void                     ImportBaskets(TBranch &from) override;
    void                     ReleaseObject();
    void                     SetupInfo();
    void                     SetBranchCount(TBranchElement* bre);
@@ -151,7 +151,9 @@ public:
    virtual void     PrintValue(Int_t i = 0) const;
    virtual void     ReadBasket(TBuffer &) {}
    virtual void     ReadBasketExport(TBuffer &, TClonesArray *, Int_t) {}
-   virtual bool     ReadBasketFast(TBuffer&, Long64_t) { return false; }  // Read contents of leaf into a user-provided buffer.
+   /// Deserialize in place the contents of a basket in a user-provided buffer.  The second argument is the number of
+   /// entries or, for leaves with a leaf count, the number of groups of GetLenStatic() elements in the basket.
+   virtual bool     ReadBasketFast(TBuffer&, Long64_t) { return false; }
    virtual bool     ReadBasketSerialized(TBuffer&, Long64_t) { return true; }
    virtual void     ReadValue(std::istream & /*s*/, Char_t /*delim*/ = ' ') {
       Error("ReadValue", "Not implemented!");
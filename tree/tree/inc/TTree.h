@@ -76,6 +76,12 @@ class TTreeCloner;
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
+namespace ROOT {
+namespace Experimental {
+class TTreeFillContext;
+}
+}
+
 class TTree : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    using TIOFeatures = ROOT::TIOFeatures;
@@ -165,6 +171,7 @@ private:
    Int_t            FlushBasketsImpl() const;
    void             MarkEventCluster();
    Long64_t         GetMedianClusterSize();
+   Long64_t         ImportCluster(TTree &from);
 
 protected:
    virtual void     KeepCircular();
@@ -206,6 +213,8 @@ protected:
    friend class TChainIndex;
    // So that the TTreeCloner can access the protected interfaces
    friend class TTreeCloner;
+   // So that the clusters filled in parallel can be appended
+   friend class ROOT::Experimental::TTreeFillContext;
 
    // use to update fFriendLockStatus
    enum ELockStatusBits {
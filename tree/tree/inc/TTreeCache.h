@@ -23,6 +23,7 @@
 
 #include "TFileCacheRead.h"
 
+#include <memory>
 #include <vector>
 
 class TTree;
@@ -104,6 +105,19 @@ protected:
 
    std::unique_ptr<MissCache> fMissCache; ///<! Cache contents for misses
 
+   // Baskets of the entries following the cache content, read by a background thread
+   // when asynchronous prefetching is enabled.
+   struct AsyncBlock;
+   bool fAsyncPrefetch{false};              ///<! true if the next entries are read in the background
+   std::unique_ptr<AsyncBlock> fAsyncBlock; ///<! Block being read, or read, in the background
+   Int_t fNReadAsync{0};                    ///<! Number of baskets taken from the blocks read in the background
+
+   // Second handle on the file of the cache, for the reads of the background threads.
+   std::unique_ptr<TFile> fPrefetchFile; ///<! Handle opened by GetPrefetchFile()
+   bool fPrefetchFileFailed{false};      ///<! true if the file of the cache cannot be opened a second time
+
+   TFile *GetPrefetchFile();
+
 private:
    TTreeCache(const TTreeCache &) = delete; ///< this class cannot be copied
    TTreeCache &operator=(const TTreeCache &) = delete;
@@ -124,6 +138,11 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    bool     ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   // Functions related to the asynchronous prefetching of the entries following the cache content.
+   bool CanPrefetchAsync() const; ///< Check whether the next block can be read in the background.
+   void StartAsyncPrefetch();     ///< Start reading the baskets following the cache content in the background.
+   bool TransferAsync();          ///< Transfer the cache content, taking the baskets from the background read.
+
 public:
 
    TTreeCache();
@@ -133,10 +152,14 @@ public:
    Int_t                AddBranch(const char *branch, bool subbranches = false) override;
    virtual Int_t        DropBranch(TBranch *b, bool subbranches = false);
    virtual Int_t        DropBranch(const char *branch, bool subbranches = false);
+   void                 Close(Option_t *option="") override;
    virtual void         Disable() {fEnabled = false;}
    virtual void         Enable() {fEnabled = true;}
+   bool                 GetAsyncPrefetch() const { return fAsyncPrefetch; }
+   Int_t                GetNReadAsync() const { return fNReadAsync; }
    bool                 GetOptimizeMisses() const { return fOptimizeMisses; }
    const TObjArray     *GetCachedBranches() const { return fBranches; }
+   bool                 GetConfiguredAsyncPrefetch() const;
    EPrefillType         GetConfiguredPrefillType() const;
    Double_t             GetEfficiency() const;
    Double_t             GetEfficiencyRel() const;
@@ -161,6 +184,7 @@ public:
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   void                 SetAsyncPrefetch(bool enable);
    void                 SetAutoCreated(bool val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Int_t buffersize) override;
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
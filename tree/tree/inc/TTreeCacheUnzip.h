@@ -16,7 +16,9 @@
 #include "Bytes.h"
 #include "TTreeCache.h"
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 class TBasket;
@@ -79,7 +81,6 @@ protected:
 
    // Members for paral. managing
    bool        fAsyncReading;
-   bool        fEmpty;
    Int_t       fCycle;
    bool        fParallel; ///< Indicate if we want to activate the parallelism (for this instance)
 
@@ -90,12 +91,24 @@ protected:
    // IMT TTaskGroup Manager
 #ifdef R__USE_IMT
    std::unique_ptr<ROOT::Experimental::TTaskGroup> fUnzipTaskGroup;
+   std::unique_ptr<ROOT::Experimental::TTaskGroup> fTransferTaskGroup; ///<! Runs the pipelined transfer of the cache block
 #endif
 
    // Unzipping related members
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
-   Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
-   Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is 2*fBufferSize)
+   Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of the baskets read by one request of the pipelined transfer
+   Long64_t    fUnzipBufferSize;  ///<!  Memory budget for baskets being unzipped or unzipped but not yet consumed
+
+   // Pipelined transfer of the cache block: baskets are read in file order and queued for unzipping as soon as
+   // they have arrived in the cache buffer
+   std::mutex              fUnzipMutex;             ///<! Protects fNScheduled, fUnzipPending and the unzipped chunks handover
+   std::condition_variable fUnzipCondition;         ///<! Signals finished unzip tasks
+   std::atomic<Int_t>      fNLanded{0};             ///<! Number of baskets, in file order, that are in the cache buffer
+   Int_t                   fNScheduled = 0;         ///<! Number of baskets, in file order, considered for an unzip task
+   Long64_t                fUnzipPending = 0;       ///<! Bytes reserved by unzip tasks and held by unzipped baskets
+   bool                    fTransferring = false;   ///<! The current block is being transferred in requests of fUnzipGroupSize
+   bool                    fTransferFailed = false; ///<! A request of the transfer failed (protected by fIOMutex)
+   std::atomic<bool>       fTransferStop{false};    ///<! Asks the transfer task to stop after the current request
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
 
@@ -104,6 +117,8 @@ protected:
    Int_t       fNMissed;          ///<! number of blocks that were not found in the cache and were unzipped
    Int_t       fNStalls;          ///<! number of hits which caused a stall
    Int_t       fNUnzip;           ///<! number of blocks that were unzipped
+   Int_t       fNPipelined;       ///<! number of blocks queued for unzipping before their block was transferred
+   Long64_t    fUnzipPendingMax;  ///<! maximum of the memory reserved for unzipping, see fUnzipPending
 
 private:
    TTreeCacheUnzip(const TTreeCacheUnzip &) = delete;
@@ -114,6 +129,22 @@ private:
 
    // Private methods
    void  Init();
+   Int_t GetUnzipLenEstimate(Int_t sortedIdx);
+   bool  IsDirectAccess() const;
+   bool  IsRefillPending() const;
+   void  PrepareDirectRead();
+   void  ResumeTransfer();
+   void  StopTasks();
+   bool  TransferNext();
+   Int_t UnzipCache(Int_t index, Long64_t &reserved);
+   bool  WaitForLanding(Int_t sortedIdx);
+#ifdef R__USE_IMT
+   bool  CanPipeline() const;
+   void  RunTransfer();
+   void  ScheduleUnzip();
+   void  StartTransfer();
+   void  StopTransfer();
+#endif
 
 public:
    TTreeCacheUnzip();
@@ -122,9 +153,11 @@ public:
 
    Int_t               AddBranch(TBranch *b, bool subbranches = false) override;
    Int_t               AddBranch(const char *branch, bool subbranches = false) override;
+   void                Close(Option_t *option = "") override;
    bool                FillBuffer() override;
    Int_t               ReadBufferExt(char *buf, Long64_t pos, Int_t len, Int_t &loc) override;
    void                SetEntryRange(Long64_t emin,   Long64_t emax) override;
+   void                SetFile(TFile *file, TFile::ECacheAction action = TFile::kDisconnect) override;
    void                StopLearningPhase() override;
    void                UpdateBranches(TTree *tree) override;
 
@@ -139,6 +172,7 @@ public:
 #endif
    Int_t          GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes, Int_t &objlen, Int_t &keylen);
    Int_t          GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, bool *free) override;
+   Long64_t       GetUnzipBufferSize() const { return fUnzipBufferSize; }
    Int_t          GetUnzipGroupSize() { return fUnzipGroupSize; }
    void           ResetCache() override;
    Int_t          SetBufferSize(Int_t buffersize) override;
@@ -150,6 +184,8 @@ public:
 
    // Methods to get stats
    Int_t  GetNUnzip() { return fNUnzip; }
+   Int_t  GetNPipelined() { return fNPipelined; }
+   Long64_t GetUnzipPendingMax() { return fUnzipPendingMax; }
    Int_t  GetNMissed(){ return fNMissed; }
    Int_t  GetNFound() { return fNFound; }
 
@@ -28,6 +28,7 @@
 #include "TLeafC.h"
 #include "TLeafD.h"
 #include "TLeafD32.h"
+#include "TLeafElement.h"
 #include "TLeafF.h"
 #include "TLeafF16.h"
 #include "TLeafI.h"
@@ -1448,20 +1449,24 @@ bool TBranch::SupportsBulkRead() const {
 ///
 /// where T is the type stored on this branch.
 ///
-/// When `count_buf` points to a valid TBuffer and the branch has a branch count,
-/// `count_buf` will be filled (via a call to GetEntriesSerialized) with the data
-/// from the branchCount.  After deserialization those value can be used to calculate
-/// the number of elements corresponding to each entries.
+/// Variable-length arrays, i.e. leaves with a leaf count such as `f[n]/F` and the
+/// data members of split STL collections and TClonesArrays, are supported as well.
+/// In that case, the buffer holds the array elements of all the entries back to back.
 ///
+/// When `count_buf` points to a valid TBuffer, it will be filled (via a call to
+/// GetBulkEntries on the count branch) with one Int_t per entry, in host byte order.
 /// For each entry the number of elements is the multiplication of
-/// 
+///
 /// ~~~{.cpp}
 /// TLeaf *leaf = static_cast<TLeaf*>(branch->GetListOfLeaves()->At(0));
-/// auto len = leaf->GetLen();
+/// auto len = leaf->GetLenStatic();
 /// ~~~
 ///
-/// and the value in the BranchCount corresponding to that entry (can be obtained
-/// from `branch->GetBranchCount()`).
+/// and the value in `count_buf` corresponding to that entry.  For leaves without
+/// a leaf count, `count_buf` is filled with `len`.  The count branch needs to have
+/// a basket starting at the same entry and spanning the same number of entries,
+/// which is the case for trees flushed only at cluster boundaries
+/// (TTree::kOnlyFlushAtCluster); otherwise, the call fails.
 ///
 /// \note This interface is not meant to be exposed to end users, but rather it should
 ///       be wrapped by higher-level interfaces.
@@ -1469,7 +1474,7 @@ bool TBranch::SupportsBulkRead() const {
 /// \note See TBranch::GetEntriesSerialized() for an alternative that does not
 ///       perform byte swapping (useful to save one pass over data in some cases).
 ///
-Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
+Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf, TBuffer *count_buf)
 {
    // TODO: eventually support multiple leaves.
    if (R__unlikely(fNleaves != 1)) return -1;
@@ -1531,7 +1536,26 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
 
    Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
    //printf("Requesting %d events; fNextBasketEntry=%lld; first=%lld.\n", N, fNextBasketEntry, first);
-   if (R__unlikely(!leaf->ReadBasketFast(user_buf, N))) {
+
+   // For variable-length arrays, the number of fixed-size groups of elements (GetLenStatic()) in the basket,
+   // i.e. the sum of the counts of the entries.  Otherwise, the number of entries.
+   Long64_t nGroups = N;
+   TLeaf *countLeaf = leaf->GetLeafCount();
+   if (countLeaf) {
+      // The end of the data of a basket that is only in memory is not yet recorded in the basket
+      if (R__unlikely(!fBasketSeek[fReadBasket])) {
+         Error("GetBulkEntries", "Variable-length arrays are only supported for baskets read from a file.\n");
+         return -1;
+      }
+      const Int_t groupSize = leaf->GetLenType() * leaf->GetLenStatic();
+      const Int_t nBytes = basket->GetLast() - bufbegin;
+      if (R__unlikely((groupSize <= 0) || (nBytes < 0) || (nBytes % groupSize))) {
+         Error("GetBulkEntries", "Unexpected size of the basket data (%d bytes).\n", nBytes);
+         return -1;
+      }
+      nGroups = nBytes / groupSize;
+   }
+   if (R__unlikely(!leaf->ReadBasketFast(user_buf, nGroups))) {
       Error("GetBulkEntries", "Leaf failed to read.\n");
       return -1;
    }
@@ -1543,6 +1567,45 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
       basket->DisownBuffer();
    }
 
+   if (count_buf) {
+      if (countLeaf) {
+         // The counter of a split collection is stored by a TLeafElement without type length
+         if (R__unlikely((countLeaf->GetLenType() != sizeof(Int_t)) &&
+                         !((countLeaf->GetLenType() == 0) && countLeaf->InheritsFrom(TLeafElement::Class())))) {
+            Error("GetBulkEntries", "Unsupported type of the count leaf %s.\n", countLeaf->GetName());
+            return -1;
+         }
+         TBranch *countBranch = countLeaf->GetBranch();
+         if (R__unlikely(countBranch->GetBulkEntries(entry, *count_buf) != N)) {
+            Error("GetBulkEntries", "Failed to read count branch %s aligned with branch %s.\n", countBranch->GetName(),
+                  GetName());
+            return -1;
+         }
+         // The basket data is not necessarily aligned
+         const char *counts = count_buf->GetCurrent();
+         Long64_t nCounted = 0;
+         for (Int_t idx = 0; idx < N; ++idx) {
+            Int_t count;
+            memcpy(&count, counts + idx * sizeof(Int_t), sizeof(Int_t));
+            nCounted += count;
+         }
+         if (R__unlikely(nCounted != nGroups)) {
+            Error("GetBulkEntries", "Count branch %s does not match the content of branch %s.\n",
+                  countBranch->GetName(), GetName());
+            return -1;
+         }
+      } else {
+         const Int_t len = leaf->GetLenStatic();
+         Int_t cur_offset = count_buf->GetCurrent() - count_buf->Buffer();
+         Int_t size = cur_offset + N * sizeof(Int_t);
+         if (count_buf->BufferSize() < size)
+            count_buf->AutoExpand(size);
+         char *counts = count_buf->Buffer() + cur_offset;
+         for (Int_t idx = 0; idx < N; ++idx)
+            memcpy(counts + idx * sizeof(Int_t), &len, sizeof(Int_t));
+      }
+   }
+
    return N;
 }
 
@@ -2257,6 +2320,89 @@ ROOT::TIOFeatures TBranch::GetIOFeatures() const
    return fIOFeatures;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Check whether the baskets of `from`, and of its sub-branches, can be
+/// appended by ImportBaskets, without modifying either branch.
+///
+/// `from` must have the same structure as this branch (typically it belongs to
+/// a clone of our tree) and all its baskets with entries must already have been
+/// written, into the file of this branch, e.g. by TTree::FlushBaskets.  The
+/// current write basket of this branch must not hold any entries.
+/// Returns false, with an error message, if any of these requirements is not met.
+
+bool TBranch::CanImportBaskets(const TBranch &from) const
+{
+   if (from.IsA() != IsA() || from.fBranches.GetEntriesFast() != fBranches.GetEntriesFast() ||
+       from.fNleaves != fNleaves) {
+      Error("ImportBaskets", "The structure of branch %s does not match the one of %s.", from.GetName(), GetName());
+      return false;
+   }
+   TBasket *writebasket = fWriteBasket < fBaskets.GetSize() ? (TBasket*)fBaskets.UncheckedAt(fWriteBasket) : nullptr;
+   if (writebasket && writebasket->GetNevBuf()) {
+      Error("ImportBaskets", "The write basket of branch %s is not empty.", GetName());
+      return false;
+   }
+   for (Int_t i = 0; i < from.fWriteBasket; ++i) {
+      if (!from.fBasketSeek[i]) {
+         Error("ImportBaskets", "Basket %d of branch %s has not been written.", i, from.GetName());
+         return false;
+      }
+   }
+
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i = 0; i < nb; ++i) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      if (!branch->CanImportBaskets(*(TBranch*)from.fBranches.UncheckedAt(i))) {
+         return false;
+      }
+   }
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append the baskets of `from`, and of its sub-branches, after the entries of
+/// this branch.
+///
+/// The requirements must have been checked by CanImportBaskets.  Only the
+/// basket bookkeeping is transferred, the baskets themselves are not copied and
+/// `from` is left untouched: use ResetAfterMerge to prepare it for new entries.
+
+void TBranch::ImportBaskets(TBranch &from)
+{
+   TBasket *writebasket = fWriteBasket < fBaskets.GetSize() ? (TBasket*)fBaskets.UncheckedAt(fWriteBasket) : nullptr;
+   const Int_t nbaskets = from.fWriteBasket;
+   if (nbaskets) {
+      while (fWriteBasket + nbaskets >= fMaxBaskets) {
+         ExpandBasketArrays();
+      }
+      for (Int_t i = 0; i < nbaskets; ++i) {
+         fBasketBytes[fWriteBasket + i] = from.fBasketBytes[i];
+         fBasketEntry[fWriteBasket + i] = fEntryNumber + from.fBasketEntry[i];
+         fBasketSeek[fWriteBasket + i] = from.fBasketSeek[i];
+      }
+      // The empty write basket moves along, to be reused by the next Fill.
+      fBaskets.AddAtAndExpand(nullptr, fWriteBasket);
+      fWriteBasket += nbaskets;
+      fBaskets.AddAtAndExpand(writebasket, fWriteBasket);
+   }
+   fEntries += from.fEntries;
+   fEntryNumber += from.fEntryNumber;
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+   fTotBytes += from.fTotBytes;
+   fZipBytes += from.fZipBytes;
+
+   for (Int_t i = 0; i < fNleaves; ++i) {
+      TLeaf *leaf = (TLeaf*)fLeaves.UncheckedAt(i);
+      leaf->IncludeRange((TLeaf*)from.fLeaves.UncheckedAt(i));
+   }
+
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i = 0; i < nb; ++i) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      branch->ImportBaskets(*(TBranch*)from.fBranches.UncheckedAt(i));
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return true if an existing object in a TBranchObject must be deleted.
 
@@ -2597,6 +2743,10 @@ void TBranch::Reset(Option_t*)
 
 void TBranch::ResetAfterMerge(TFileMergeInfo *)
 {
+   // The basket to reuse is looked up at the current write and read positions
+   const Int_t writeBasket = fWriteBasket;
+   const Int_t readBasket = fReadBasket;
+
    fReadBasket       = 0;
    fReadEntry        = -1;
    fFirstBasketEntry = -1;
@@ -2626,13 +2776,13 @@ void TBranch::ResetAfterMerge(TFileMergeInfo *)
       }
    }
 
-   TBasket *reusebasket = (TBasket*)fBaskets[fWriteBasket];
+   TBasket *reusebasket = writeBasket < fBaskets.GetSize() ? (TBasket*)fBaskets.UncheckedAt(writeBasket) : nullptr;
    if (reusebasket) {
-      fBaskets[fWriteBasket] = nullptr;
+      fBaskets[writeBasket] = nullptr;
    } else {
-      reusebasket = (TBasket*)fBaskets[fReadBasket];
+      reusebasket = readBasket < fBaskets.GetSize() ? (TBasket*)fBaskets.UncheckedAt(readBasket) : nullptr;
       if (reusebasket) {
-         fBaskets[fReadBasket] = nullptr;
+         fBaskets[readBasket] = nullptr;
       }
    }
    fBaskets.Delete();
@@ -3754,6 +3754,21 @@ void TBranchElement::InitializeOffsets()
    fInitOffsets = true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Append the baskets of `from` after the entries of this branch.
+///
+/// In addition to TBranch::ImportBaskets, keep the maximum size of the
+/// TClonesArray or variable size array large enough for the imported entries.
+
+void TBranchElement::ImportBaskets(TBranch &from)
+{
+   TBranchElement *fromelem = dynamic_cast<TBranchElement*>(&from);
+   if (fromelem && fromelem->fMaximum > fMaximum) {
+      fMaximum = fromelem->fMaximum;
+   }
+   TBranch::ImportBaskets(from);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return true if more than one leaf, false otherwise.
 
@@ -131,7 +131,6 @@ void TLeafD::ReadBasket(TBuffer &b)
 
 // Deserialize N events from an input buffer.
 bool TLeafD::ReadBasketFast(TBuffer &input_buf, Long64_t N) {
-   if (R__unlikely(fLeafCount)) { return false; }
    return input_buf.ByteSwapBuffer(fLen*N, kDouble_t);
 }
 
@@ -113,6 +113,14 @@ TLeafElement::GetDeserializeType() const
    if (R__unlikely(fDeserializeTypeCache.load(std::memory_order_relaxed) != DeserializeType::kInvalid))
       return fDeserializeTypeCache;
 
+   // The main branch of a split STL collection or TClonesArray stores the number of elements of each entry
+   auto branchType = static_cast<TBranchElement *>(fBranch)->GetType();
+   if (branchType == 3 || branchType == 4) {
+      fDataTypeCache.store(EDataType::kInt_t, std::memory_order_release);
+      fDeserializeTypeCache.store(DeserializeType::kInPlace, std::memory_order_relaxed);
+      return DeserializeType::kInPlace;
+   }
+
    TClass *clptr = nullptr;
    EDataType type = EDataType::kOther_t;
    if (fBranch->GetExpectedType(clptr, type)) {  // Returns non-zero in case of failure
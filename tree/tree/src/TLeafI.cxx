@@ -186,7 +186,6 @@ void TLeafI::ReadBasket(TBuffer &b)
 /// Deserialize input by performing byteswap as needed.
 bool TLeafI::ReadBasketFast(TBuffer& input_buf, Long64_t N)
 {
-   if (R__unlikely(fLeafCount)) {return false;}
    return input_buf.ByteSwapBuffer(fLen*N, kInt_t);
 }
 
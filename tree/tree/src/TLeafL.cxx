@@ -197,7 +197,6 @@ void TLeafL::ReadBasket(TBuffer &b)
 /// Deserialize input by performing byteswap as needed.
 bool TLeafL::ReadBasketFast(TBuffer& input_buf, Long64_t N)
 {
-   if (R__unlikely(fLeafCount)) {return false;}
    return input_buf.ByteSwapBuffer(fLen*N, kLong64_t);
 }
 
@@ -6407,6 +6407,57 @@ void TTree::ImportClusterRanges(TTree *fromtree)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Appends the entries of 'from' to this tree, as one event cluster.
+///
+/// 'from' must have the same branches as this tree (typically it is a clone
+/// of this tree) and its baskets must have been written, into the file of
+/// this tree, e.g. by FlushBaskets.  Only the basket bookkeeping is appended
+/// by TBranch::ImportBaskets, the baskets themselves stay where they are.
+/// 'from' is not modified; call ResetAfterMerge to fill it again.
+///
+/// This is used by ROOT::Experimental::TTreeFillContext to commit the entries
+/// filled concurrently by several threads.
+/// Returns the number of entries appended, or -1 in case of error, in which
+/// case this tree is left unchanged.
+
+Long64_t TTree::ImportCluster(TTree &from)
+{
+   Long64_t nentries = from.fEntries;
+   if (nentries == 0) {
+      return 0;
+   }
+   Int_t nb = fBranches.GetEntriesFast();
+   if (from.fBranches.GetEntriesFast() != nb) {
+      Error("ImportCluster", "The tree %s does not have the same branches as %s.", from.GetName(), GetName());
+      return -1;
+   }
+   // Check all the branches before modifying any of them
+   for (Int_t i = 0; i < nb; ++i) {
+      TBranch* branch = (TBranch*) fBranches.UncheckedAt(i);
+      if (!branch->CanImportBaskets(*(TBranch*) from.fBranches.UncheckedAt(i))) {
+         return -1;
+      }
+   }
+   for (Int_t i = 0; i < nb; ++i) {
+      TBranch* branch = (TBranch*) fBranches.UncheckedAt(i);
+      branch->ImportBaskets(*(TBranch*) from.fBranches.UncheckedAt(i));
+   }
+   // Close the cluster range of the entries we already have, if needed.
+   if (fEntries && (fNClusterRange == 0 || fClusterRangeEnd[fNClusterRange - 1] != fEntries - 1)) {
+      MarkEventCluster();
+   }
+   fTotBytes += from.fTotBytes;
+   fZipBytes += from.fZipBytes;
+   fFlushedBytes = fZipBytes;
+   fEntries += nentries;
+
+   // The imported entries form their own cluster, whatever fAutoFlush is.
+   MarkEventCluster();
+   fClusterSize[fNClusterRange - 1] = nentries;
+   return nentries;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Keep a maximum of fMaxEntries in memory.
 
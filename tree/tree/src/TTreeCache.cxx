@@ -20,6 +20,7 @@
 - [General Description](\ref description)
 - [Changes in behaviour](\ref changesbehaviour)
 - [Self-optimization](\ref cachemisses)
+- [Asynchronous prefetching](\ref asyncprefetch)
 - [Examples of usage](\ref examples)
 - [Check performance and stats](\ref checkPerf)
 
@@ -129,6 +130,36 @@ Additionally, on the first miss of an event, we must iterate through all the
 This can be potentially a CPU-expensive operation compared to, e.g., the
 latency of a SSD.  This is why the miss cache is currently disabled by default.
 
+\anchor asyncprefetch
+## Asynchronous prefetching of the next entries
+
+By default, the cache is filled synchronously: when the reader moves past the
+entries held by the cache, typically at a cluster boundary, the event loop
+waits until the baskets of the next cluster(s) have been read.
+When asynchronous prefetching is enabled (see the SetAsyncPrefetch method,
+the `TTreeCache.AsyncPrefetch` resource or the `ROOT_TTREECACHE_ASYNCPREFETCH`
+environment variable), each fill of the cache starts reading the baskets of
+the entries that follow the new cache content on a background thread, into a
+second buffer.  While the current entries are processed, the next ones are
+thus already being read; the next fill of the cache takes the baskets from
+that buffer and only reads the ones that were not prefetched.
+
+The background read starts once the learning phase is over, the learning
+phase itself and its prefill are unchanged.  The double buffering increases the
+memory used by the cache by at most a factor two.
+The background thread reads through a second handle on the file, opened by
+the cache without registering it in the list of files: the TFile of the tree
+may be used at the same time by other readers, e.g. friend trees stored in the
+same file, their own caches or TDirectory::Get.  The bytes read in the
+background are thus not counted by TFile::GetBytesRead; GetNReadAsync returns
+the number of baskets taken from the background reads.  The cache does not
+prefetch asynchronously if the file cannot be opened a second time (e.g. a
+TMemFile), if the file is writable, if the I/O performance is monitored
+(gPerfStats) or in the prefetching modes based on TFilePrefetch or on the
+asynchronous reads of the file.
+TTreeCacheUnzip does not use it, it pipelines the transfer of the cache
+content with the decompression of the baskets instead.
+
 \anchor examples
 ## Example usages of TTreeCache
 
@@ -297,9 +328,14 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TFriendElement.h"
 #include "TFile.h"
 #include "TMath.h"
+#include "TMemFile.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include <algorithm>
 #include <climits>
+#include <numeric>
+#include <thread>
+#include <vector>
 
 #include <memory>
 
@@ -307,10 +343,37 @@ Int_t TTreeCache::fgLearnEntries = 100;
 
 ClassImp(TTreeCache);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Baskets following the cache content, read by a background thread.
+///
+/// The baskets are stored in fData in increasing order of their position in
+/// the file.  The members are only accessed by the thread until it is joined.
+
+struct TTreeCache::AsyncBlock {
+   TFile *fFile{nullptr};         ///< Handle of GetPrefetchFile() the baskets are read from
+   std::vector<Long64_t> fSeek;   ///< Sorted positions of the baskets in the file
+   std::vector<Int_t> fSeekLen;   ///< Lengths of the baskets
+   std::vector<Int_t> fSeekPos;   ///< Positions of the baskets in fData
+   std::vector<Long64_t> fPos;    ///< Positions of the merged reads
+   std::vector<Int_t> fLen;       ///< Lengths of the merged reads
+   std::vector<char> fData;       ///< Contents of the baskets
+   bool fFailed{false};           ///< Set by the thread if the read failed
+   std::thread fThread;           ///< Thread reading the baskets
+
+   ~AsyncBlock() { Wait(); }
+
+   void Wait()
+   {
+      if (fThread.joinable())
+         fThread.join();
+   }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
-TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType())
+TTreeCache::TTreeCache()
+   : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType()), fAsyncPrefetch(GetConfiguredAsyncPrefetch())
 {
 }
 
@@ -319,7 +382,8 @@ TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillTy
 
 TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    : TFileCacheRead(tree->GetCurrentFile(), buffersize, tree), fEntryMax(tree->GetEntriesFast()), fEntryNext(0),
-     fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType())
+     fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType()),
+     fAsyncPrefetch(GetConfiguredAsyncPrefetch())
 {
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntriesFast();
@@ -331,6 +395,8 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
 
 TTreeCache::~TTreeCache()
 {
+   fAsyncBlock.reset();
+
    // Informe the TFile that we have been deleted (in case
    // we are deleted explicitly by legacy user code).
    if (fFile) fFile->SetCacheRead(nullptr, fTree);
@@ -977,6 +1043,231 @@ bool TTreeCache::CheckMissCache(char *buf, Long64_t pos, int len)
 /// End of methods for miss cache.
 ////////////////////////////////////////////////////////////////////////////////
 
+////////////////////////////////////////////////////////////////////////////////
+/// Start of methods for the asynchronous prefetching.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a second handle on the file of the cache, opened for reading on the
+/// first call, or nullptr if the file cannot be opened again.
+///
+/// The background reads of the cache go through this handle: the TFile of the
+/// cache is shared with the other readers of the file, e.g. the friend trees
+/// stored in the same file, their caches or TDirectory::Get, and its position,
+/// its read cache and its counters are not protected against concurrent
+/// reads.  The handle is not registered in the list of files and the bytes
+/// read through it are not counted by TFile::GetBytesRead of the file of the
+/// cache.  It is dropped when the cache is attached to another file or closed.
+
+TFile *TTreeCache::GetPrefetchFile()
+{
+   if (fPrefetchFile || fPrefetchFileFailed || !fFile)
+      return fPrefetchFile.get();
+
+   // A TMemFile cannot be opened twice
+   fPrefetchFileFailed = true;
+   if (dynamic_cast<TMemFile *>(fFile))
+      return nullptr;
+   const TUrl *url = fFile->GetEndpointUrl();
+   const char *name = strcmp(url->GetProtocol(), "file") ? url->GetUrl() : url->GetFileAndOptions();
+   std::unique_ptr<TFile> file;
+   {
+      TDirectory::TContext ctxt;
+      file.reset(TFile::Open(name, "READ_WITHOUT_GLOBALREGISTRATION"));
+   }
+   // The name may refer to another file, e.g. a relative path after a change of the working directory
+   if (!file || file->IsZombie() || file->GetUUID() != fFile->GetUUID())
+      return nullptr;
+   fPrefetchFile = std::move(file);
+   fPrefetchFileFailed = false;
+   return fPrefetchFile.get();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable / disable reading the baskets of the entries following the cache
+/// content on a background thread, see \ref asyncprefetch.
+///
+/// Disabling it waits for the ongoing background read, if any, and drops its
+/// content.
+
+void TTreeCache::SetAsyncPrefetch(bool enable)
+{
+   if (!enable)
+      fAsyncBlock.reset();
+   fAsyncPrefetch = enable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the next block can be read by a background thread, see
+/// \ref asyncprefetch for the cases that are excluded.
+
+bool TTreeCache::CanPrefetchAsync() const
+{
+   return fAsyncPrefetch && fFile && !fIsLearning && !fLearnPrefilling && !fEnablePrefetching && !fAsyncReading &&
+          !fFile->IsWritable() && !gPerfStats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start reading, on a background thread, the baskets of the cached branches
+/// for the cluster(s) following the cache content, i.e. starting at fEntryNext.
+///
+/// As in FillBuffer, the baskets already in memory or larger than the cache
+/// are skipped and clusters are added until the size of the cache is reached.
+
+void TTreeCache::StartAsyncPrefetch()
+{
+   fAsyncBlock.reset();
+   if (fNbranches <= 0 || fEntryNext < 0)
+      return;
+   TTree *tree = ((TBranch *)fBranches->UncheckedAt(0))->GetTree();
+   const Long64_t entryMax = std::min(fEntryMax, tree->GetEntries());
+   if (fEntryNext >= entryMax)
+      return;
+
+   std::vector<Long64_t> seek;
+   std::vector<Int_t> seekLen;
+   std::vector<Int_t> cursor(fNbranches, -1); // First basket of each branch that was not considered yet
+   Long64_t ntot = 0;
+   bool full = false;
+   Long64_t clusterEnd = fEntryNext;
+   TTree::TClusterIterator clusterIter = tree->GetClusterIterator(fEntryNext);
+   clusterIter();
+   while (!full && clusterEnd < entryMax) {
+      const Long64_t nextClusterEnd = clusterIter.GetNextEntry();
+      if (nextClusterEnd <= clusterEnd)
+         break;
+      clusterEnd = std::min(nextClusterEnd, entryMax);
+      for (Int_t i = 0; i < fNbranches && !full; ++i) {
+         TBranch *b = (TBranch *)fBranches->UncheckedAt(i);
+         if (b->GetDirectory() == nullptr || b->TestBit(TBranch::kDoNotProcess))
+            continue;
+         if (b->GetDirectory()->GetFile() != fFile)
+            continue;
+         Int_t nb = b->GetMaxBaskets();
+         Int_t *lbaskets = b->GetBasketBytes();
+         Long64_t *entries = b->GetBasketEntry();
+         if (!lbaskets || !entries)
+            continue;
+         Int_t blistsize = b->GetListOfBaskets()->GetSize();
+         if (cursor[i] == -1) {
+            auto start = TMath::BinarySearch(b->GetWriteBasket() + 1, entries, fEntryNext);
+            cursor[i] = (start < 0) ? 0 : start;
+         }
+         for (auto &j = cursor[i]; j < nb && entries[j] < clusterEnd; ++j) {
+            // This basket has already been read
+            if (j < blistsize && b->GetListOfBaskets()->UncheckedAt(j))
+               continue;
+            Long64_t pos = b->GetBasketSeek(j);
+            Int_t len = lbaskets[j];
+            if (pos <= 0 || len <= 0 || len > fBufferSizeMin)
+               continue;
+            if (ntot + len > fBufferSizeMin) {
+               full = true;
+               break;
+            }
+            seek.push_back(pos);
+            seekLen.push_back(len);
+            ntot += len;
+         }
+      }
+      clusterIter();
+   }
+   if (seek.empty())
+      return;
+
+   std::vector<Int_t> index(seek.size());
+   std::iota(index.begin(), index.end(), 0);
+   std::sort(index.begin(), index.end(), [&seek](Int_t a, Int_t b) { return seek[a] < seek[b]; });
+
+   auto block = std::make_unique<AsyncBlock>();
+   block->fFile = GetPrefetchFile();
+   if (!block->fFile)
+      return;
+   Int_t seekPos = 0;
+   for (auto k : index) {
+      block->fSeek.push_back(seek[k]);
+      block->fSeekLen.push_back(seekLen[k]);
+      block->fSeekPos.push_back(seekPos);
+      seekPos += seekLen[k];
+      // Merge consecutive baskets into one read, as in TFileCacheRead::Sort
+      if (!block->fPos.empty() && block->fPos.back() + block->fLen.back() == seek[k] &&
+          block->fLen.back() <= 16000000) {
+         block->fLen.back() += seekLen[k];
+      } else {
+         block->fPos.push_back(seek[k]);
+         block->fLen.push_back(seekLen[k]);
+      }
+   }
+   block->fData.resize(seekPos);
+
+   AsyncBlock *b = block.get();
+   b->fThread = std::thread([b]() {
+      b->fFailed = b->fFile->ReadBuffers(b->fData.data(), b->fPos.data(), b->fLen.data(),
+                                           static_cast<Int_t>(b->fPos.size()));
+   });
+   fAsyncBlock = std::move(block);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the cache content into the cache buffer, copying the baskets read
+/// by the background thread and reading the other ones from the file.
+///
+/// The block read in the background is consumed.  Returns false if a read
+/// failed, in which case the cache content is dropped and the baskets are
+/// read one by one on request.
+
+bool TTreeCache::TransferAsync()
+{
+   std::unique_ptr<AsyncBlock> block = std::move(fAsyncBlock);
+   if (block) {
+      block->Wait();
+      if (block->fFailed)
+         block.reset();
+   }
+   if (fNseek <= 0)
+      return true;
+   Sort();
+
+   bool ok = true;
+   if (!block) {
+      ok = !fFile->ReadBuffers(fBuffer, fPos, fLen, fNb);
+   } else {
+      // Read the baskets [first, last[, which are consecutive in fBuffer
+      auto readFromFile = [this](Int_t first, Int_t last) {
+         return !fFile->ReadBuffers(&fBuffer[fSeekPos[first]], &fSeekSort[first], &fSeekSortLen[first], last - first);
+      };
+      Int_t firstMissing = -1;
+      for (Int_t i = 0; i < fNseek && ok; ++i) {
+         auto iter = std::lower_bound(block->fSeek.begin(), block->fSeek.end(), fSeekSort[i]);
+         const auto k = iter - block->fSeek.begin();
+         if (iter == block->fSeek.end() || *iter != fSeekSort[i] || block->fSeekLen[k] < fSeekSortLen[i]) {
+            if (firstMissing < 0)
+               firstMissing = i;
+            continue;
+         }
+         if (firstMissing >= 0) {
+            ok = readFromFile(firstMissing, i);
+            firstMissing = -1;
+         }
+         memcpy(&fBuffer[fSeekPos[i]], &block->fData[block->fSeekPos[k]], fSeekSortLen[i]);
+         fNReadAsync++;
+      }
+      if (ok && firstMissing >= 0)
+         ok = readFromFile(firstMissing, fNseek);
+   }
+
+   if (!ok) {
+      TFileCacheRead::Prefetch(0, 0);
+      return false;
+   }
+   fIsTransferred = kTRUE;
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// End of methods for the asynchronous prefetching.
+////////////////////////////////////////////////////////////////////////////////
+
 namespace {
 struct BasketRanges {
    struct Range {
@@ -1791,9 +2082,39 @@ bool TTreeCache::FillBuffer()
       }
    }
    fIsLearning = false;
+   if (fAsyncPrefetch) {
+      if (CanPrefetchAsync()) {
+         // Complete the transfer of the new content now, using the baskets read in
+         // the background, and start reading the entries that follow it.
+         TransferAsync();
+         StartAsyncPrefetch();
+      } else {
+         fAsyncBlock.reset();
+      }
+   }
    return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return whether asynchronous prefetching is enabled from the environment or
+/// resource variable
+/// - 0 - Disabled
+/// - 1 - Enabled
+
+bool TTreeCache::GetConfiguredAsyncPrefetch() const
+{
+   const char *stcp;
+   Int_t s = 0;
+
+   if (!(stcp = gSystem->Getenv("ROOT_TTREECACHE_ASYNCPREFETCH")) || !*stcp) {
+      s = gEnv->GetValue("TTreeCache.AsyncPrefetch", 0);
+   } else {
+      s = TString(stcp).Atoi();
+   }
+
+   return s != 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the desired prefill type from the environment or resource variable
 /// - 0 - No prefill
@@ -2039,6 +2360,7 @@ Int_t TTreeCache::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 
 void TTreeCache::ResetCache()
 {
+   fAsyncBlock.reset();
    for (Int_t i = 0; i < fNbranches; ++i) {
       TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
       if (b->GetDirectory()==nullptr || b->TestBit(TBranch::kDoNotProcess))
@@ -2084,6 +2406,7 @@ Int_t TTreeCache::SetBufferSize(Int_t buffersize)
    // if content was removed from the buffer, or the buffer was enlarged then
    // empty the prefetch lists and prime to fill the cache again
 
+   fAsyncBlock.reset();
    TFileCacheRead::Prefetch(0,0);
    if (fEnablePrefetching) {
       TFileCacheRead::SecondPrefetch(0, 0);
@@ -2108,6 +2431,7 @@ void TTreeCache::SetEntryRange(Long64_t emin, Long64_t emax)
    // don't restart it if the user has specified the branches.
    bool needLearningStart = (fEntryMin != emin) && fIsLearning && !fIsManual;
 
+   fAsyncBlock.reset();
    fEntryMin  = emin;
    fEntryMax  = emax;
    fEntryNext  = fEntryMin + fgLearnEntries * (fIsLearning && !fIsManual);
@@ -2121,6 +2445,18 @@ void TTreeCache::SetEntryRange(Long64_t emin, Long64_t emax)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Stop the background read, if any, and close the handle of GetPrefetchFile()
+/// before the file is closed.
+
+void TTreeCache::Close(Option_t *option)
+{
+   fAsyncBlock.reset();
+   fPrefetchFile.reset();
+   fPrefetchFileFailed = false;
+   TFileCacheRead::Close(option);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Change the file that is being cached.
 
@@ -2129,6 +2465,9 @@ void TTreeCache::SetFile(TFile *file, TFile::ECacheAction action)
    // The infinite recursion is 'broken' by the fact that
    // TFile::SetCacheRead remove the entry from fCacheReadMap _before_
    // calling SetFile (and also by setting fFile to zero before the calling).
+   fAsyncBlock.reset();
+   fPrefetchFile.reset();
+   fPrefetchFileFailed = false;
    if (fFile) {
       TFile *prevFile = fFile;
       fFile = nullptr;
@@ -2168,6 +2507,7 @@ void TTreeCache::SetLearnPrefill(TTreeCache::EPrefillType type /* = kNoPrefill *
 
 void TTreeCache::StartLearningPhase()
 {
+   fAsyncBlock.reset();
    fIsLearning = true;
    fIsManual = false;
    fNbranches  = 0;
@@ -2209,6 +2549,7 @@ void TTreeCache::StopLearningPhase()
 
 void TTreeCache::UpdateBranches(TTree *tree)
 {
+   fAsyncBlock.reset();
 
    fTree = tree;
 
@@ -16,6 +16,20 @@
 
 A TTreeCache which exploits parallelized decompression of its own content.
 
+With implicit multi-threading enabled, the cache block is transferred by a background task in requests of
+fUnzipGroupSize bytes (SetUnzipGroupSize()), in file order. Every basket is queued for decompression as soon as
+it has arrived, such that reading and unzipping of the block overlap. The memory held by baskets that are being
+unzipped or that are unzipped but not yet consumed is bounded by fUnzipBufferSize (SetUnzipBufferSize()); further
+baskets are queued as the reader consumes the unzipped ones. If the reader needs a basket that has not yet arrived
+or that is not yet unzipped, it reads respectively unzips it itself, so that it never waits for a task that has not
+started. The block is transferred through a second handle on the file (see TTreeCache::GetPrefetchFile()), such
+that the other readers of the file, e.g. other trees or TDirectory::Get(), are not disturbed; the transfer is not
+pipelined if the file cannot be opened a second time, e.g. for a TMemFile. Reads from the file by the cache are
+serialized through its I/O lock.
+
+The baskets are unzipped in parallel only if they are read from the cache buffer, i.e. neither asynchronous reading
+nor prefetching is enabled: the unzip tasks then never need the I/O lock.
+
 */
 
 #include "TTreeCacheUnzip.h"
@@ -33,7 +47,9 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
@@ -158,7 +174,6 @@ bool TTreeCacheUnzip::UnzipState::TryUnzipping(Int_t index) {
 
 TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fAsyncReading(false),
-   fEmpty(true),
    fCycle(0),
    fNseekMax(0),
    fUnzipGroupSize(0),
@@ -166,7 +181,9 @@ TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fNPipelined(0),
+   fUnzipPendingMax(0)
 {
    // Default Constructor.
    Init();
@@ -177,7 +194,6 @@ TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
 
 TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tree,buffersize),
    fAsyncReading(false),
-   fEmpty(true),
    fCycle(0),
    fNseekMax(0),
    fUnzipGroupSize(0),
@@ -185,7 +201,9 @@ TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tre
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fNPipelined(0),
+   fUnzipPendingMax(0)
 {
    Init();
 }
@@ -269,9 +287,6 @@ bool TTreeCacheUnzip::FillBuffer()
 
    if (fNbranches <= 0) return false;
 
-   // Fill the cache buffer with the branches in the cache.
-   fIsTransferred = false;
-
    TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
    Long64_t entry = tree->GetReadEntry();
 
@@ -281,6 +296,12 @@ bool TTreeCacheUnzip::FillBuffer()
    // the end of the training phase).
    if (fEntryCurrent <= entry  && entry < fEntryNext) return false;
 
+   // The baskets of the current block are dropped, no task must work on them anymore
+   StopTasks();
+
+   // Fill the cache buffer with the branches in the cache.
+   fIsTransferred = false;
+
    // Triggered by the user, not the learning phase
    if (entry == -1)  entry = 0;
 
@@ -358,6 +379,8 @@ bool TTreeCacheUnzip::FillBuffer()
 
 Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
 {
+   // The cache buffer may be reallocated
+   StopTasks();
    Int_t res = TTreeCache::SetBufferSize(buffersize);
    if (res < 0) {
       return res;
@@ -367,6 +390,24 @@ Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
    return 1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Stop the background tasks before the file is changed or disconnected.
+
+void TTreeCacheUnzip::SetFile(TFile *file, TFile::ECacheAction action)
+{
+   StopTasks();
+   TTreeCache::SetFile(file, action);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop the background tasks before the file is closed.
+
+void TTreeCacheUnzip::Close(Option_t *option)
+{
+   StopTasks();
+   TTreeCache::Close(option);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the minimum and maximum entry number to be processed
 /// this information helps to optimize the number of baskets to read
@@ -500,6 +541,8 @@ Int_t TTreeCacheUnzip::GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes,
 
 void TTreeCacheUnzip::ResetCache()
 {
+   StopTasks();
+
    // Reset all the lists and wipe all the chunks
    fCycle++;
    fUnzipState.Clear(fNseekMax);
@@ -511,7 +554,9 @@ void TTreeCacheUnzip::ResetCache()
       fUnzipState.Reset(fNseekMax, fNseek);
       fNseekMax = fNseek;
    }
-   fEmpty = true;
+   fNLanded = 0;
+   fNScheduled = 0;
+   fUnzipPending = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -524,6 +569,17 @@ void TTreeCacheUnzip::ResetCache()
 /// and fUnzipLen are ready before main thread fetch the data.
 
 Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
+{
+   Long64_t reserved = 0;
+   return UnzipCache(index, reserved);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Same as UnzipCache(Int_t), for an unzip task which reserved the given
+/// number of bytes of fUnzipBufferSize. If the basket gets unzipped, the
+/// reservation is handed over to the unzipped basket and reserved is set to 0.
+
+Int_t TTreeCacheUnzip::UnzipCache(Int_t index, Long64_t &reserved)
 {
    Int_t myCycle;
    const Int_t hlen = 128;
@@ -559,7 +615,16 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       locbuff = new char[16384];
    }
 
-   readbuf = ReadBufferExt(locbuff, rdoffs, rdlen, loc);
+   if (IsDirectAccess()) {
+      // Copy the basket from the cache buffer without taking the I/O lock, once it has arrived
+      loc = (Int_t)TMath::BinarySearch(fNseek, fSeekSort, rdoffs);
+      if ((loc >= 0) && (loc < fNLanded) && (rdoffs == fSeekSort[loc])) {
+         memcpy(locbuff, &fBuffer[fSeekPos[loc]], rdlen);
+         readbuf = 1;
+      }
+   } else {
+      readbuf = ReadBufferExt(locbuff, rdoffs, rdlen, loc);
+   }
 
    if (readbuf <= 0) {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
@@ -593,7 +658,13 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
          delete [] ptr;
          return 1;
       }
-      fUnzipState.SetUnzipped(index, ptr, loclen); // Set it as done
+      {
+         std::lock_guard<std::mutex> lock(fUnzipMutex);
+         fUnzipPending += loclen - reserved;
+         reserved = 0;
+         fUnzipPendingMax = std::max(fUnzipPendingMax, fUnzipPending);
+         fUnzipState.SetUnzipped(index, ptr, loclen); // Set it as done
+      }
       fNUnzip++;
    } else {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
@@ -604,53 +675,278 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    return 0;
 }
 
-#ifdef R__USE_IMT
 ////////////////////////////////////////////////////////////////////////////////
-/// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
-/// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping
-/// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// Whether the baskets of the current block are read from the cache buffer,
+/// i.e. neither asynchronous reading nor prefetching is used.
 
-Int_t TTreeCacheUnzip::CreateTasks()
+bool TTreeCacheUnzip::IsDirectAccess() const
 {
-   auto mapFunction = [&]() {
-      auto unzipFunction = [&](const std::vector<Int_t> &indices) {
-         // If cache is invalidated and we should return immediately.
-         if (!fIsTransferred) return nullptr;
-
-         for (auto ii : indices) {
-            if(fUnzipState.TryUnzipping(ii)) {
-               Int_t res = UnzipCache(ii);
-               if(res)
-                  if (gDebug > 0)
-                     Info("UnzipCache", "Unzipping failed or cache is in learning state");
-            }
-         }
-         return nullptr;
-      };
-
-      Int_t accusz = 0;
-      std::vector<std::vector<Int_t>> basketIndices;
-      std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
-      for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
+   return !IsAsyncReading() && !fEnablePrefetching;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Whether FillBuffer() registers a new block when it is called for the
+/// current entry of the tree, i.e. whether it waits for the tasks.
+
+bool TTreeCacheUnzip::IsRefillPending() const
+{
+   if (fNbranches <= 0)
+      return false;
+   TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
+   Long64_t entry = tree->GetReadEntry();
+   return !(fEntryCurrent <= entry && entry < fEntryNext);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the size of the basket at the given position of the sorted list
+/// once unzipped. The size is taken from the key if the basket is in the cache
+/// buffer, otherwise the compressed size is used.
+
+Int_t TTreeCacheUnzip::GetUnzipLenEstimate(Int_t sortedIdx)
+{
+   Int_t nbytes = 0, objlen = 0, keylen = 0;
+   if (IsDirectAccess() && (sortedIdx < fNLanded))
+      GetRecordHeader(&fBuffer[fSeekPos[sortedIdx]], fSeekSortLen[sortedIdx], nbytes, objlen, keylen);
+   return (objlen > 0) ? keylen + objlen : fSeekSortLen[sortedIdx];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reads the next baskets of the block being transferred, at least
+/// fUnzipGroupSize bytes, into the cache buffer and queues them for unzipping.
+/// Called by the transfer task and by the main thread if it needs a basket
+/// that has not yet arrived.
+/// Returns false if there is nothing left to read or in case of read failure.
+
+bool TTreeCacheUnzip::TransferNext()
+{
+   {
+      R__LOCKGUARD(fIOMutex.get());
+      const Int_t first = fNLanded;
+      if (!fTransferring || fTransferFailed || (first >= fNseek))
+         return false;
+
+      // Adjacent baskets are merged into a single block of the vectored read
+      std::vector<Long64_t> pos;
+      std::vector<Int_t> len;
+      const Int_t groupSize = (fUnzipGroupSize > 0) ? fUnzipGroupSize : 102400;
+      Long64_t nbytes = 0;
+      Int_t last = first;
+      for (; (last < fNseek) && (nbytes < groupSize); ++last) {
+         if (!pos.empty() && (fSeekSort[last] == pos.back() + len.back())) {
+            len.back() += fSeekSortLen[last];
+         } else {
+            pos.push_back(fSeekSort[last]);
+            len.push_back(fSeekSortLen[last]);
          }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
-         indices.clear();
-         accusz = 0;
+         nbytes += fSeekSortLen[last];
+      }
+
+      // The blocks are stored consecutively, which matches the layout given by fSeekPos
+      if (fPrefetchFile->ReadBuffers(&fBuffer[fSeekPos[first]], pos.data(), len.data(), (Int_t)pos.size())) {
+         fTransferFailed = true;
+         return false;
+      }
+      fNLanded = last;
+   } // end of lock scope
+
+#ifdef R__USE_IMT
+   ScheduleUnzip();
+#endif
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Makes sure that the basket at the given position of the sorted list is in
+/// the cache buffer. If the transfer task did not get there yet, the missing
+/// part of the block is read by the calling thread.
+/// Returns false in case of read failure.
+
+bool TTreeCacheUnzip::WaitForLanding(Int_t sortedIdx)
+{
+   while (fTransferring && (fNLanded <= sortedIdx)) {
+      if (!TransferNext())
+         return fNLanded > sortedIdx;
+   }
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by the main thread before it reads a basket which is not in the
+/// current block while holding the I/O lock. The transfer task, which takes
+/// the I/O lock, is stopped; the unzip tasks do not need it. The transfer must
+/// be resumed with ResumeTransfer() once the I/O lock is released.
+
+void TTreeCacheUnzip::PrepareDirectRead()
+{
+#ifdef R__USE_IMT
+   StopTransfer();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Resumes the transfer of the current block stopped by PrepareDirectRead(),
+/// such that its remaining part is not read synchronously by the main thread.
+
+void TTreeCacheUnzip::ResumeTransfer()
+{
+#ifdef R__USE_IMT
+   if (fTransferring && !fTransferTaskGroup && (fNLanded < fNseek))
+      RunTransfer();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Waits for the transfer and the unzip tasks, cancelling the unzip tasks
+/// that did not start yet. The baskets of the latter are unzipped by the main
+/// thread on demand. If the block was not entirely transferred, it will be read
+/// again synchronously.
+
+void TTreeCacheUnzip::StopTasks()
+{
+#ifdef R__USE_IMT
+   StopTransfer();
+   if (fUnzipTaskGroup) {
+      fUnzipTaskGroup->Cancel();
+      fUnzipTaskGroup.reset();
+   }
+#endif
+
+   fNScheduled = 0;
+   fUnzipPending = 0;
+   for (Int_t i = 0; i < fNseekMax; ++i) {
+      if (fUnzipState.IsUnzipped(i))
+         fUnzipPending += fUnzipState.fUnzipLen[i];
+   }
+
+   if (fTransferring && (fNLanded < fNseek)) {
+      fIsSorted = false;
+      fIsTransferred = false;
+   }
+   fTransferring = false;
+}
+
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// Whether the cache block can be transferred by a background task.
+
+bool TTreeCacheUnzip::CanPipeline() const
+{
+   return ROOT::IsImplicitMTEnabled() && fParallel && IsDirectAccess();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Starts the transfer of the block registered by FillBuffer() in a background
+/// task. The baskets are queued for unzipping as they arrive.
+
+void TTreeCacheUnzip::StartTransfer()
+{
+   if (!fNseek)
+      return;
+
+   // Sorting may reallocate the cache buffer, hence it has to happen before any task accesses it
+   Sort();
+   fNLanded = 0;
+   fNScheduled = 0;
+   fTransferFailed = false;
+   fTransferring = true;
+   // The baskets are taken from the cache buffer as soon as they have arrived
+   fIsTransferred = true;
+
+   if (!fUnzipTaskGroup)
+      fUnzipTaskGroup = std::make_unique<ROOT::Experimental::TTaskGroup>();
+   RunTransfer();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Runs a task which transfers the remaining part of the current block.
+
+void TTreeCacheUnzip::RunTransfer()
+{
+   fTransferTaskGroup = std::make_unique<ROOT::Experimental::TTaskGroup>();
+   fTransferTaskGroup->Run([this]() {
+      while (!fTransferStop && TransferNext()) {
+         // Keep on reading until the block is complete
       }
-      ROOT::TThreadExecutor pool;
-      pool.Foreach(unzipFunction, basketIndices);
-   };
+   });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Waits for the transfer task to finish its current request and stops it.
+
+void TTreeCacheUnzip::StopTransfer()
+{
+   if (!fTransferTaskGroup)
+      return;
+   fTransferStop = true;
+   fTransferTaskGroup.reset();
+   fTransferStop = false;
+}
 
-   fUnzipTaskGroup = std::make_unique<ROOT::Experimental::TTaskGroup>();
-   fUnzipTaskGroup->Run(mapFunction);
+////////////////////////////////////////////////////////////////////////////////
+/// Creates an unzip task for every basket that has arrived in the cache buffer
+/// and that is not yet taken care of, in file order, as long as the memory
+/// reserved for the unzipped baskets stays below fUnzipBufferSize. Baskets
+/// which are larger than four times the budget are left to the main thread.
+/// The basket is only claimed once the task starts, such that the main thread
+/// never waits for a task which is still queued.
+
+void TTreeCacheUnzip::ScheduleUnzip()
+{
+   std::lock_guard<std::mutex> lock(fUnzipMutex);
+   if (!fUnzipTaskGroup)
+      return;
+
+   const Long64_t budget = (fUnzipBufferSize > 0) ? fUnzipBufferSize : GetBufferSize();
+   const Int_t nLanded = fNLanded;
+   for (; fNScheduled < nLanded; ++fNScheduled) {
+      const Int_t index = fSeekIndex[fNScheduled];
+      if (!fUnzipState.IsUntouched(index))
+         continue;
+      const Int_t unzipLen = GetUnzipLenEstimate(fNScheduled);
+      if (unzipLen > 4 * budget)
+         continue;
+      if ((fUnzipPending > 0) && (fUnzipPending + unzipLen > budget))
+         break;
+
+      fUnzipPending += unzipLen;
+      fUnzipPendingMax = std::max(fUnzipPendingMax, fUnzipPending);
+      if (nLanded < fNseek)
+         fNPipelined++;
+      fUnzipTaskGroup->Run([this, index, unzipLen]() {
+         Long64_t reserved = unzipLen;
+         if (fUnzipState.TryUnzipping(index)) {
+            if (UnzipCache(index, reserved) && (gDebug > 0))
+               Info("UnzipCache", "Unzipping failed or cache is in learning state");
+         }
+         std::lock_guard<std::mutex> taskLock(fUnzipMutex);
+         fUnzipPending -= reserved;
+         fUnzipCondition.notify_all();
+      });
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Queues the baskets of the current block for unzipping by IMT tasks, within
+/// the memory budget given by fUnzipBufferSize. Further baskets are queued as
+/// the main thread consumes the unzipped ones. If the block is transferred in
+/// the background, only the baskets that have arrived are queued and a stopped
+/// transfer is resumed. No task is created with asynchronous reading or
+/// prefetching, where the tasks would need the I/O lock held by the main thread
+/// while it refills the cache.
+
+Int_t TTreeCacheUnzip::CreateTasks()
+{
+   if (!IsDirectAccess())
+      return 0;
+   if (!fUnzipTaskGroup)
+      fUnzipTaskGroup = std::make_unique<ROOT::Experimental::TTaskGroup>();
 
+   if (!fTransferring)
+      fNLanded = fIsTransferred ? fNseek : 0;
+   else
+      ResumeTransfer();
+
+   ScheduleUnzip();
    return 0;
 }
 #endif
@@ -679,8 +975,6 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, bool
    // Also, here we prefer not to trigger the (re)population of the chunks in the TFileCacheRead. That is
    // better to be done in the main thread.
 
-   Int_t myCycle = fCycle;
-
    if (fParallel && !fIsLearning) {
 
       if(fNseekMax < fNseek){
@@ -692,87 +986,74 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, bool
       }
 
       loc = (Int_t)TMath::BinarySearch(fNseek, fSeekSort, pos);
-      if ((fCycle == myCycle) && (loc >= 0) && (loc < fNseek) && (pos == fSeekSort[loc])) {
+      if ((loc >= 0) && (loc < fNseek) && (pos == fSeekSort[loc])) {
 
          // The buffer is, at minimum, in the file cache. We must know its index in the requests list
          // In order to get its info
          Int_t seekidx = fSeekIndex[loc];
+         bool stalled = fTransferring && (fNLanded <= loc);
+
+         if (WaitForLanding(loc)) {
+            // If the block is ready we get it immediately. If a task is unzipping it, we wait for the task.
+            // Otherwise the main thread takes charge of the block.
+            std::unique_lock<std::mutex> lock(fUnzipMutex);
+            bool claimed = false;
+            while (!claimed && !fUnzipState.IsUnzipped(seekidx)) {
+               if (fUnzipState.IsProgress(seekidx)) {
+                  stalled = true;
+                  fUnzipCondition.wait(lock);
+               } else {
+                  claimed = fUnzipState.TryUnzipping(seekidx) || fUnzipState.IsFinished(seekidx);
+               }
+            }
 
-         do {
-
-            // If the block is ready we get it immediately.
-            // And also we don't have to alloc the blks. This is supposed to be
-            // the main thread of the app.
-            if (fUnzipState.IsUnzipped(seekidx)) {
+            if (!claimed) {
+               const Int_t unzipLen = fUnzipState.fUnzipLen[seekidx];
                if(!(*buf)) {
-                  *buf = fUnzipState.fUnzipChunks[seekidx].get();
-                  fUnzipState.fUnzipChunks[seekidx].release();
+                  *buf = fUnzipState.fUnzipChunks[seekidx].release();
                   *free = true;
                } else {
-                  memcpy(*buf, fUnzipState.fUnzipChunks[seekidx].get(), fUnzipState.fUnzipLen[seekidx]);
+                  memcpy(*buf, fUnzipState.fUnzipChunks[seekidx].get(), unzipLen);
                   fUnzipState.fUnzipChunks[seekidx].reset();
                   *free = false;
                }
+               fUnzipPending -= unzipLen;
+               lock.unlock();
 
-               fNFound++;
-               return fUnzipState.fUnzipLen[seekidx];
-            }
-
-            // If the requested basket is being unzipped by a background task, we try to steal a blk to unzip.
-            Int_t reqi = -1;
-
-            if (fUnzipState.IsProgress(seekidx)) {
-               if (fEmpty) {
-                  for (Int_t ii = 0; ii < fNseek; ++ii) {
-                     Int_t idx = (seekidx + 1 + ii) % fNseek;
-                     if (fUnzipState.IsUntouched(idx)) {
-                        if(fUnzipState.TryUnzipping(idx)) {
-                           reqi = idx;
-                           break;
-                        }
-                     }
-                  }
-                  if (reqi < 0) {
-                     fEmpty = false;
-                  } else {
-                     UnzipCache(reqi);
-                  }
-               }
-
-               if ( myCycle != fCycle ) {
-                  if (gDebug > 0)
-                     Info("GetUnzipBuffer", "Sudden paging Break!!! fNseek: %d, fIsLearning:%d",
-                          fNseek, fIsLearning);
-
-                  seekidx = -1;
-                  break;
-               }
-            }
-
-         } while (fUnzipState.IsProgress(seekidx));
-
-         // Here the block is not pending. It could be done or aborted or not yet being processed.
-         if ( (seekidx >= 0) && (fUnzipState.IsUnzipped(seekidx)) ) {
-            if(!(*buf)) {
-              *buf = fUnzipState.fUnzipChunks[seekidx].get();
-               fUnzipState.fUnzipChunks[seekidx].release();
-               *free = true;
-            } else {
-               memcpy(*buf, fUnzipState.fUnzipChunks[seekidx].get(), fUnzipState.fUnzipLen[seekidx]);
-               fUnzipState.fUnzipChunks[seekidx].reset();
-               *free = false;
+#ifdef R__USE_IMT
+               // Memory was released, more baskets can be unzipped
+               ScheduleUnzip();
+#endif
+               if (stalled)
+                  fNStalls++;
+               else
+                  fNFound++;
+               return unzipLen;
             }
 
-            fNStalls++;
-            return fUnzipState.fUnzipLen[seekidx];
-         } else {
             // This is a complete miss. We want to avoid the background tasks
             // to try unzipping this block in the future.
             fUnzipState.SetMissed(seekidx);
          }
       } else {
          loc = -1;
-         fIsTransferred = false;
+#ifdef R__USE_IMT
+         // The basket belongs to the next block: register it and transfer it in the background
+         if (CanPipeline() && GetPrefetchFile()) {
+            // As for the reads below, the cache is refilled under the I/O lock
+            PrepareDirectRead();
+            bool filled = false;
+            {
+               R__LOCKGUARD(fIOMutex.get());
+               filled = FillBuffer();
+            }
+            if (filled) {
+               StartTransfer();
+               return GetUnzipBuffer(buf, pos, len, free);
+            }
+            ResumeTransfer();
+         }
+#endif
       }
    }
 
@@ -788,23 +1069,21 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, bool
       }
    }
 
-   res = 0;
-   if (!ReadBufferExt(fCompBuffer, pos, len, loc)) {
-      // Cache is invalidated and we need to wait for all unzipping tasks to be finished before fill new baskets in cache.
-#ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled() && fUnzipTaskGroup) {
-         fUnzipTaskGroup->Cancel();
-         fUnzipTaskGroup.reset();
-      }
-#endif
+   res = ReadBufferExt(fCompBuffer, pos, len, loc);
+   if (res > 0) {
+      res = 0;
+   } else if (res == 0) {
+      // The basket is not in the cache. The transfer task must not wait for the
+      // I/O lock held by the read, it is resumed by CreateTasks().
+      PrepareDirectRead();
       {
          // Fill new baskets into cache.
          R__LOCKGUARD(fIOMutex.get());
-	      fFile->Seek(pos);
-	      res = fFile->ReadBuffer(fCompBuffer, len);
+         fFile->Seek(pos);
+         res = fFile->ReadBuffer(fCompBuffer, len);
       } // end of lock scope
 #ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled()) {
+      if(ROOT::IsImplicitMTEnabled() && fParallel) {
          CreateTasks();
       }
 #endif
@@ -949,6 +1228,8 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
    printf("******TreeCacheUnzip statistics for file: %s ******\n",fFile->GetName());
    printf("Max allowed mem for pending buffers: %lld\n", fUnzipBufferSize);
    printf("Number of blocks unzipped by threads: %d\n", fNUnzip);
+   printf("Number of blocks queued before the end of the transfer: %d\n", fNPipelined);
+   printf("Max mem used by pending buffers: %lld\n", fUnzipPendingMax);
    printf("Number of hits: %d\n", fNFound);
    printf("Number of stalls: %d\n", fNStalls);
    printf("Number of misses: %d\n", fNMissed);
@@ -959,6 +1240,18 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t TTreeCacheUnzip::ReadBufferExt(char *buf, Long64_t pos, Int_t len, Int_t &loc) {
+   // The read may refill the cache, which waits for the tasks: the transfer task needs the I/O lock
+   if (IsRefillPending())
+      StopTasks();
+   // Baskets of the block being transferred can only be copied once they have arrived
+   if (fTransferring) {
+      const Int_t sortedIdx = (loc >= 0) ? loc : (Int_t)TMath::BinarySearch(fNseek, fSeekSort, pos);
+      if ((sortedIdx >= 0) && (sortedIdx < fNseek) && (pos == fSeekSort[sortedIdx]) && !WaitForLanding(sortedIdx)) {
+         // Read failure: fall back to reading the entire block again
+         StopTasks();
+         loc = -1;
+      }
+   }
    R__LOCKGUARD(fIOMutex.get());
    return TTreeCache::ReadBufferExt(buf, pos, len, loc);
 }
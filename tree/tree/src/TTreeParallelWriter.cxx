@@ -0,0 +1,147 @@
+/*************************************************************************
+ * Copyright (C) 1995-2024, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/TTreeParallelWriter.hxx"
+
+#include "TDirectory.h"
+#include "TError.h"
+#include "TFile.h"
+#include "TList.h"
+#include "TROOT.h"
+#include "TTree.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace ROOT {
+namespace Experimental {
+
+TTreeFillContext::TTreeFillContext(TTreeParallelWriter &writer, TTree *tree)
+   : fWriter(writer), fTree(tree), fClusterSize(writer.fTree.GetAutoFlush())
+{
+}
+
+TTreeFillContext::~TTreeFillContext()
+{
+   FlushCluster();
+   std::lock_guard<std::mutex> lock(fWriter.fMutex);
+   // Deleting the clone touches its directory, shared with the other contexts.
+   delete fTree;
+   --fWriter.fNContexts;
+}
+
+bool TTreeFillContext::IsClusterFull() const
+{
+   // Same criteria as TTree::Fill for its first auto flush.
+   if (fClusterSize > 0)
+      return fTree->GetEntries() >= fClusterSize;
+   if (fClusterSize < 0)
+      return fTree->GetZipBytes() > -fClusterSize;
+   return false;
+}
+
+std::unique_lock<std::mutex> TTreeFillContext::LockBasketWrites()
+{
+#ifdef R__USE_IMT
+   // TBasket::WriteBuffer serializes the access to the file, the compression runs in parallel.
+   return std::unique_lock<std::mutex>();
+#else
+   return std::unique_lock<std::mutex>(fWriter.fMutex);
+#endif
+}
+
+Int_t TTreeFillContext::Fill()
+{
+   Int_t nbytes = 0;
+   {
+      auto lock = LockBasketWrites();
+      nbytes = fTree->Fill();
+   }
+   if (nbytes >= 0 && IsClusterFull() && FlushCluster() < 0)
+      return -1;
+   return nbytes;
+}
+
+Long64_t TTreeFillContext::FlushCluster()
+{
+   if (fTree->GetEntries() == 0)
+      return 0;
+
+   Int_t nbytes = 0;
+   {
+      auto lock = LockBasketWrites();
+      nbytes = fTree->FlushBaskets(false);
+   }
+
+   std::lock_guard<std::mutex> lock(fWriter.fMutex);
+   Long64_t nentries = -1;
+   if (nbytes < 0) {
+      Error("TTreeFillContext::FlushCluster", "Failed to write the baskets of %lld entries of tree %s.",
+            fTree->GetEntries(), fTree->GetName());
+   } else {
+      nentries = fWriter.fTree.ImportCluster(*fTree);
+   }
+   // Get ready for the next cluster: the baskets now belong to the tree of the writer. The empty write baskets of
+   // the clone are kept for the next cluster.
+   fTree->ResetAfterMerge(nullptr);
+   return nentries;
+}
+
+TTreeParallelWriter::TTreeParallelWriter(TTree &tree) : fTree(tree)
+{
+   TDirectory *dir = tree.GetDirectory();
+   TFile *file = dir ? dir->GetFile() : nullptr;
+   if (!file || !file->IsWritable()) {
+      throw std::runtime_error(std::string("TTreeParallelWriter: the tree ") + tree.GetName() +
+                               " is not attached to a file opened for writing.");
+   }
+   if (tree.GetBranchRef()) {
+      throw std::runtime_error(std::string("TTreeParallelWriter: the tree ") + tree.GetName() +
+                               " has a TBranchRef, which is not supported.");
+   }
+
+   ROOT::EnableThreadSafety();
+   // Write the entries already filled; TTree::ImportCluster closes their cluster range.
+   tree.FlushBaskets(false);
+}
+
+TTreeParallelWriter::~TTreeParallelWriter()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (fNContexts) {
+      Error("TTreeParallelWriter", "%zu fill contexts of tree %s are still alive.", fNContexts, fTree.GetName());
+   }
+}
+
+std::unique_ptr<TTreeFillContext> TTreeParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   TDirectory *dir = fTree.GetDirectory();
+   TTree *tree = nullptr;
+   {
+      TDirectory::TContext ctxt(dir);
+      tree = fTree.CloneTree(0);
+   }
+   if (!tree) {
+      Error("TTreeParallelWriter", "Failed to clone tree %s.", fTree.GetName());
+      return nullptr;
+   }
+   // The clone writes its baskets into the file of fTree, but it is neither registered in the directory, where it
+   // would be written by TFile::Write, nor in the clones of fTree, whose branch addresses it would follow.
+   if (TList *clones = fTree.GetListOfClones())
+      clones->Remove(tree);
+   dir->Remove(tree);
+   // The clusters are committed by TTreeFillContext::Fill
+   tree->SetAutoFlush(0);
+   tree->SetAutoSave(0);
+   ++fNContexts;
+   return std::unique_ptr<TTreeFillContext>(new TTreeFillContext(*this, tree));
+}
+
+} // namespace Experimental
+} // namespace ROOT
@@ -236,3 +236,93 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, bulkRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   printf("Starting read of file %s.\n", fFileName.c_str());
+   TStopwatch sw;
+
+   printf("Using bulk APIs.\n");
+
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+   auto branchLen = tree->GetBranch("myLen");
+   ASSERT_TRUE(branchLen);
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   Long64_t events = fEventCount;
+   Int_t cluster_size = std::min(fClusterSize, fEventCount);
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile countBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile lenBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile fixedCountBuf(TBuffer::kWrite, 32*1024);
+
+   sw.Start();
+   while (events) {
+      // The count buffer is filled with the deserialized content of the count branch
+      auto count = branchFloat->GetBulkRead().GetBulkEntries(evt_idx, floatBuf, &countBuf);
+      ASSERT_EQ(count, cluster_size);
+      count = branchDouble->GetBulkRead().GetBulkEntries(evt_idx, doubleBuf);
+      ASSERT_EQ(count, cluster_size);
+      // A fixed-size branch yields a count of one element per entry
+      count = branchLen->GetBulkRead().GetBulkEntries(evt_idx, lenBuf, &fixedCountBuf);
+      ASSERT_EQ(count, cluster_size);
+      for (Int_t idx = 0; idx < count; idx++) {
+         int entry_count;
+         memcpy(&entry_count, fixedCountBuf.GetCurrent() + idx * sizeof(int), sizeof(int));
+         ASSERT_EQ(1, entry_count);
+      }
+
+      if (events > count) {
+         events -= count;
+      } else {
+         events = 0;
+      }
+      const char *float_buf = floatBuf.GetCurrent();
+      const char *double_buf = doubleBuf.GetCurrent();
+      const char *count_buf = countBuf.GetCurrent();
+      const char *len_buf = lenBuf.GetCurrent();
+      for (Int_t idx = 0; idx < count; idx++) {
+         int entry_count, entry_len;
+         memcpy(&entry_count, count_buf + idx * sizeof(int), sizeof(int));
+         memcpy(&entry_len, len_buf + idx * sizeof(int), sizeof(int));
+         ASSERT_EQ(entry_count, entry_len);
+         ASSERT_EQ(entry_count, (evt_idx + idx + 1) % 10);
+
+         for (int entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+            float entry_f;
+            memcpy(&entry_f, float_buf, sizeof(float));
+            float_buf += sizeof(float);
+            double entry_d;
+            memcpy(&entry_d, double_buf, sizeof(double));
+            double_buf += sizeof(double);
+            if (R__unlikely((evt_idx < 1600000) && (entry_f != idx_f))) {
+               printf("Incorrect value on float branch: %f, expected %f (event %lld)\n", entry_f, idx_f, evt_idx + idx);
+               ASSERT_TRUE(false);
+            }
+            idx_f++;
+            if (R__unlikely((evt_idx < 1600000) && (entry_d != idx_d))) {
+               printf("Incorrect value on double branch: %f, expected %f (event %lld)\n", entry_d, idx_d, evt_idx + idx);
+               ASSERT_TRUE(false);
+            }
+            idx_d++;
+         }
+      }
+      evt_idx += count;
+   }
+   events = fEventCount;
+   ASSERT_EQ(evt_idx, events);
+   delete hfile;
+
+   sw.Stop();
+   printf("Bulk API: Successful read of all events.\n");
+   printf("Bulk API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
+}
@@ -1,10 +1,14 @@
 #include "TFile.h"
+#include "TNamed.h"
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
 
 #include "gtest/gtest.h"
 
+#include <memory>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +32,75 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, ParallelUnzip)
+{
+   const auto fileName = "parallelUnzipMT.root";
+   const Long64_t nEntries = 200000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      Long64_t id = 0;
+      double x = 0.;
+      float y = 0.f;
+      t.Branch("id", &id);
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      // Clusters of 40 kB and baskets of at most 16 kB once unzipped
+      t.SetAutoFlush(2000);
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         id = i;
+         x = 0.5 * i;
+         y = i % 1000;
+         t.Fill();
+      }
+      t.Write();
+      TNamed n("n", "another object of the file");
+      n.Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      t->SetCacheSize(256 * 1024);
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(t->GetReadCache(&f));
+      ASSERT_NE(cache, nullptr);
+      // One basket per request and a budget below the size of a cluster once unzipped, such that the block is
+      // transferred in several parts and the unzipping is throttled by the consumption of the baskets
+      cache->SetUnzipGroupSize(1);
+      cache->SetUnzipBufferSize(24 * 1024);
+
+      Long64_t id = -1;
+      double x = -1.;
+      float y = -1.f;
+      t->SetBranchAddress("id", &id);
+      t->SetBranchAddress("x", &x);
+      t->SetBranchAddress("y", &y);
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         EXPECT_EQ(i, id);
+         EXPECT_DOUBLE_EQ(0.5 * i, x);
+         EXPECT_FLOAT_EQ(i % 1000, y);
+         // The transfer runs on its own handle of the file, other reads from the file are not disturbed
+         if (i % 10000 == 0) {
+            std::unique_ptr<TNamed> n(f.Get<TNamed>("n"));
+            ASSERT_NE(n, nullptr);
+            EXPECT_STREQ("another object of the file", n->GetTitle());
+         }
+      }
+      EXPECT_GT(cache->GetNFound() + cache->GetNMissed(), 0);
+      // Baskets were queued for unzipping while the rest of their block was still being transferred
+      EXPECT_GT(cache->GetNUnzip(), 0);
+      EXPECT_GT(cache->GetNPipelined(), 0);
+      // The memory reserved for the unzipped baskets stayed within the budget
+      EXPECT_GT(cache->GetUnzipPendingMax(), 0);
+      EXPECT_LE(cache->GetUnzipPendingMax(), cache->GetUnzipBufferSize());
+   }
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kDisable);
+   ROOT::DisableImplicitMT();
+   gSystem->Unlink(fileName);
+}
+
 #endif // R__USE_IMT
@@ -0,0 +1,174 @@
+#include "TChain.h"
+#include "TEnv.h"
+#include "TFile.h"
+#include "TNamed.h"
+#include "TRandom3.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace {
+
+constexpr Long64_t kNEntries = 20000;
+
+void WriteTree(const char *fileName, bool withFriend = false)
+{
+   TFile file(fileName, "RECREATE");
+   TTree tree("tree", "A tree with many clusters");
+   tree.SetAutoFlush(1000);
+   Long64_t id = 0;
+   Double_t x = 0;
+   tree.Branch("id", &id);
+   tree.Branch("x", &x);
+   // Random values, such that the baskets do not compress too well and the cache holds few clusters
+   TRandom3 random(42);
+   for (id = 0; id < kNEntries; ++id) {
+      x = random.Uniform();
+      tree.Fill();
+   }
+   if (withFriend) {
+      TTree friendTree("friendTree", "A friend in the same file");
+      friendTree.SetAutoFlush(700);
+      Double_t y = 0;
+      friendTree.Branch("y", &y);
+      TRandom3 friendRandom(7);
+      for (Long64_t i = 0; i < kNEntries; ++i) {
+         y = friendRandom.Uniform();
+         friendTree.Fill();
+      }
+      TNamed note("note", "another object of the file");
+      note.Write();
+   }
+   file.Write();
+}
+
+void CheckEntries(TTree &tree)
+{
+   Long64_t id = -1;
+   Double_t x = -1;
+   tree.SetBranchAddress("id", &id);
+   tree.SetBranchAddress("x", &x);
+   TRandom3 random(42);
+   const auto nEntries = tree.GetEntries();
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      ASSERT_GT(tree.GetEntry(i), 0);
+      EXPECT_EQ(i % kNEntries, id);
+      EXPECT_DOUBLE_EQ(random.Uniform(), x);
+      if (i % kNEntries == kNEntries - 1)
+         random.SetSeed(42);
+   }
+   tree.ResetBranchAddresses();
+}
+
+} // anonymous namespace
+
+TEST(TTreeCache, AsyncPrefetch)
+{
+   const auto fileName = "TTreeCacheAsyncPrefetch.root";
+   WriteTree(fileName);
+
+   {
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileName));
+      auto tree = file->Get<TTree>("tree");
+      tree->SetCacheSize(32 * 1024);
+      tree->AddBranchToCache("*");
+      tree->StopCacheLearningPhase();
+      auto cache = tree->GetReadCache(file.get());
+      ASSERT_NE(nullptr, cache);
+      cache->SetAsyncPrefetch(true);
+      EXPECT_TRUE(cache->GetAsyncPrefetch());
+
+      CheckEntries(*tree);
+      EXPECT_GT(cache->GetEfficiencyRel(), 0.9);
+      // The baskets were taken from the background reads
+      EXPECT_GT(cache->GetNReadAsync(), 0);
+
+      // Changing the entry range drops the block read in the background
+      cache->SetEntryRange(kNEntries / 2, kNEntries);
+      CheckEntries(*tree);
+
+      cache->SetAsyncPrefetch(false);
+      EXPECT_FALSE(cache->GetAsyncPrefetch());
+   }
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(TTreeCache, AsyncPrefetchChain)
+{
+   const auto fileName = "TTreeCacheAsyncPrefetchChain.root";
+   WriteTree(fileName);
+
+   // The caches created by the chain for each of its files take the default from the configuration
+   const auto configured = gEnv->GetValue("TTreeCache.AsyncPrefetch", 0);
+   gEnv->SetValue("TTreeCache.AsyncPrefetch", 1);
+   {
+      TChain chain("tree");
+      chain.Add(fileName);
+      chain.Add(fileName);
+      chain.SetCacheSize(32 * 1024);
+      CheckEntries(chain);
+      EXPECT_EQ(2 * kNEntries, chain.GetEntries());
+   }
+   gEnv->SetValue("TTreeCache.AsyncPrefetch", configured);
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(TTreeCache, AsyncPrefetchFriendInSameFile)
+{
+   const auto fileName = "TTreeCacheAsyncPrefetchFriend.root";
+   WriteTree(fileName, /*withFriend=*/true);
+
+   // The trees read the same file concurrently with their background reads; both caches prefetch asynchronously
+   const auto configured = gEnv->GetValue("TTreeCache.AsyncPrefetch", 0);
+   gEnv->SetValue("TTreeCache.AsyncPrefetch", 1);
+   {
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileName));
+      auto tree = file->Get<TTree>("tree");
+      ASSERT_NE(nullptr, tree);
+      tree->AddFriend("friendTree");
+      auto friendTree = file->Get<TTree>("friendTree");
+      ASSERT_NE(nullptr, friendTree);
+      tree->SetCacheSize(32 * 1024);
+      friendTree->SetCacheSize(32 * 1024);
+
+      Long64_t id = -1;
+      Double_t x = -1;
+      Double_t y = -1;
+      tree->SetBranchAddress("id", &id);
+      tree->SetBranchAddress("x", &x);
+      tree->SetBranchAddress("y", &y);
+      TRandom3 random(42);
+      TRandom3 friendRandom(7);
+      for (Long64_t i = 0; i < kNEntries; ++i) {
+         ASSERT_GT(tree->GetEntry(i), 0);
+         EXPECT_EQ(i, id);
+         EXPECT_DOUBLE_EQ(random.Uniform(), x);
+         EXPECT_DOUBLE_EQ(friendRandom.Uniform(), y);
+         // Other objects of the file are read as well
+         if (i % 5000 == 0) {
+            std::unique_ptr<TNamed> note(file->Get<TNamed>("note"));
+            ASSERT_NE(nullptr, note);
+            EXPECT_STREQ("another object of the file", note->GetTitle());
+         }
+      }
+
+      auto cache = tree->GetReadCache(file.get());
+      ASSERT_NE(nullptr, cache);
+      EXPECT_TRUE(cache->GetAsyncPrefetch());
+      EXPECT_GT(cache->GetNReadAsync(), 0);
+      auto friendCache = friendTree->GetReadCache(file.get());
+      ASSERT_NE(nullptr, friendCache);
+      EXPECT_TRUE(friendCache->GetAsyncPrefetch());
+      EXPECT_GT(friendCache->GetNReadAsync(), 0);
+      tree->ResetBranchAddresses();
+   }
+   gEnv->SetValue("TTreeCache.AsyncPrefetch", configured);
+
+   gSystem->Unlink(fileName);
+}
@@ -0,0 +1,217 @@
+#include "TBranch.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "ROOT/TestSupport.hxx"
+#include <ROOT/TTreeParallelWriter.hxx>
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using ROOT::Experimental::TTreeParallelWriter;
+
+namespace {
+
+constexpr Long64_t kClusterSize = 500;
+constexpr Long64_t kNEntriesPerThread = 2500;
+constexpr int kNThreads = 4;
+
+void FillInParallel(TTreeParallelWriter &writer, Long64_t firstId)
+{
+   auto work = [&writer](Long64_t first) {
+      auto context = writer.CreateFillContext();
+      ASSERT_NE(nullptr, context);
+      Long64_t id = 0;
+      std::vector<float> values;
+      auto valuesPtr = &values;
+      context->GetTree()->SetBranchAddress("id", &id);
+      context->GetTree()->SetBranchAddress("values", &valuesPtr);
+      for (id = first; id < first + kNEntriesPerThread; ++id) {
+         values.assign(id % 5, id);
+         EXPECT_GT(context->Fill(), 0);
+      }
+   };
+   std::vector<std::thread> threads;
+   for (int i = 0; i < kNThreads; ++i)
+      threads.emplace_back(work, firstId + i * kNEntriesPerThread);
+   for (auto &t : threads)
+      t.join();
+}
+
+// Every id in [0, nEntries) must be present exactly once, with its values
+void CheckEntries(TTree &tree, Long64_t nEntries)
+{
+   ASSERT_EQ(nEntries, tree.GetEntries());
+   Long64_t id = -1;
+   std::vector<float> *values = nullptr;
+   tree.SetBranchAddress("id", &id);
+   tree.SetBranchAddress("values", &values);
+   std::vector<bool> seen(nEntries, false);
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      ASSERT_GT(tree.GetEntry(i), 0);
+      ASSERT_GE(id, 0);
+      ASSERT_LT(id, nEntries);
+      EXPECT_FALSE(seen[id]);
+      seen[id] = true;
+      ASSERT_EQ(static_cast<std::size_t>(id % 5), values->size());
+      for (auto v : *values)
+         EXPECT_FLOAT_EQ(id, v);
+   }
+   tree.ResetBranchAddresses();
+   delete values;
+}
+
+} // anonymous namespace
+
+TEST(TTreeParallelWriter, Fill)
+{
+   const auto fileName = "TTreeParallelWriterFill.root";
+   {
+      TFile file(fileName, "RECREATE");
+      TTree tree("tree", "tree");
+      tree.SetAutoFlush(kClusterSize);
+      Long64_t id = 0;
+      std::vector<float> values;
+      tree.Branch("id", &id);
+      tree.Branch("values", &values);
+      {
+         TTreeParallelWriter writer(tree);
+         FillInParallel(writer, 0);
+      }
+      EXPECT_EQ(kNThreads * kNEntriesPerThread, tree.GetEntries());
+      file.Write();
+   }
+
+   auto file = std::unique_ptr<TFile>(TFile::Open(fileName));
+   auto tree = file->Get<TTree>("tree");
+   ASSERT_NE(nullptr, tree);
+   CheckEntries(*tree, kNThreads * kNEntriesPerThread);
+
+   // Each context commits clusters of kClusterSize entries
+   auto clusters = tree->GetClusterIterator(0);
+   Long64_t nClusters = 0;
+   for (Long64_t start = clusters(); start < tree->GetEntries(); start = clusters()) {
+      EXPECT_EQ(nClusters * kClusterSize, start);
+      EXPECT_EQ(kClusterSize, clusters.GetNextEntry() - start);
+      ++nClusters;
+   }
+   EXPECT_EQ(kNThreads * kNEntriesPerThread / kClusterSize, nClusters);
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(TTreeParallelWriter, AppendToFilledTree)
+{
+   const auto fileName = "TTreeParallelWriterAppend.root";
+   constexpr Long64_t kNSerial = 700;
+   {
+      TFile file(fileName, "RECREATE");
+      TTree tree("tree", "tree");
+      tree.SetAutoFlush(kClusterSize);
+      Long64_t id = 0;
+      std::vector<float> values;
+      tree.Branch("id", &id);
+      tree.Branch("values", &values);
+      for (id = kNThreads * kNEntriesPerThread; id < kNThreads * kNEntriesPerThread + kNSerial; ++id) {
+         values.assign(id % 5, id);
+         tree.Fill();
+      }
+      {
+         TTreeParallelWriter writer(tree);
+         FillInParallel(writer, 0);
+      }
+      file.Write();
+   }
+
+   auto file = std::unique_ptr<TFile>(TFile::Open(fileName));
+   auto tree = file->Get<TTree>("tree");
+   ASSERT_NE(nullptr, tree);
+   CheckEntries(*tree, kNThreads * kNEntriesPerThread + kNSerial);
+
+   // The entries filled directly keep their clusters
+   auto clusters = tree->GetClusterIterator(0);
+   EXPECT_EQ(0, clusters());
+   EXPECT_EQ(kClusterSize, clusters.GetNextEntry());
+   EXPECT_EQ(kClusterSize, clusters());
+   EXPECT_EQ(kNSerial, clusters.GetNextEntry());
+   EXPECT_EQ(kNSerial, clusters());
+   EXPECT_EQ(kNSerial + kClusterSize, clusters.GetNextEntry());
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(TTreeParallelWriter, ReuseWriteBaskets)
+{
+   const auto fileName = "TTreeParallelWriterReuse.root";
+   {
+      TFile file(fileName, "RECREATE");
+      TTree tree("tree", "tree");
+      tree.SetAutoFlush(kClusterSize);
+      Long64_t id = 0;
+      tree.Branch("id", &id);
+      TTreeParallelWriter writer(tree);
+
+      auto context = writer.CreateFillContext();
+      ASSERT_NE(nullptr, context);
+      auto branch = context->GetTree()->GetBranch("id");
+      EXPECT_GT(context->Fill(), 0);
+      auto basket = branch->GetListOfBaskets()->UncheckedAt(0);
+      ASSERT_NE(nullptr, basket);
+      for (Long64_t i = 1; i < 3 * kClusterSize; ++i) {
+         EXPECT_GT(context->Fill(), 0);
+         // After every committed cluster, the clone fills the same basket again
+         if ((i + 1) % kClusterSize == 0) {
+            EXPECT_EQ(0, branch->GetWriteBasket());
+            EXPECT_EQ(basket, branch->GetListOfBaskets()->UncheckedAt(0));
+         }
+      }
+      context.reset();
+      EXPECT_EQ(3 * kClusterSize, tree.GetEntries());
+   }
+   gSystem->Unlink(fileName);
+}
+
+TEST(TTreeParallelWriter, FailedImportLeavesTreeUnchanged)
+{
+   const auto fileName = "TTreeParallelWriterFailedImport.root";
+   {
+      TFile file(fileName, "RECREATE");
+      TTree tree("tree", "tree");
+      Long64_t id = 0;
+      std::vector<float> values;
+      tree.Branch("id", &id);
+      tree.Branch("values", &values);
+      TTreeParallelWriter writer(tree);
+
+      // Only the write basket of the second branch holds an entry: the first branch could be imported.
+      tree.Fill();
+      tree.GetBranch("id")->FlushBaskets();
+      const auto nEntries = tree.GetEntries();
+      const auto nIdEntries = tree.GetBranch("id")->GetEntries();
+      const auto idWriteBasket = tree.GetBranch("id")->GetWriteBasket();
+
+      auto context = writer.CreateFillContext();
+      ASSERT_NE(nullptr, context);
+      for (int i = 0; i < 10; ++i)
+         EXPECT_GT(context->Fill(), 0);
+      {
+         ROOT_EXPECT_ERROR(EXPECT_EQ(-1, context->FlushCluster()), "TBranchElement::ImportBaskets",
+                           "The write basket of branch values is not empty.");
+      }
+      EXPECT_EQ(nEntries, tree.GetEntries());
+      EXPECT_EQ(nIdEntries, tree.GetBranch("id")->GetEntries());
+      EXPECT_EQ(idWriteBasket, tree.GetBranch("id")->GetWriteBasket());
+   }
+   gSystem->Unlink(fileName);
+}
+
+TEST(TTreeParallelWriter, MemoryResidentTree)
+{
+   TTree tree("tree", "tree");
+   tree.SetDirectory(nullptr);
+   EXPECT_THROW(TTreeParallelWriter writer(tree), std::runtime_error);
+}